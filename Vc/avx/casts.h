@@ -283,6 +283,89 @@ Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, ushort>) { return con
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, ushort>) { return v; }
 
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<int   , llong >) { return _mm256_cvtepi32_epi64(v); }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uint  , llong >) { return _mm256_cvtepu32_epi64(v); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<int   , ullong>) { return _mm256_cvtepi32_epi64(v); }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uint  , ullong>) { return _mm256_cvtepu32_epi64(v); }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, llong >) {
+    return concat(SSE::convert<double, llong>(lo128(v)), SSE::convert<double, llong>(hi128(v)));
+}
+Vc_INTRINSIC __m256i convert(__m256d v, ConvertTag<double, ullong>) {
+    return concat(SSE::convert<double, ullong>(lo128(v)), SSE::convert<double, ullong>(hi128(v)));
+}
+
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<llong , int   >) {
+    return lo128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+}
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<ullong, int   >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<llong , uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<ullong, uint  >) { return convert(v, ConvertTag<llong, int>()); }
+
+// see SSE::convert for the magic numbers
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<llong , double>) {
+    const __m256i hi = _mm256_blend_epi32(_mm256_srai_epi32(v, 16), _mm256_setzero_si256(), 0x55);
+    const __m256i lo = _mm256_or_si256(_mm256_and_si256(v, _mm256_set1_epi64x(0x0000ffffffffffffll)),
+                                       _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)));
+    const __m256d f = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_add_epi64(hi, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.)))),
+        _mm256_set1_pd(442726361368656609280.));
+    return _mm256_add_pd(f, _mm256_castsi256_pd(lo));
+}
+Vc_INTRINSIC __m256d convert(__m256i v, ConvertTag<ullong, double>) {
+    const __m256i hi = _mm256_or_si256(_mm256_srli_epi64(v, 32),
+                                       _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.)));
+    const __m256i lo = _mm256_blend_epi32(v, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)), 0xaa);
+    const __m256d f =
+        _mm256_sub_pd(_mm256_castsi256_pd(hi), _mm256_set1_pd(19342813118337666422669312.));
+    return _mm256_add_pd(f, _mm256_castsi256_pd(lo));
+}
+#endif
+
+// converts the 8 binary16 values in v
+Vc_INTRINSIC __m256 convert(__m128i v, ConvertTag<float16, float>) {
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtph_ps(v);
+#else
+    return concat(SSE::convert(v, SSE::ConvertTag<float16, float>()),
+                  SSE::convert(_mm_unpackhi_epi64(v, v), SSE::ConvertTag<float16, float>()));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m256 v, ConvertTag<float, float16>) {
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+    return _mm_unpacklo_epi64(SSE::convert(lo128(v), SSE::ConvertTag<float, float16>()),
+                              SSE::convert(hi128(v), SSE::ConvertTag<float, float16>()));
+#endif
+}
+
+// converts the 8 bfloat16 values in v
+Vc_INTRINSIC __m256 convert(__m128i v, ConvertTag<bfloat16, float>) {
+    return concat(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), v)),
+                  _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), v)));
+}
+Vc_INTRINSIC __m128i convert(__m256 v, ConvertTag<float, bfloat16>) {
+#ifdef Vc_IMPL_AVX2
+    const __m256i f = _mm256_castps_si256(v);
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(f, 16), _mm256_set1_epi32(1));
+    const __m256i rounded =
+        _mm256_add_epi32(_mm256_add_epi32(f, _mm256_set1_epi32(0x7fff)), odd);
+    const __m256i r = _mm256_blendv_epi8(
+        rounded, _mm256_or_si256(f, _mm256_set1_epi32(0x400000)),
+        _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+    const __m256i hi = _mm256_srai_epi32(r, 16);
+    return _mm_packs_epi32(lo128(hi), hi128(hi));
+#else
+    return _mm_unpacklo_epi64(SSE::convert(lo128(v), SSE::ConvertTag<float, bfloat16>()),
+                              SSE::convert(hi128(v), SSE::ConvertTag<float, bfloat16>()));
+#endif
+}
+
 template <typename From, typename To>
 Vc_INTRINSIC auto convert(
     typename std::conditional<(sizeof(From) < sizeof(To)),
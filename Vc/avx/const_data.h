@@ -63,6 +63,23 @@ template <> alignas(64) const float c_trig<float>::data[];
 template <> alignas(64) const double c_trig<double>::data[];
 #endif
 
+// coefficients of tanh and of erf/erfc, the layout is defined by Detail::TanhTraits<T> and
+// Detail::ErfTraits<T>
+template<typename T> struct c_tanh
+{
+    alignas(64) static const T data[];
+};
+template<typename T> struct c_erf
+{
+    alignas(64) static const T data[];
+};
+#ifndef Vc_MSVC
+template <> alignas(64) const float c_tanh<float>::data[];
+template <> alignas(64) const double c_tanh<double>::data[];
+template <> alignas(64) const float c_erf<float>::data[];
+template <> alignas(64) const double c_erf<double>::data[];
+#endif
+
 template<typename T> struct c_log
 {
     typedef float floatAlias Vc_MAY_ALIAS;
@@ -93,6 +110,8 @@ namespace AVX2
     using AVX::_IndexesFromZero32;
     using AVX::c_general;
     using AVX::c_trig;
+    using AVX::c_tanh;
+    using AVX::c_erf;
     using AVX::c_log;
 }  // namespace AVX2
 }  // namespace Vc
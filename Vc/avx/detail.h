@@ -431,6 +431,36 @@ Vc_INTRINSIC __m256 load(const short *mem, Flags f, LoadTag<__m256, float>)
 {
     return AVX::convert<short, float>(load16(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const float16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::convert(load16(aliasing_cast<ushort>(mem), f),
+                        AVX::ConvertTag<float16, float>());
+}
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const bfloat16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::convert(load16(aliasing_cast<ushort>(mem), f),
+                        AVX::ConvertTag<bfloat16, float>());
+}
+
+// convert_gathered{{{2
+#ifdef Vc_IMPL_AVX2
+/**\internal
+ * Converts the 16-bit float storage values that an epi32 gather placed in the low halves
+ * of \p v to float. The pointer argument only selects the storage type.
+ */
+Vc_INTRINSIC __m256 convert_gathered(__m256i v, const float16 *)
+{
+    v = AVX::and_si256(v, _mm256_set1_epi32(0xffff));
+    return AVX::convert(_mm_packus_epi32(AVX::lo128(v), AVX::hi128(v)),
+                        AVX::ConvertTag<float16, float>());
+}
+Vc_INTRINSIC __m256 convert_gathered(__m256i v, const bfloat16 *)
+{
+    return _mm256_castsi256_ps(_mm256_slli_epi32(v, 16));
+}
+#endif  // Vc_IMPL_AVX2
 /*
 template<typename Flags> struct LoadHelper<float, unsigned char, Flags> {
     static __m256 load(const unsigned char *mem, Flags)
@@ -583,6 +613,60 @@ template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 4, __m256>(__m256i k)
     return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)));
 }
 
+#ifdef Vc_IMPL_AVX2
+// 4 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<4, 32, __m256>(__m256i k)
+{
+    // aaaa bbbb cccc dddd -> abcd 0000 0000 0000 ...
+    return AVX::zeroExtend(_mm_castsi128_ps(_mm_packs_epi16(
+        _mm_castps_si128(mask_cast<4, 8, __m128>(k)), _mm_setzero_si128())));
+}
+
+// 8 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<8, 32, __m256>(__m256i k)
+{
+    // aabb ccdd eeff gghh -> abcd efgh 0000 0000 ...
+    return AVX::zeroExtend(_mm_castsi128_ps(_mm_packs_epi16(
+        _mm_castps_si128(mask_cast<8, 8, __m128>(k)), _mm_setzero_si128())));
+}
+
+// 16 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 32, __m256>(__m256i k)
+{
+    // aa bb cc ... pp -> abcd ... mnop 0000 ... 0000
+    return AVX::zeroExtend(
+        _mm_castsi128_ps(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k))));
+}
+
+// 32 -> 4
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 4, __m256>(__m256i k)
+{
+    // abcd ... -> aaaaaaaa bbbbbbbb cccccccc dddddddd
+    auto tmp = _mm_unpacklo_epi8(AVX::lo128(k), AVX::lo128(k));
+    tmp = _mm_unpacklo_epi16(tmp, tmp);
+    return _mm256_castsi256_ps(
+        AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)));
+}
+
+// 32 -> 8
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 8, __m256>(__m256i k)
+{
+    // abcd efgh ... -> aaaa bbbb cccc dddd eeee ffff gggg hhhh
+    const auto tmp = _mm_unpacklo_epi8(AVX::lo128(k), AVX::lo128(k));
+    return _mm256_castsi256_ps(
+        AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp)));
+}
+
+// 32 -> 16
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 16, __m256>(__m256i k)
+{
+    // abcd ... mnop ... -> aa bb cc ... pp
+    const auto lo = AVX::lo128(k);
+    return _mm256_castsi256_ps(
+        AVX::concat(_mm_unpacklo_epi8(lo, lo), _mm_unpackhi_epi8(lo, lo)));
+}
+#endif
+
 // allone{{{1
 template<> Vc_INTRINSIC Vc_CONST __m256  allone<__m256 >() { return AVX::setallone_ps(); }
 template<> Vc_INTRINSIC Vc_CONST __m256i allone<__m256i>() { return AVX::setallone_si256(); }
@@ -602,6 +686,8 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one( llong) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one(ullong) { return _mm256_set1_epi64x(1); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -620,6 +706,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return AVX::sub_epi64(_mm256_setzero_si256(), v);
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +785,11 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,  llong) {
+    const __m256i sign = AVX::cmpgt_epi64(_mm256_setzero_si256(), a);
+    return AVX::sub_epi64(xor_(a, sign), sign);
+}
+Vc_INTRINSIC __m256i abs(__m256i a, ullong) { return a; }
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +798,10 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  llong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ullong) { return AVX::add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +810,10 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  llong) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ullong) { return AVX::sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,6 +822,25 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) {
+    // there is no 8-bit multiplication: multiply the even and odd bytes as 16-bit
+    // integers and merge the low bytes of the products
+    using namespace AVX;
+    const __m256i even = mullo_epi16(a, b);
+    const __m256i odd = mullo_epi16(srli_epi16<8>(a), srli_epi16<8>(b));
+    return or_(and_(even, srli_epi16<8>(allone<__m256i>())), slli_epi16<8>(odd));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return mul(a, b, schar()); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  llong) {
+    // there is no 64-bit multiplication: assemble the product from 32x32->64-bit
+    // multiplications, the high*high term only affects bits beyond 64
+    using namespace AVX;
+    const __m256i lolo = mul_epu32(a, b);
+    const __m256i lohi = mul_epu32(a, srli_epi64<32>(b));
+    const __m256i hilo = mul_epu32(srli_epi64<32>(a), b);
+    return add_epi64(lolo, slli_epi64<32>(add_epi64(lohi, hilo)));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ullong) { return mul(a, b, llong()); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
@@ -756,6 +882,34 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  schar) {
+    using namespace AVX;
+    const __m256i lo = and_(div(cvtepi8_epi16(lo128(a)), cvtepi8_epi16(lo128(b)), short()),
+                            _mm256_set1_epi16(0x00ff));
+    const __m256i hi = and_(div(cvtepi8_epi16(hi128(a)), cvtepi8_epi16(hi128(b)), short()),
+                            _mm256_set1_epi16(0x00ff));
+    return concat(_mm_packus_epi16(lo128(lo), hi128(lo)),
+                  _mm_packus_epi16(lo128(hi), hi128(hi)));
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  uchar) {
+    using namespace AVX;
+    // the quotients of zero-extended bytes fit into 8 bits, no masking required
+    const __m256i lo = div(cvtepu8_epi16(lo128(a)), cvtepu8_epi16(lo128(b)), short());
+    const __m256i hi = div(cvtepu8_epi16(hi128(a)), cvtepu8_epi16(hi128(b)), short());
+    return concat(_mm_packus_epi16(lo128(lo), hi128(lo)),
+                  _mm_packus_epi16(lo128(hi), hi128(hi)));
+}
+
+// there is no 64-bit integer division and double cannot represent all 64-bit integers
+template <typename T> Vc_INTRINSIC __m256i div64(__m256i a, __m256i b)
+{
+    alignas(32) T x[4], y[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(x), a);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(y), b);
+    return _mm256_setr_epi64x(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  llong) { return div64< llong>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b, ullong) { return div64<ullong>(a, b); }
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -787,6 +941,10 @@ Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,    int) { return AvxIntrinsics:
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   uint) { return AvxIntrinsics::cmpeq_epi32(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  short) { return AvxIntrinsics::cmpeq_epi16(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ushort) { return AvxIntrinsics::cmpeq_epi16(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  schar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  uchar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  llong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ullong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
 
 // cmpneq{{{1
 Vc_INTRINSIC __m256  cmpneq(__m256  a, __m256  b,  float) { return AvxIntrinsics::cmpneq_ps(a, b); }
@@ -797,6 +955,8 @@ Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  short) { return not_(AvxIntri
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ushort) { return not_(AvxIntrinsics::cmpeq_epi16(a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  schar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  uchar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  llong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ullong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
 
 // cmpgt{{{1
 Vc_INTRINSIC __m256  cmpgt(__m256  a, __m256  b,  float) { return AVX::cmpgt_ps(a, b); }
@@ -807,6 +967,8 @@ Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(a, b); }
 
 // cmpge{{{1
 Vc_INTRINSIC __m256  cmpge(__m256  a, __m256  b,  float) { return AVX::cmpge_ps(a, b); }
@@ -817,6 +979,8 @@ Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(b, a)); }
 
 // cmple{{{1
 Vc_INTRINSIC __m256  cmple(__m256  a, __m256  b,  float) { return AVX::cmple_ps(a, b); }
@@ -827,6 +991,8 @@ Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(a, b)); }
 
 // cmplt{{{1
 Vc_INTRINSIC __m256  cmplt(__m256  a, __m256  b,  float) { return AVX::cmplt_ps(a, b); }
@@ -837,6 +1003,8 @@ Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(b, a); }
 
 // fma{{{1
 Vc_INTRINSIC __m256 fma(__m256  a, __m256  b, __m256  c,  float) {
@@ -890,30 +1058,82 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+// there are no 8-bit shifts: shift 16-bit integers and fix up the bits that crossed
+// into the neighboring byte
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar)
+{
+    return AVX::packs_epi16(AVX::srai_epi16<8 + shift>(AVX::unpacklo_epi8(a, a)),
+                            AVX::srai_epi16<8 + shift>(AVX::unpackhi_epi8(a, a)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar)
+{
+    return and_(AVX::srli_epi16<shift>(a), _mm256_set1_epi8(char(0xffu >> shift)));
+}
+// there is no 64-bit arithmetic shift: shift in copies of the sign bit from the high
+// 32-bit halves
+Vc_INTRINSIC __m256i sign_epi64(__m256i a)
+{
+    return AVX::srai_epi32<31>(_mm256_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  llong)
+{
+    return or_(AVX::srli_epi64<shift>(a), AVX::slli_epi64<64 - shift>(sign_epi64(a)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ullong) { return AVX::srli_epi64<shift>(a); }
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar)
+{
+    const __m128i count = _mm_cvtsi32_si128(8 + shift);
+    return AVX::packs_epi16(AVX::sra_epi16(AVX::unpacklo_epi8(a, a), count),
+                            AVX::sra_epi16(AVX::unpackhi_epi8(a, a), count));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar)
+{
+    return and_(AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(char(0xffu >> shift)));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  llong)
+{
+    return or_(AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)),
+               AVX::sll_epi64(sign_epi64(a), _mm_cvtsi32_si128(64 - shift)));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ullong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar)
+{
+    return and_(AVX::slli_epi16<shift>(a), _mm256_set1_epi8(char(0xffu << shift)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar)
+{
+    return shiftLeft<shift>(a, uchar());
+}
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  llong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ullong) { return AVX::slli_epi64<shift>(a); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar)
+{
+    return and_(AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(char(0xffu << shift)));
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar)
+{
+    return shiftLeft(a, shift, uchar());
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  llong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ullong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,15 +1153,143 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast( llong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(ullong x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
+// implemented in src/avx_sorthelper.cpp; the intrinsic types keep the Vc_IMPL_ABI_TAG of
+// Vector out of the signature, thus all AVX and AVX2 translation units link to it
 template <Vc::Implementation Impl, typename T,
           typename = enable_if<(Impl >= AVXImpl && Impl <= AVX2Impl)>>
-Vc_CONST_L AVX2::Vector<T> Vc_VDECL sorted(AVX2::Vector<T> x) Vc_CONST_R;
+Vc_CONST_L typename AVX::VectorTypeHelper<T>::Type Vc_VDECL
+    sorted(typename AVX::VectorTypeHelper<T>::Type x) Vc_CONST_R;
 template <typename T> Vc_INTRINSIC Vc_CONST AVX2::Vector<T> sorted(AVX2::Vector<T> x)
 {
-    return sorted<CurrentImplementation::current()>(x);
+    // the AVX2 sorting networks are used for AVX512
+    return AVX2::Vector<T>(
+        sorted<CurrentImplementation::is(AVX512Impl) ? AVX2Impl
+                                                     : CurrentImplementation::current(),
+               T>(x.data()));
+}
+
+// compress{{{1
+#ifdef Vc_IMPL_AVX2
+// vpermd indexes moving the selected 32-bit / 64-bit entries to the front, followed by the
+// remaining entries, see Common::CompressIndexes
+Vc_INTRINSIC __m256i compress_permutation(unsigned int k,
+                                          std::integral_constant<std::size_t, 4>)
+{
+    return _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_set1_epi32(Common::CompressIndexes[k]),
+                          _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+        _mm256_set1_epi32(0xf));
+}
+Vc_INTRINSIC __m256i compress_permutation(unsigned int k,
+                                          std::integral_constant<std::size_t, 8>)
+{
+    const __m256i idx = _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_set1_epi32(Common::CompressIndexes[k]),
+                          _mm256_setr_epi32(0, 0, 4, 4, 8, 8, 12, 12)),
+        _mm256_set1_epi32(0xf));
+    return _mm256_add_epi32(_mm256_add_epi32(idx, idx),
+                            _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+}
+#ifdef Vc_IMPL_AVX512
+// vcompressps / vpcompressd / vcompresspd / vpcompressq
+Vc_INTRINSIC __m256 compress(__m256 v, __mmask8 k, std::integral_constant<std::size_t, 4>)
+{
+    return _mm256_maskz_compress_ps(k, v);
+}
+Vc_INTRINSIC __m256d compress(__m256d v, __mmask8 k, std::integral_constant<std::size_t, 8>)
+{
+    return _mm256_maskz_compress_pd(k, v);
+}
+Vc_INTRINSIC __m256i compress(__m256i v, __mmask8 k, std::integral_constant<std::size_t, 4>)
+{
+    return _mm256_maskz_compress_epi32(k, v);
+}
+Vc_INTRINSIC __m256i compress(__m256i v, __mmask8 k, std::integral_constant<std::size_t, 8>)
+{
+    return _mm256_maskz_compress_epi64(k, v);
+}
+Vc_INTRINSIC void compress_store(float *mem, __m256 v, __mmask8 k)
+{
+    _mm256_mask_compressstoreu_ps(mem, k, v);
+}
+Vc_INTRINSIC void compress_store(double *mem, __m256d v, __mmask8 k)
+{
+    _mm256_mask_compressstoreu_pd(mem, k, v);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+compress_store(T *mem, __m256i v, __mmask8 k)
+{
+    _mm256_mask_compressstoreu_epi32(mem, k, v);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 8 && std::is_integral<T>::value), void>
+compress_store(T *mem, __m256i v, __mmask8 k)
+{
+    _mm256_mask_compressstoreu_epi64(mem, k, v);
+}
+
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), AVX2::Vector<T>> compress(AVX2::Vector<T> v,
+                                                                   const AVX2::Mask<T> &k)
+{
+    return compress(v.data(), __mmask8(k.toInt()),
+                    std::integral_constant<std::size_t, sizeof(T)>());
+}
+// writes only the k.count() selected entries, see Vc::compress_store
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), std::size_t> compress_store_impl(
+    AVX2::Vector<T> v, const AVX2::Mask<T> &k, T *mem)
+{
+    compress_store(mem, v.data(), __mmask8(k.toInt()));
+    return k.count();
+}
+
+// vexpandps / vpexpandd / vexpandpd / vpexpandq
+Vc_INTRINSIC __m256 expand_load(__m256 v, __mmask8 k, const float *mem)
+{
+    return _mm256_mask_expandloadu_ps(v, k, mem);
+}
+Vc_INTRINSIC __m256d expand_load(__m256d v, __mmask8 k, const double *mem)
+{
+    return _mm256_mask_expandloadu_pd(v, k, mem);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), __m256i>
+expand_load(__m256i v, __mmask8 k, const T *mem)
+{
+    return _mm256_mask_expandloadu_epi32(v, k, mem);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 8 && std::is_integral<T>::value), __m256i>
+expand_load(__m256i v, __mmask8 k, const T *mem)
+{
+    return _mm256_mask_expandloadu_epi64(v, k, mem);
 }
+// see Vc::expand_load
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), std::size_t> expand_load_impl(
+    AVX2::Vector<T> &v, const AVX2::Mask<T> &k, const T *mem)
+{
+    v = expand_load(v.data(), __mmask8(k.toInt()), mem);
+    return k.count();
+}
+#else   // Vc_IMPL_AVX512
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), AVX2::Vector<T>> compress(AVX2::Vector<T> v,
+                                                                   const AVX2::Mask<T> &k)
+{
+    using VectorType = typename AVX2::Vector<T>::VectorType;
+    return AVX::avx_cast<VectorType>(_mm256_permutevar8x32_ps(
+        AVX::avx_cast<__m256>(v.data()),
+        compress_permutation(k.toInt(), std::integral_constant<std::size_t, sizeof(T)>())));
+}
+#endif  // Vc_IMPL_AVX512
+#endif  // Vc_IMPL_AVX2
 
 // shifted{{{1
 template <typename T, typename V>
@@ -1169,6 +1517,15 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 16), V> rotated(
     }
     return avx_cast<V>(_mm256_setzero_ps());
 }
+
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 32), V> rotated(
+    V v, int amount)
+{
+    // combine the two byte shifts instead of spelling out 32 alignr cases
+    const int shift = static_cast<unsigned int>(amount) % N;
+    return or_(shifted<T>(v, shift), shifted<T>(v, shift - int(N)));
+}
 #endif  // Vc_IMPL_AVX2
 
 // testc{{{1
@@ -1314,12 +1671,14 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<8>(__m256i k)
 {
     return movemask(AVX::avx_cast<__m256>(k));
 }
-#ifdef Vc_IMPL_BMI2
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
 {
+#ifdef Vc_IMPL_BMI2
     return _pext_u32(movemask(k), 0x55555555u);
-}
+#else
+    return _mm_movemask_epi8(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
 #endif
+}
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
 {
     return movemask(k);
@@ -133,6 +133,7 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m128i Vc_CONST _mm_setmin_epi32() { return _mm_castps_si128(_mm_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi16() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(c_general::minShort))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi32() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
+    static Vc_INTRINSIC m256i Vc_CONST setmin_epi64() { return _mm256_castpd_si256(_mm256_broadcast_sd(reinterpret_cast<const double *>(&c_general::signMaskFloat[0]))); }
 
     template <int i>
     static Vc_INTRINSIC Vc_CONST unsigned int extract_epu32(__m128i x)
@@ -336,14 +337,21 @@ namespace AvxIntrinsics
     Vc_AVX_TO_SSE_2_NEW(cmpgt_epi16)
     Vc_AVX_TO_SSE_2_NEW(cmpgt_epi32)
     Vc_AVX_TO_SSE_2_NEW(cmpgt_epi64)
+    Vc_AVX_TO_SSE_2_NEW(unpackhi_epi8)
+    Vc_AVX_TO_SSE_2_NEW(unpacklo_epi8)
     Vc_AVX_TO_SSE_2_NEW(unpackhi_epi16)
     Vc_AVX_TO_SSE_2_NEW(unpacklo_epi16)
+    Vc_AVX_TO_SSE_2_NEW(packs_epi16)
+    Vc_AVX_TO_SSE_2_NEW(add_epi8)
     Vc_AVX_TO_SSE_2_NEW(add_epi16)
     Vc_AVX_TO_SSE_2_NEW(add_epi32)
     Vc_AVX_TO_SSE_2_NEW(add_epi64)
+    Vc_AVX_TO_SSE_2_NEW(sub_epi8)
     Vc_AVX_TO_SSE_2_NEW(sub_epi16)
     Vc_AVX_TO_SSE_2_NEW(sub_epi32)
+    Vc_AVX_TO_SSE_2_NEW(sub_epi64)
     Vc_AVX_TO_SSE_2_NEW(mullo_epi16)
+    Vc_AVX_TO_SSE_2_NEW(sign_epi8)
     Vc_AVX_TO_SSE_2_NEW(sign_epi16)
     Vc_AVX_TO_SSE_2_NEW(sign_epi32)
     Vc_AVX_TO_SSE_2_NEW(min_epi8)
@@ -355,6 +363,7 @@ namespace AvxIntrinsics
     Vc_AVX_TO_SSE_2_NEW(min_epu32)
     Vc_AVX_TO_SSE_2_NEW(max_epu32)
     Vc_AVX_TO_SSE_2_NEW(mullo_epi32)
+    Vc_AVX_TO_SSE_2_NEW(mul_epu32)
 
     Vc_AVX_TO_SSE_1(abs_epi8)
     Vc_AVX_TO_SSE_1(abs_epi16)
@@ -485,7 +494,32 @@ static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
         return cmpgt_epi16(a, b);
     }
 #endif
+static Vc_INTRINSIC m256i cmpgt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
 
+#ifdef Vc_IMPL_AVX512
+// AVX-512VL/BW write masking: the vector mask is moved into an opmask register and the
+// store suppresses the disabled lanes without the vmaskmov / maskmovdqu penalties
+static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
+    _mm256_mask_storeu_ps(mem, _mm256_movepi32_mask(_mm256_castps_si256(mask)), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(double *mem, const __m256d mask, const __m256d v) {
+    _mm256_mask_storeu_pd(mem, _mm256_movepi64_mask(_mm256_castpd_si256(mask)), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(int *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi32(mem, _mm256_movepi32_mask(mask), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(long long *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi64(mem, _mm256_movepi64_mask(mask), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi16(mem, _mm256_movepi16_mask(mask), v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(signed char *mem, const __m256i mask, const __m256i v) {
+    _mm256_mask_storeu_epi8(mem, _mm256_movepi8_mask(mask), v);
+}
+#else   // Vc_IMPL_AVX512
 static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
     _mm256_maskstore_ps(mem, _mm256_castps_si256(mask), v);
 }
@@ -499,17 +533,36 @@ static Vc_INTRINSIC void _mm256_maskstore(int *mem, const __m256i mask, const __
     _mm256_maskstore_ps(reinterpret_cast<float *>(mem), mask, _mm256_castsi256_ps(v));
 #endif
 }
-static Vc_INTRINSIC void _mm256_maskstore(unsigned int *mem, const __m256i mask, const __m256i v) {
-    _mm256_maskstore(reinterpret_cast<int *>(mem), mask, v);
+static Vc_INTRINSIC void _mm256_maskstore(long long *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX2
+    _mm256_maskstore_epi64(mem, mask, v);
+#else
+    _mm256_maskstore_pd(reinterpret_cast<double *>(mem), mask, _mm256_castsi256_pd(v));
+#endif
 }
 static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const __m256i v) {
     using namespace AVX;
     _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
     _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[8]));
 }
+static Vc_INTRINSIC void _mm256_maskstore(signed char *mem, const __m256i mask, const __m256i v) {
+    using namespace AVX;
+    _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
+    _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[16]));
+}
+#endif  // Vc_IMPL_AVX512
+static Vc_INTRINSIC void _mm256_maskstore(unsigned int *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<int *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned long long *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<long long *>(mem), mask, v);
+}
 static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
 }
+static Vc_INTRINSIC void _mm256_maskstore(unsigned char *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<signed char *>(mem), mask, v);
+}
 
 #undef Vc_AVX_TO_SSE_1
 #undef Vc_AVX_TO_SSE_1_128
@@ -620,8 +673,83 @@ __m256i gather(__m256i src, __m256i k, const unsigned *addr, __m256i idx)
 {
     return _mm256_mask_i32gather_epi32(src, aliasing_cast<int>(addr), idx, k, Scale);
 }
+template <int Scale> __m256i gather(const long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(addr, idx, Scale);
+}
+template <int Scale> __m256i gather(const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, addr, idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+
+// 64-bit indexes
+template <int Scale> __m256d gather(const double *addr, __m256i idx)
+{
+    return _mm256_i64gather_pd(addr, idx, Scale);
+}
+template <int Scale> __m256i gather(const long long *addr, __m256i idx)
+{
+    return _mm256_i64gather_epi64(addr, idx, Scale);
+}
+template <int Scale> __m256i gather(const unsigned long long *addr, __m256i idx)
+{
+    return _mm256_i64gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale>
+__m256d gather(__m256d src, __m256d k, const double *addr, __m256i idx)
+{
+    return _mm256_mask_i64gather_pd(src, addr, idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const long long *addr, __m256i idx)
+{
+    return _mm256_mask_i64gather_epi64(src, addr, idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const unsigned long long *addr, __m256i idx)
+{
+    return _mm256_mask_i64gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
 #endif
 
+#ifdef Vc_IMPL_AVX512
+// vscatterdps / vscatterdpd / vpscatterdd / vpscatterdq
+template <int Scale> void scatter(float *addr, __m256i idx, __m256 v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_ps(addr, k, idx, v, Scale);
+}
+template <int Scale> void scatter(double *addr, __m128i idx, __m256d v, __mmask8 k)
+{
+    _mm256_mask_i32scatter_pd(addr, k, idx, v, Scale);
+}
+template <int Scale, class T>
+enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void> scatter(T *addr,
+                                                                       __m256i idx,
+                                                                       __m256i v,
+                                                                       __mmask8 k)
+{
+    _mm256_mask_i32scatter_epi32(addr, k, idx, v, Scale);
+}
+template <int Scale, class T>
+enable_if<(sizeof(T) == 8 && std::is_integral<T>::value), void> scatter(T *addr,
+                                                                       __m128i idx,
+                                                                       __m256i v,
+                                                                       __mmask8 k)
+{
+    _mm256_mask_i32scatter_epi64(addr, k, idx, v, Scale);
+}
+#endif  // Vc_IMPL_AVX512
+
 }  // namespace AvxIntrinsics
 }  // namespace Vc
 
@@ -137,6 +137,19 @@ Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 16 + 32>)
                              gen(12) ? 0xfffful : 0, gen(13) ? 0xfffful : 0,
                              gen(14) ? 0xfffful : 0, gen(15) ? 0xfffful : 0);
 }
+template <typename M, typename G>
+Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 32 + 32>)
+{
+    return _mm256_setr_epi8(
+        gen(0) ? -1 : 0, gen(1) ? -1 : 0, gen(2) ? -1 : 0, gen(3) ? -1 : 0,
+        gen(4) ? -1 : 0, gen(5) ? -1 : 0, gen(6) ? -1 : 0, gen(7) ? -1 : 0,
+        gen(8) ? -1 : 0, gen(9) ? -1 : 0, gen(10) ? -1 : 0, gen(11) ? -1 : 0,
+        gen(12) ? -1 : 0, gen(13) ? -1 : 0, gen(14) ? -1 : 0, gen(15) ? -1 : 0,
+        gen(16) ? -1 : 0, gen(17) ? -1 : 0, gen(18) ? -1 : 0, gen(19) ? -1 : 0,
+        gen(20) ? -1 : 0, gen(21) ? -1 : 0, gen(22) ? -1 : 0, gen(23) ? -1 : 0,
+        gen(24) ? -1 : 0, gen(25) ? -1 : 0, gen(26) ? -1 : 0, gen(27) ? -1 : 0,
+        gen(28) ? -1 : 0, gen(29) ? -1 : 0, gen(30) ? -1 : 0, gen(31) ? -1 : 0);
+}
 template <typename T>
 template <typename G>
 Vc_INTRINSIC AVX2::Mask<T> Mask<T, VectorAbi::Avx>::generate(G &&gen)
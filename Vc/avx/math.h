@@ -40,16 +40,36 @@ Vc_ALWAYS_INLINE AVX2::int_v    min(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   min(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_min_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  min(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_min_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v min(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_min_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  min(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return _mm256_blendv_epi8(x.data(), y.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v min(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return _mm256_blendv_epi8(x.data(), y.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
 Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v    &y) { return _mm256_max_epi32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  max(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return _mm256_blendv_epi8(y.data(), x.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v max(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return _mm256_blendv_epi8(y.data(), x.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::float_v  max(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_max_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v max(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_max_pd(x.data(), y.data()); }
 
+// add_sat & sub_sat {{{1
+#ifdef Vc_IMPL_AVX2
+Vc_ALWAYS_INLINE AVX2:: schar_v add_sat(const AVX2:: schar_v &x, const AVX2:: schar_v &y) { return _mm256_adds_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: uchar_v add_sat(const AVX2:: uchar_v &x, const AVX2:: uchar_v &y) { return _mm256_adds_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: short_v add_sat(const AVX2:: short_v &x, const AVX2:: short_v &y) { return _mm256_adds_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v add_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_adds_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: schar_v sub_sat(const AVX2:: schar_v &x, const AVX2:: schar_v &y) { return _mm256_subs_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: uchar_v sub_sat(const AVX2:: uchar_v &x, const AVX2:: uchar_v &y) { return _mm256_subs_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: short_v sub_sat(const AVX2:: short_v &x, const AVX2:: short_v &y) { return _mm256_subs_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v sub_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_subs_epu16(x.data(), y.data()); }
+#endif
+
 // sqrt {{{1
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE AVX2::Vector<T> sqrt(const AVX2::Vector<T> &x)
@@ -96,6 +116,10 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::llong_v abs(AVX2::llong_v x)
+{
+    return Detail::abs(x.data(), llong());
+}
 #endif
 
 // isfinite {{{1
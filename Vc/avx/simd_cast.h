@@ -195,6 +195,59 @@ Vc_SIMD_CAST_AVX_2(   int_v, ushort_v);
 Vc_SIMD_CAST_AVX_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_AVX_3(double_v, ushort_v);
 Vc_SIMD_CAST_AVX_4(double_v, ushort_v);
+
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v);
+
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_AVX_2( short_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_AVX_4(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v,  schar_v);
+
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2( short_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v,  uchar_v);
+Vc_SIMD_CAST_AVX_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v,  uchar_v);
+
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v);
+
+Vc_SIMD_CAST_AVX_1( llong_v, double_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v);
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v);
+Vc_SIMD_CAST_AVX_2( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_2(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_2( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_2(ullong_v,   uint_v);
 #endif
 
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
@@ -204,6 +257,8 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::double_v);
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::double_v);
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::double_v);
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::double_v);
 
 Vc_SIMD_CAST_1(SSE::double_v, AVX2:: float_v);
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2:: float_v);
@@ -242,10 +297,47 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::   int_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::   int_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::  uint_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::  uint_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: short_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: short_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::ushort_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: schar_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: schar_v);
+Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: schar_v);
+Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: schar_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: schar_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: schar_v);
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: uchar_v);
+
+Vc_SIMD_CAST_1(SSE::double_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2:: llong_v);
+
+Vc_SIMD_CAST_1(SSE::double_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::ullong_v);
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_2(SSE::double_v, AVX2::double_v);
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2::double_v);
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2::double_v);
 
 Vc_SIMD_CAST_2(SSE::double_v, AVX2:: float_v);
 Vc_SIMD_CAST_2(SSE:: float_v, AVX2:: float_v);
@@ -278,6 +370,27 @@ Vc_SIMD_CAST_2(SSE::   int_v, AVX2::ushort_v);
 Vc_SIMD_CAST_2(SSE::  uint_v, AVX2::ushort_v);
 Vc_SIMD_CAST_2(SSE:: short_v, AVX2::ushort_v);
 Vc_SIMD_CAST_2(SSE::ushort_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_2(SSE::   int_v, AVX2:: schar_v);
+Vc_SIMD_CAST_2(SSE::  uint_v, AVX2:: schar_v);
+Vc_SIMD_CAST_2(SSE:: short_v, AVX2:: schar_v);
+Vc_SIMD_CAST_2(SSE::ushort_v, AVX2:: schar_v);
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2:: schar_v);
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2:: schar_v);
+
+Vc_SIMD_CAST_2(SSE::   int_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_2(SSE::  uint_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_2(SSE:: short_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_2(SSE::ushort_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2:: uchar_v);
+
+Vc_SIMD_CAST_2(SSE::double_v, AVX2:: llong_v);
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2:: llong_v);
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2:: llong_v);
+Vc_SIMD_CAST_2(SSE::double_v, AVX2::ullong_v);
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2::ullong_v);
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2::ullong_v);
 #endif
 
 // 3 SSE::Vector to 1 AVX2::Vector {{{2
@@ -316,6 +429,16 @@ Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: short_v);
 
 Vc_SIMD_CAST_4(SSE::   int_v, AVX2::ushort_v);
 Vc_SIMD_CAST_4(SSE::  uint_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_4(SSE::   int_v, AVX2:: schar_v);
+Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: schar_v);
+Vc_SIMD_CAST_4(SSE:: short_v, AVX2:: schar_v);
+Vc_SIMD_CAST_4(SSE::ushort_v, AVX2:: schar_v);
+
+Vc_SIMD_CAST_4(SSE::   int_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_4(SSE:: short_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_4(SSE::ushort_v, AVX2:: uchar_v);
 #endif
 
 // 5 SSE::Vector to 1 AVX2::Vector {{{2
@@ -340,6 +463,11 @@ Vc_SIMD_CAST_7(SSE::double_v, AVX2::ushort_v);
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_8(SSE::double_v, AVX2:: short_v);
 Vc_SIMD_CAST_8(SSE::double_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_8(SSE::   int_v, AVX2:: schar_v);
+Vc_SIMD_CAST_8(SSE::  uint_v, AVX2:: schar_v);
+Vc_SIMD_CAST_8(SSE::   int_v, AVX2:: uchar_v);
+Vc_SIMD_CAST_8(SSE::  uint_v, AVX2:: uchar_v);
 #endif
 
 // 1 AVX2::Vector to 1 SSE::Vector {{{2
@@ -349,6 +477,8 @@ Vc_SIMD_CAST_1(AVX2::double_v, SSE::   int_v);
 Vc_SIMD_CAST_1(AVX2::double_v, SSE::  uint_v);
 Vc_SIMD_CAST_1(AVX2::double_v, SSE:: short_v);
 Vc_SIMD_CAST_1(AVX2::double_v, SSE::ushort_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE::ullong_v);
 
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE::double_v);
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: float_v);
@@ -385,11 +515,57 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::ushort_v);
+
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: uchar_v);
+
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: short_v);
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::ushort_v);
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: uchar_v);
+
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: short_v);
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::ushort_v);
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: uchar_v);
+
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE::ullong_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE::ullong_v);
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::double_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::ullong_v);
+
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::double_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE:: llong_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::ullong_v);
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(AVX2::double_v, SSE:: short_v);
 Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v);
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: uchar_v);
+#endif
 
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
@@ -417,6 +593,14 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value> = nullarg);
 #endif
 
 // 2 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -445,6 +629,14 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value> = nullarg);
 #endif
 
 // 3 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -473,6 +665,14 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value> = nullarg);
 #endif
 
 // 4 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -507,6 +707,14 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           Scalar::Vector<T> x3,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2, Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2, Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value> = nullarg);
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1046,6 +1254,12 @@ simd_cast(AVX2::Vector<T> x);
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1);
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1);
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_OFFSET(SSE:: schar_v, AVX2::   int_v, 1);
+Vc_SIMD_CAST_OFFSET(SSE:: uchar_v, AVX2::   int_v, 1);
+Vc_SIMD_CAST_OFFSET(SSE:: schar_v, AVX2::  uint_v, 1);
+Vc_SIMD_CAST_OFFSET(SSE:: uchar_v, AVX2::  uint_v, 1);
+#endif
 
 // Declarations: Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -1404,6 +1618,76 @@ Vc_SIMD_CAST_AVX_4(double_v, ushort_v) {
 }
 #endif
 
+#ifdef Vc_IMPL_AVX2
+// from schar_v/uchar_v {{{3
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v) { return _mm256_cvtepi8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v) { return _mm256_cvtepu8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v) { return _mm256_cvtepi8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v) { return _mm256_cvtepu8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v) { return _mm256_cvtepi8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v) { return _mm256_cvtepu8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v) { return _mm256_cvtepi8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v) { return _mm256_cvtepu8_epi16(AVX::lo128(x.data())); }
+
+// to schar_v/uchar_v {{{3
+namespace AVX
+{
+// truncates the 16-bit entries of a and b to their low bytes and returns them in the order
+// of a followed by b
+Vc_INTRINSIC __m256i convert_int16_to_int8(__m256i a, __m256i b)
+{
+    const __m256i lo = _mm256_srli_epi16(setallone_si256(), 8);
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(_mm256_and_si256(a, lo), _mm256_and_si256(b, lo)));
+}
+}  // namespace AVX
+
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v) { return AVX::convert_int16_to_int8(x.data(), _mm256_setzero_si256()); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v) { return AVX::convert_int16_to_int8(x.data(), _mm256_setzero_si256()); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2( short_v,  schar_v) { return AVX::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_AVX_2(ushort_v,  schar_v) { return AVX::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_AVX_4(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v) { return AVX::convert_int16_to_int8(x.data(), _mm256_setzero_si256()); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v) { return AVX::convert_int16_to_int8(x.data(), _mm256_setzero_si256()); }
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2(   int_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(  uint_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2( short_v,  uchar_v) { return AVX::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_AVX_2(ushort_v,  uchar_v) { return AVX::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_AVX_4(   int_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(  uint_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+
+// from/to llong_v/ullong_v {{{3
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v) { return AVX::convert<   int,  llong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v) { return AVX::convert<  uint,  llong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v) { return AVX::convert<double,  llong>(x.data()); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v) { return AVX::convert<   int, ullong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v) { return AVX::convert<  uint, ullong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v) { return AVX::convert<double, ullong>(x.data()); }
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v) { return x.data(); }
+
+Vc_SIMD_CAST_AVX_1( llong_v, double_v) { return AVX::convert< llong, double>(x.data()); }
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v) { return AVX::convert<ullong, double>(x.data()); }
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v) { return AVX::zeroExtend(AVX::convert< llong,  int>(x.data())); }
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v) { return AVX::zeroExtend(AVX::convert<ullong,  int>(x.data())); }
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v) { return AVX::zeroExtend(AVX::convert< llong, uint>(x.data())); }
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v) { return AVX::zeroExtend(AVX::convert<ullong, uint>(x.data())); }
+Vc_SIMD_CAST_AVX_2( llong_v,    int_v) { return AVX::concat(AVX::convert< llong,  int>(x0.data()), AVX::convert< llong,  int>(x1.data())); }
+Vc_SIMD_CAST_AVX_2(ullong_v,    int_v) { return AVX::concat(AVX::convert<ullong,  int>(x0.data()), AVX::convert<ullong,  int>(x1.data())); }
+Vc_SIMD_CAST_AVX_2( llong_v,   uint_v) { return AVX::concat(AVX::convert< llong, uint>(x0.data()), AVX::convert< llong, uint>(x1.data())); }
+Vc_SIMD_CAST_AVX_2(ullong_v,   uint_v) { return AVX::concat(AVX::convert<ullong, uint>(x0.data()), AVX::convert<ullong, uint>(x1.data())); }
+#endif
+
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::double_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2::double_v) { return _mm256_cvtps_pd(x.data()); }
@@ -1411,6 +1695,8 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::double_v) { return _mm256_cvtepi32_pd(x.data
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::double_v) { using namespace AvxIntrinsics; return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(x.data(), _mm_setmin_epi32())), set1_pd(1u << 31)); }
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::double_v) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::double_v) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v>(x)); }
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::double_v) { return AVX::zeroExtend(SSE::convert< llong, double>(x.data())); }
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::double_v) { return AVX::zeroExtend(SSE::convert<ullong, double>(x.data())); }
 
 Vc_SIMD_CAST_1(SSE::double_v, AVX2:: float_v) { return AVX::zeroExtend(simd_cast<SSE:: float_v>(x).data()); }
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2:: float_v) { return AVX::zeroExtend(x.data()); }
@@ -1449,10 +1735,68 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast<SSE::ushort_v>(x).data()); }
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::   int_v) { return _mm256_cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::   int_v) { return _mm256_cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::  uint_v) { return _mm256_cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::  uint_v) { return _mm256_cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: short_v) { return _mm256_cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: short_v) { return _mm256_cvtepu8_epi16(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::ushort_v) { return _mm256_cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::ushort_v) { return _mm256_cvtepu8_epi16(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: schar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: schar_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE:: short_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE::ushort_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x).data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: uchar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: uchar_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::double_v, AVX2:: llong_v) { return AVX::zeroExtend(SSE::convert<double,  llong>(x.data())); }
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v) { return AVX::convert<   int,  llong>(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v) { return AVX::convert<  uint,  llong>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2:: llong_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2:: llong_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::double_v, AVX2::ullong_v) { return AVX::zeroExtend(SSE::convert<double, ullong>(x.data())); }
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v) { return AVX::convert<   int, ullong>(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v) { return AVX::convert<  uint, ullong>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: llong_v, AVX2::ullong_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_1(SSE::ullong_v, AVX2::ullong_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_2(SSE::   int_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_2(SSE::  uint_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_2(SSE:: short_v, AVX2:: schar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE::ushort_v, AVX2:: schar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2:: schar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2:: schar_v) { return AVX::concat(x0.data(), x1.data()); }
+
+Vc_SIMD_CAST_2(SSE::   int_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_2(SSE::  uint_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_2(SSE:: short_v, AVX2:: uchar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE::ushort_v, AVX2:: uchar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2:: uchar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2:: uchar_v) { return AVX::concat(x0.data(), x1.data()); }
+
+Vc_SIMD_CAST_2(SSE::double_v, AVX2:: llong_v) { return AVX::convert<double,  llong>(AVX::concat(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2:: llong_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2:: llong_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE::double_v, AVX2::ullong_v) { return AVX::convert<double, ullong>(AVX::concat(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2::ullong_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2::ullong_v) { return AVX::concat(x0.data(), x1.data()); }
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_2(SSE::double_v, AVX2::double_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(SSE:: llong_v, AVX2::double_v) { return AVX::concat(SSE::convert< llong, double>(x0.data()), SSE::convert< llong, double>(x1.data())); }
+Vc_SIMD_CAST_2(SSE::ullong_v, AVX2::double_v) { return AVX::concat(SSE::convert<ullong, double>(x0.data()), SSE::convert<ullong, double>(x1.data())); }
 
 Vc_SIMD_CAST_2(SSE::double_v, AVX2:: float_v) { return AVX::zeroExtend(simd_cast<SSE:: float_v>(x0, x1).data()); }
 Vc_SIMD_CAST_2(SSE:: float_v, AVX2:: float_v) { return AVX::concat(x0.data(), x1.data()); }
@@ -1522,6 +1866,16 @@ Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: short_v) { return simd_cast<AVX2:: short_v>
 
 Vc_SIMD_CAST_4(SSE::   int_v, AVX2::ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2:: int_v>(x0, x1), simd_cast<AVX2:: int_v>(x2, x3)); }
 Vc_SIMD_CAST_4(SSE::  uint_v, AVX2::ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::uint_v>(x0, x1), simd_cast<AVX2::uint_v>(x2, x3)); }
+
+Vc_SIMD_CAST_4(SSE::   int_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: schar_v) { return AVX::zeroExtend(simd_cast<SSE:: schar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_4(SSE:: short_v, AVX2:: schar_v) { return AVX::concat(SSE::convert_int16_to_int8(x0.data(), x1.data()), SSE::convert_int16_to_int8(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(SSE::ushort_v, AVX2:: schar_v) { return AVX::concat(SSE::convert_int16_to_int8(x0.data(), x1.data()), SSE::convert_int16_to_int8(x2.data(), x3.data())); }
+
+Vc_SIMD_CAST_4(SSE::   int_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_4(SSE::  uint_v, AVX2:: uchar_v) { return AVX::zeroExtend(simd_cast<SSE:: uchar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_4(SSE:: short_v, AVX2:: uchar_v) { return AVX::concat(SSE::convert_int16_to_int8(x0.data(), x1.data()), SSE::convert_int16_to_int8(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(SSE::ushort_v, AVX2:: uchar_v) { return AVX::concat(SSE::convert_int16_to_int8(x0.data(), x1.data()), SSE::convert_int16_to_int8(x2.data(), x3.data())); }
 #endif
 
 // 5 SSE::Vector to 1 AVX2::Vector {{{2
@@ -1546,6 +1900,11 @@ Vc_SIMD_CAST_7(SSE::double_v, AVX2::ushort_v) { return simd_cast<AVX2::ushort_v>
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_8(SSE::double_v, AVX2:: short_v) { return simd_cast<AVX2:: short_v>(simd_cast<AVX2::double_v>(x0, x1), simd_cast<AVX2::double_v>(x2, x3), simd_cast<AVX2::double_v>(x4, x5), simd_cast<AVX2::double_v>(x6, x7)); }
 Vc_SIMD_CAST_8(SSE::double_v, AVX2::ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::double_v>(x0, x1), simd_cast<AVX2::double_v>(x2, x3), simd_cast<AVX2::double_v>(x4, x5), simd_cast<AVX2::double_v>(x6, x7)); }
+
+Vc_SIMD_CAST_8(SSE::   int_v, AVX2:: schar_v) { return AVX::concat(simd_cast<SSE:: schar_v>(x0, x1, x2, x3).data(), simd_cast<SSE:: schar_v>(x4, x5, x6, x7).data()); }
+Vc_SIMD_CAST_8(SSE::  uint_v, AVX2:: schar_v) { return AVX::concat(simd_cast<SSE:: schar_v>(x0, x1, x2, x3).data(), simd_cast<SSE:: schar_v>(x4, x5, x6, x7).data()); }
+Vc_SIMD_CAST_8(SSE::   int_v, AVX2:: uchar_v) { return AVX::concat(simd_cast<SSE:: uchar_v>(x0, x1, x2, x3).data(), simd_cast<SSE:: uchar_v>(x4, x5, x6, x7).data()); }
+Vc_SIMD_CAST_8(SSE::  uint_v, AVX2:: uchar_v) { return AVX::concat(simd_cast<SSE:: uchar_v>(x0, x1, x2, x3).data(), simd_cast<SSE:: uchar_v>(x4, x5, x6, x7).data()); }
 #endif
 
 // 1 AVX2::Vector to 1 SSE::Vector {{{2
@@ -1563,6 +1922,8 @@ Vc_SIMD_CAST_1(AVX2::double_v, SSE::   int_v) { return AVX::convert<double, int>
 Vc_SIMD_CAST_1(AVX2::double_v, SSE::  uint_v) { return AVX::convert<double, unsigned int>(x.data()); }
 Vc_SIMD_CAST_1(AVX2::double_v, SSE:: short_v) { return AVX::convert<double, short>(x.data()); }
 Vc_SIMD_CAST_1(AVX2::double_v, SSE::ushort_v) { return AVX::convert<double, unsigned short>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: llong_v) { return SSE::convert<double,  llong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE::ullong_v) { return SSE::convert<double, ullong>(AVX::lo128(x.data())); }
 
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE::double_v) { return simd_cast<SSE::double_v>(simd_cast<SSE:: float_v>(x)); }
 Vc_SIMD_CAST_1(AVX2:: float_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE:: float_v>(x)); }
@@ -1594,6 +1955,46 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: float_v) { return simd_cast<SSE:: float_v>(
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(simd_cast<SSE::ushort_v>(x)); }
+
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: schar_v) { return SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: schar_v) { return SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: uchar_v) { return SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: uchar_v) { return SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data())); }
+
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE:: schar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(simd_cast<SSE:: schar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(simd_cast<SSE:: schar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE::ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE:: schar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: schar_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: schar_v, SSE:: uchar_v) { return AVX::lo128(x.data()); }
+
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE:: uchar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(simd_cast<SSE:: uchar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(simd_cast<SSE:: uchar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE::ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE:: uchar_v>(x)); }
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: schar_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: uchar_v, SSE:: uchar_v) { return AVX::lo128(x.data()); }
+
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: llong_v) { return SSE::convert<   int,  llong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: llong_v) { return SSE::convert<  uint,  llong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE::ullong_v) { return SSE::convert<   int, ullong>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE::ullong_v) { return SSE::convert<  uint, ullong>(AVX::lo128(x.data())); }
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::double_v) { return SSE::convert< llong, double>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v) { return AVX::convert< llong,    int>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v) { return AVX::convert< llong,   uint>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE:: llong_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::ullong_v) { return AVX::lo128(x.data()); }
+
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::double_v) { return SSE::convert<ullong, double>(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v) { return AVX::convert<ullong,    int>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v) { return AVX::convert<ullong,   uint>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE:: llong_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::ullong_v) { return AVX::lo128(x.data()); }
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
@@ -1607,6 +2008,12 @@ Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v) {
     const auto tmp1 = _mm256_cvttpd_epi32(x1.data());
     return _mm_packus_epi32(tmp0, tmp1);
 }
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+#endif
 
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
@@ -1652,6 +2059,20 @@ simd_cast(Scalar::Vector<T> x,
 {
     return _mm256_setr_epi16(x.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value>)
+{
+    return _mm256_setr_epi64x(llong(x.data()), 0, 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value>)
+{
+    return _mm256_setr_epi64x(ullong(x.data()), 0, 0, 0);
+}
 #endif
 
 // 2 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1698,6 +2119,20 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value>)
+{
+    return _mm256_setr_epi64x(llong(x0.data()), llong(x1.data()), 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value>)
+{
+    return _mm256_setr_epi64x(ullong(x0.data()), ullong(x1.data()), 0, 0);
+}
 #endif
 
 // 3 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1745,6 +2180,20 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), x2.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value>)
+{
+    return _mm256_setr_epi64x(llong(x0.data()), llong(x1.data()), llong(x2.data()), 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value>)
+{
+    return _mm256_setr_epi64x(ullong(x0.data()), ullong(x1.data()), ullong(x2.data()), 0);
+}
 #endif
 
 // 4 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -1798,6 +2247,20 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), x2.data(), x3.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2, Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, AVX2::llong_v>::value>)
+{
+    return _mm256_setr_epi64x(llong(x0.data()), llong(x1.data()), llong(x2.data()), llong(x3.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2, Scalar::Vector<T> x3,
+          enable_if<std::is_same<Return, AVX2::ullong_v>::value>)
+{
+    return _mm256_setr_epi64x(ullong(x0.data()), ullong(x1.data()), ullong(x2.data()), ullong(x3.data()));
+}
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -2618,6 +3081,12 @@ Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && SSE::is_vector<Return>::value &&
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_OFFSET(SSE:: schar_v, AVX2::   int_v, 1) { return _mm256_cvtepi8_epi32(_mm_srli_si128(x.data(), 8)); }
+Vc_SIMD_CAST_OFFSET(SSE:: uchar_v, AVX2::   int_v, 1) { return _mm256_cvtepu8_epi32(_mm_srli_si128(x.data(), 8)); }
+Vc_SIMD_CAST_OFFSET(SSE:: schar_v, AVX2::  uint_v, 1) { return _mm256_cvtepi8_epi32(_mm_srli_si128(x.data(), 8)); }
+Vc_SIMD_CAST_OFFSET(SSE:: uchar_v, AVX2::  uint_v, 1) { return _mm256_cvtepu8_epi32(_mm_srli_si128(x.data(), 8)); }
+#endif
 
 // Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
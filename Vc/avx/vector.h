@@ -59,6 +59,12 @@ template <typename T, typename Abi> struct VectorTraits
     using writemasked_vector_type = Common::WriteMaskedVector<vector_type, mask_type>;
     using intrinsic_type = typename AVX::VectorTypeHelper<T>::Type;
 };
+
+#if defined Vc_IMPL_AVX2 && !defined Vc_MSVC
+// defined in vector.tcc; calibrated with V, shared by all AVX2 gathers
+template <class V = Vector<float, VectorAbi::Avx>>
+inline Common::GatherScatterImplementation runtimeGatherImplementation();
+#endif
 }  // namespace Detail
 
 #define Vc_CURRENT_CLASS_NAME Vector
@@ -200,26 +206,76 @@ public:
         ////////////////////////////////////////////////////////////////////////////////
         // non-converting pd, ps, and epi32 gathers
         template <class U, class A, int Scale, int N = Vector<U, A>::size(),
-                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) >= 4)>>
+                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) >= 4 &&
+                                     !(sizeof(T) == 8 && sizeof(U) == 8))>>
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args)
         {
-            d.v() = AVX::gather<sizeof(T) * Scale>(
-                args.address,
-                simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(args.indexes)
-                    .data());
+            if (Vc_IS_LIKELY(Detail::runtimeGatherImplementation() ==
+                             Common::GatherScatterImplementation::Hardware)) {
+                d.v() = AVX::gather<sizeof(T) * Scale>(
+                    args.address,
+                    simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(
+                        args.indexes).data());
+            } else {
+                *this = generate([&](std::size_t i) {
+                    return args.address[Scale * args.indexes[i]];
+                });
+            }
         }
 
         // masked overload
         template <class U, class A, int Scale, int N = Vector<U, A>::size(),
-                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) >= 4)>>
+                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) >= 4 &&
+                                     !(sizeof(T) == 8 && sizeof(U) == 8))>>
+        Vc_INTRINSIC void gatherImplementation(
+            const Common::GatherArguments<T, Vector<U, A>, Scale> &args, MaskArgument k)
+        {
+            const auto impl = Detail::runtimeGatherImplementation();
+            if (Vc_IS_LIKELY(impl == Common::GatherScatterImplementation::Hardware)) {
+                d.v() = AVX::gather<sizeof(T) * Scale>(
+                    d.v(), k.data(), args.address,
+                    simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(
+                        args.indexes).data());
+            } else {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // non-converting pd and epi64 gathers with 64-bit indexes
+        template <class U, class A, int Scale,
+                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) == 8 &&
+                                     sizeof(U) == 8 && std::is_integral<U>::value)>>
+        Vc_INTRINSIC void gatherImplementation(
+            const Common::GatherArguments<T, Vector<U, A>, Scale> &args)
+        {
+            if (Vc_IS_LIKELY(Detail::runtimeGatherImplementation() ==
+                             Common::GatherScatterImplementation::Hardware)) {
+                d.v() = AVX::gather<sizeof(T) * Scale>(
+                    args.address, simd_cast<AVX2::llong_v>(args.indexes).data());
+            } else {
+                *this = generate([&](std::size_t i) {
+                    return args.address[Scale * args.indexes[i]];
+                });
+            }
+        }
+
+        // masked overload
+        template <class U, class A, int Scale,
+                  class = enable_if<(Vector<U, A>::size() >= size() && sizeof(T) == 8 &&
+                                     sizeof(U) == 8 && std::is_integral<U>::value)>>
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args, MaskArgument k)
         {
-            d.v() = AVX::gather<sizeof(T) * Scale>(
-                d.v(), k.data(), args.address,
-                simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(args.indexes)
-                    .data());
+            const auto impl = Detail::runtimeGatherImplementation();
+            if (Vc_IS_LIKELY(impl == Common::GatherScatterImplementation::Hardware)) {
+                d.v() = AVX::gather<sizeof(T) * Scale>(
+                    d.v(), k.data(), args.address,
+                    simd_cast<AVX2::llong_v>(args.indexes).data());
+            } else {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+            }
         }
 
         ////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +288,13 @@ public:
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<MT, Vector<U, A>, Scale> &args)
         {
+            if (Detail::runtimeGatherImplementation() !=
+                Common::GatherScatterImplementation::Hardware) {
+                *this = generate([&](std::size_t i) {
+                    return static_cast<T>(args.address[Scale * args.indexes[i]]);
+                });
+                return;
+            }
             using AVX2::int_v;
             const auto idx0 = simd_cast<int_v, 0>(args.indexes).data();
             const auto idx1 = simd_cast<int_v, 1>(args.indexes).data();
@@ -257,6 +320,11 @@ public:
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<MT, Vector<U, A>, Scale> &args, MaskArgument k)
         {
+            const auto impl = Detail::runtimeGatherImplementation();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+                return;
+            }
             using AVX2::int_v;
             const auto idx0 = simd_cast<int_v, 0>(args.indexes).data();
             const auto idx1 = simd_cast<int_v, 1>(args.indexes).data();
@@ -278,6 +346,53 @@ public:
             assign(v, k);
         }
 
+        ////////////////////////////////////////////////////////////////////////////////
+        // float16 and bfloat16 -> float gather emulation via epi32 gathers
+        template <class MT, class U, class A, int Scale>
+        Vc_INTRINSIC enable_if<(std::is_same<T, float>::value &&
+                                (std::is_same<MT, float16>::value ||
+                                 std::is_same<MT, bfloat16>::value) &&
+                                Vector<U, A>::size() >= size()),
+                               void>
+        gatherImplementation(const Common::GatherArguments<MT, Vector<U, A>, Scale> &args)
+        {
+            if (Detail::runtimeGatherImplementation() !=
+                Common::GatherScatterImplementation::Hardware) {
+                *this = generate([&](std::size_t i) {
+                    return static_cast<T>(args.address[Scale * args.indexes[i]]);
+                });
+                return;
+            }
+            d.v() = Detail::convert_gathered(
+                AVX::gather<sizeof(MT) * Scale>(aliasing_cast<int>(args.address),
+                                                simd_cast<AVX2::int_v>(args.indexes).data()),
+                args.address);
+        }
+
+        // masked overload
+        template <class MT, class U, class A, int Scale>
+        Vc_INTRINSIC enable_if<(std::is_same<T, float>::value &&
+                                (std::is_same<MT, float16>::value ||
+                                 std::is_same<MT, bfloat16>::value) &&
+                                Vector<U, A>::size() >= size()),
+                               void>
+        gatherImplementation(const Common::GatherArguments<MT, Vector<U, A>, Scale> &args,
+                             MaskArgument k)
+        {
+            const auto impl = Detail::runtimeGatherImplementation();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+                return;
+            }
+            assign(Vector(Detail::convert_gathered(
+                       AVX::gather<sizeof(MT) * Scale>(
+                           _mm256_setzero_si256(), _mm256_castps_si256(k.data()),
+                           aliasing_cast<int>(args.address),
+                           simd_cast<AVX2::int_v>(args.indexes).data()),
+                       args.address)),
+                   k);
+        }
+
         ////////////////////////////////////////////////////////////////////////////////
         // all remaining converting gathers
         template <class MT, class U, class A, int Scale>
@@ -76,6 +76,30 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(b.data(), a.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(b.data(), a.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator==(AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator==(AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator!=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator!=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator>=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmplt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator>=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(b.data(), a.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator<=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator<=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator> (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator> (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator< (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmplt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator< (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(b.data(), a.data()); }
 #endif  // Vc_IMPL_AVX2
 
 // bitwise operators {{{1
@@ -229,6 +253,34 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    const auto lo = SSE::schar_v::generate(gen);
+    const auto hi = SSE::schar_v::generate([&](int i) { return gen(i + 16); });
+    return AVX::concat(lo.data(), hi.data());
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    const auto lo = SSE::uchar_v::generate(gen);
+    const auto hi = SSE::uchar_v::generate([&](int i) { return gen(i + 16); });
+    return AVX::concat(lo.data(), hi.data());
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::llong_v AVX2::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
 #endif
 
 // constants {{{1
@@ -243,6 +295,8 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
 #endif
 
 template <typename T>
@@ -262,6 +316,18 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+#ifdef Vc_IMPL_AVX2
+template <>
+Vc_ALWAYS_INLINE Vector<llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_cvtepi32_epi64(SSE::int_v::IndexesFromZero().data()))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_cvtepi32_epi64(SSE::int_v::IndexesFromZero().data()))
+{
+}
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -426,10 +492,102 @@ Vc_GATHER_IMPL(ushort_v)
                               Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
                               Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15));
 }
+
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5),
+                             Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
+                             Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15), Vc_M(16), Vc_M(17),
+                             Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29),
+                             Vc_M(30), Vc_M(31));
+}
+
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5),
+                             Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
+                             Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15), Vc_M(16), Vc_M(17),
+                             Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29),
+                             Vc_M(30), Vc_M(31));
+}
+
+Vc_GATHER_IMPL(llong_v)
+{
+    d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3));
+}
+
+Vc_GATHER_IMPL(ullong_v)
+{
+    d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3));
+}
 #endif
 #undef Vc_M
 #undef Vc_GATHER_IMPL
 
+#if defined Vc_IMPL_AVX2 && !defined Vc_MSVC
+namespace Detail
+{
+/**\internal
+ * The calibration workload for selectGatherImplementation: masked gathers into \p V from
+ * an L1-resident table with random indexes and random masks of mixed density.
+ */
+template <class V>
+Vc_NEVER_INLINE float calibrateGatherImplementation(
+    Common::GatherScatterImplementation impl)
+{
+    using T = typename V::EntryType;
+    using IV = conditional_t<V::Size == 4, SSE::int_v, AVX2::int_v>;
+    constexpr int TableSize = 1024;
+    constexpr int Vectors = 64;
+    constexpr int Rounds = 32;
+    T table[TableSize];
+    IV indexes[Vectors];
+    typename V::MaskType masks[Vectors];
+    unsigned state = 0x2545f491u;
+    const auto next = [&]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+    for (int i = 0; i < TableSize; ++i) {
+        table[i] = static_cast<T>(i);
+    }
+    for (int i = 0; i < Vectors; ++i) {
+        // every fourth mask is full, the others keep about half of the entries
+        const unsigned bits = i % 4 == 0 ? ~0u : next();
+        indexes[i] = IV::Zero();
+        for (std::size_t n = 0; n < V::Size; ++n) {
+            indexes[i][n] = int(next() % TableSize);
+            masks[i][n] = ((bits >> n) & 1) != 0;
+        }
+    }
+    V sum = V::Zero();
+    for (int r = 0; r < Rounds; ++r) {
+        for (int i = 0; i < Vectors; ++i) {
+            V v = sum;
+            if (impl == Common::GatherScatterImplementation::Hardware) {
+                v.data() = AVX::gather<sizeof(T)>(v.data(), masks[i].data(), table,
+                                                  indexes[i].data());
+            } else {
+                Common::executeGather(impl, v, table, indexes[i], masks[i]);
+            }
+            sum += v;
+        }
+    }
+    return static_cast<float>(sum.sum());
+}
+
+template <class V>
+inline Common::GatherScatterImplementation runtimeGatherImplementation()
+{
+    static const Common::GatherScatterImplementation impl =
+        Common::selectGatherImplementation(&calibrateGatherImplementation<V>);
+    return impl;
+}
+}  // namespace Detail
+#endif  // Vc_IMPL_AVX2 && !Vc_MSVC
+
 template <class T>
 template <class MT, class IT, int Scale>
 inline void Vector<T, VectorAbi::Avx>::gatherImplementation(
@@ -437,6 +595,11 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(
 {
     const auto *mem = args.address;
     const auto indexes = Scale * args.indexes;
+#if defined Vc_IMPL_AVX2 && !defined Vc_MSVC && !defined Vc_USE_SET_GATHERS &&           \
+    !defined Vc_USE_BSF_GATHERS && !defined Vc_USE_POPCNT_BSF_GATHERS
+    Common::executeGather(Detail::runtimeGatherImplementation(), *this, mem, indexes,
+                          mask);
+#else
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
           Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
@@ -450,18 +613,58 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(
 #endif
                                                 > ;
     Common::executeGather(Selector(), *this, mem, indexes, mask);
+#endif
 }
 
-template <typename T>
-template <typename MT, typename IT>
-inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes) const
+// scatters {{{1
+namespace Detail
 {
-    Common::unrolled_loop<std::size_t, 0, Size>([&](std::size_t i) { mem[indexes[i]] = d.m(i); });
+// AVX-512 scatters store 32- and 64-bit entries without conversion and take 32-bit
+// indexes from a SIMD vector
+template <class T, class MT, class IT>
+using has_native_scatter = std::integral_constant<
+    bool,
+#ifdef Vc_IMPL_AVX512
+    std::is_same<T, MT>::value && (sizeof(T) == 4 || sizeof(T) == 8) &&
+        Traits::is_simd_vector<IT>::value &&
+        std::is_integral<Traits::entry_type_of<IT>>::value &&
+        sizeof(Traits::entry_type_of<IT>) <= 4
+#else
+    false
+#endif
+    >;
+
+#ifdef Vc_IMPL_AVX512
+template <class T, class IT>
+Vc_INTRINSIC void scatter(const AVX2::Vector<T> &v, T *mem, const IT &indexes,
+                          __mmask8 k)
+{
+    using IndexVector = conditional_t<AVX2::Vector<T>::Size == 4, SSE::int_v, AVX2::int_v>;
+    AVX::scatter<sizeof(T)>(mem, simd_cast<IndexVector>(indexes).data(), v.data(), k);
+}
+template <class T, class IT>
+Vc_INTRINSIC void scatter(const AVX2::Vector<T> &v, T *mem, const IT &indexes,
+                          std::true_type)
+{
+    scatter(v, mem, indexes, __mmask8((1u << AVX2::Vector<T>::Size) - 1));
 }
+template <class T, class IT>
+Vc_INTRINSIC void scatter(const AVX2::Vector<T> &v, T *mem, const IT &indexes,
+                          const AVX2::Mask<T> &mask, std::true_type)
+{
+    scatter(v, mem, indexes, __mmask8(mask.toInt()));
+}
+#endif  // Vc_IMPL_AVX512
 
-template <typename T>
-template <typename MT, typename IT>
-inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
+template <class T, class MT, class IT>
+Vc_INTRINSIC void scatter(const AVX2::Vector<T> &v, MT *mem, IT &&indexes, std::false_type)
+{
+    Common::unrolled_loop<std::size_t, 0, AVX2::Vector<T>::Size>(
+        [&](std::size_t i) { mem[indexes[i]] = v[i]; });
+}
+template <class T, class MT, class IT>
+Vc_INTRINSIC void scatter(const AVX2::Vector<T> &v, MT *mem, IT &&indexes,
+                          const AVX2::Mask<T> &mask, std::false_type)
 {
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
@@ -475,7 +678,24 @@ inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&index
               Common::GatherScatterImplementation::SimpleLoop
 #endif
                                                 > ;
-    Common::executeScatter(Selector(), *this, mem, std::forward<IT>(indexes), mask);
+    Common::executeScatter(Selector(), v, mem, std::forward<IT>(indexes), mask);
+}
+}  // namespace Detail
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes) const
+{
+    Detail::scatter(*this, mem, std::forward<IT>(indexes),
+                    Detail::has_native_scatter<T, MT, remove_cvref_t<IT>>());
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
+{
+    Detail::scatter(*this, mem, std::forward<IT>(indexes), mask,
+                    Detail::has_native_scatter<T, MT, remove_cvref_t<IT>>());
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -857,6 +1077,38 @@ template <> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::interleaveHigh(AVX2::ush
     return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi16(data(), x.data()),
                                    _mm256_unpackhi_epi16(data(), x.data()));
 }
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveLow ( AVX2::schar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveHigh( AVX2::schar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveLow ( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveHigh( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveLow ( AVX2::llong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveHigh( AVX2::llong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveLow (AVX2::ullong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveHigh(AVX2::ullong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
 #endif
 // permutation via operator[] {{{1
 template <> Vc_INTRINSIC Vc_PURE AVX2::double_v AVX2::double_v::operator[](Permutation::ReversedTag) const
@@ -894,6 +1146,34 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    const __m256i reverse16 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+                                               3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                               7, 6, 5, 4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverse16));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    const __m256i reverse16 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+                                               3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                               7, 6, 5, 4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverse16));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::llong_v AVX2::llong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ullong_v AVX2::ullong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
@@ -51,6 +51,20 @@ namespace AVX
 
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if<!Flags::IsStreaming, void *>::type = nullptr) { _mm256_maskstore(mem, m, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if< Flags::IsStreaming, void *>::type = nullptr) { AvxIntrinsics::stream_store(mem, x, m); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfAligned               = nullptr) { _mm_store_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, float16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfUnalignedNotStreaming = nullptr) { _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, float16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, float16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(convert(x, ConvertTag<float, float16>()), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, VTArg m) { SseIntrinsics::maskstore(convert(x, ConvertTag<float, float16>()), _mm_packs_epi32(_mm_castps_si128(lo128(m)), _mm_castps_si128(hi128(m))), mem); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, typename Flags::EnableIfAligned               = nullptr) { _mm_store_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, bfloat16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, typename Flags::EnableIfUnalignedNotStreaming = nullptr) { _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, bfloat16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_si128(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, bfloat16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(convert(x, ConvertTag<float, bfloat16>()), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, VTArg m) { SseIntrinsics::maskstore(convert(x, ConvertTag<float, bfloat16>()), _mm_packs_epi32(_mm_castps_si128(lo128(m)), _mm_castps_si128(hi128(m))), mem); }
         };
 
         template<> struct VectorHelper<__m256d>
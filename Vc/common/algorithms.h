@@ -28,10 +28,67 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
 #include "simdize.h"
+#include "threadpool.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Tag type for the default execution mode of simd_for_each and simd_for_each_n.
+ *
+ * Full vectors are loaded (unaligned) starting at \p first. The remaining elements that
+ * do not fill a complete vector are passed to the function one by one, using
+ * `Vc::simdize<` *value type* `, 1>`.
+ */
+struct ScalarRemainderTag {};
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Tag type for an execution mode of simd_for_each and simd_for_each_n that only ever
+ * calls the function with full-width vectors.
+ *
+ * The first call covers the elements up to the first \c MemoryAlignment boundary, all
+ * following calls except the last one use aligned loads (and stores), and the last call
+ * covers the remaining elements. Thus, the function is called at most twice with a
+ * partially filled vector. To distinguish valid from invalid entries, the function is
+ * called with the mask of valid entries as second argument. The invalid entries are
+ * neither read from nor written to memory.
+ *
+ * This mode requires contiguous storage of an arithmetic value type.
+ */
+struct AlignedMaskedTag {};
+
+/**
+ * \ingroup Utilities
+ * Use this object to select the default execution mode (ScalarRemainderTag) of
+ * simd_for_each and simd_for_each_n explicitly.
+ */
+constexpr ScalarRemainderTag ScalarRemainder = {};
+
+/**
+ * \ingroup Utilities
+ * Use this object to select the aligned prologue / masked epilogue execution mode
+ * (AlignedMaskedTag) of simd_for_each and simd_for_each_n.
+ *
+ * \code
+ * void scale(std::vector<float> &data, float factor) {
+ *   Vc::simd_for_each(Vc::AlignedMasked, data.begin(), data.end(),
+ *                     [&](auto &v, auto valid) { v *= factor; });
+ * }
+ * \endcode
+ */
+constexpr AlignedMaskedTag AlignedMasked = {};
+
 #ifdef DOXYGEN
 /**
  * \ingroup Utilities
@@ -62,6 +119,22 @@ namespace Vc_VERSIONED_NAMESPACE
  */
 template <class InputIt, class UnaryFunction>
 UnaryFunction simd_for_each(InputIt first, InputIt last, UnaryFunction f);
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::for_each` algorithm with an explicit execution mode.
+ *
+ * With \p policy of type ScalarRemainderTag this is equivalent to the overload above.
+ * With \p policy of type AlignedMaskedTag \p f is called with two arguments: a
+ * `Vc::Vector<` *iterator value type* `>` and its `Mask` of valid entries. Only the first
+ * and the last call may pass a mask that is not completely set.
+ *
+ * \see AlignedMasked
+ */
+template <class Policy, class InputIt, class UnaryFunction>
+UnaryFunction simd_for_each(Policy policy, InputIt first, InputIt last, UnaryFunction f);
 #else
 template <class InputIt, class UnaryFunction,
           class ValueType = typename std::iterator_traits<InputIt>::value_type>
@@ -110,6 +183,115 @@ simd_for_each(InputIt first, InputIt last, UnaryFunction f)
     }
     return f;
 }
+
+// AlignedMasked implementation
+namespace Detail
+{
+template <class V, class T>
+Vc_INTRINSIC void simd_for_each_write_back(std::false_type, const V &, T *,
+                                           const typename V::IndexType &,
+                                           const typename V::mask_type &)
+{
+}
+template <class V, class T>
+Vc_INTRINSIC void simd_for_each_write_back(std::true_type, const V &v, T *mem,
+                                           const typename V::IndexType &indexes,
+                                           const typename V::mask_type &k)
+{
+    v.scatter(mem, indexes, k);
+}
+
+template <class V, class T, class UnaryFunction, class WriteBack>
+Vc_INTRINSIC void simd_for_each_partial(T *mem, std::size_t n, UnaryFunction &f,
+                                        WriteBack write_back)
+{
+    // masked gather and scatter guarantee that memory outside of [mem, mem + n) is not
+    // touched
+    const typename V::IndexType indexes(Vc::IndexesFromZero);
+    const typename V::mask_type k =
+        V::mask_type::generate([&](std::size_t i) { return i < n; });
+    V tmp = V::Zero();
+    tmp.gather(mem, indexes, k);
+    f(tmp, k);
+    simd_for_each_write_back(write_back, tmp, mem, indexes, k);
+}
+
+template <class V, class T, class UnaryFunction, class Flags>
+Vc_INTRINSIC void simd_for_each_full(std::false_type, T *mem, UnaryFunction &f,
+                                     Flags flags)
+{
+    V tmp(mem, flags);
+    f(tmp, typename V::mask_type(true));
+}
+template <class V, class T, class UnaryFunction, class Flags>
+Vc_INTRINSIC void simd_for_each_full(std::true_type, T *mem, UnaryFunction &f,
+                                     Flags flags)
+{
+    V tmp(mem, flags);
+    f(tmp, typename V::mask_type(true));
+    tmp.store(mem, flags);
+}
+
+template <class V, class T, class UnaryFunction, class WriteBack>
+inline void simd_for_each_aligned_masked_impl(T *mem, std::size_t count,
+                                              UnaryFunction &f, WriteBack write_back)
+{
+    std::size_t i = 0;
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(mem) % V::MemoryAlignment;
+    if (misalignment % sizeof(T) == 0) {
+        const std::size_t peel = std::min(
+            count, (V::MemoryAlignment - misalignment) % V::MemoryAlignment / sizeof(T));
+        if (peel > 0) {
+            simd_for_each_partial<V>(mem, peel, f, write_back);
+            i = peel;
+        }
+        for (; i + V::Size <= count; i += V::Size) {
+            simd_for_each_full<V>(write_back, mem + i, f, Vc::Aligned);
+        }
+    } else {
+        // mem is not even aligned on sizeof(T), thus no aligned vector load is possible
+        for (; i + V::Size <= count; i += V::Size) {
+            simd_for_each_full<V>(write_back, mem + i, f, Vc::Unaligned);
+        }
+    }
+    if (i < count) {
+        simd_for_each_partial<V>(mem + i, count - i, f, write_back);
+    }
+}
+
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type,
+          class V = simdize<ValueType>>
+inline void simd_for_each_aligned_masked(InputIt first, std::size_t count,
+                                         UnaryFunction &f)
+{
+    static_assert(std::is_arithmetic<ValueType>::value && Traits::is_simd_vector<V>::value,
+                  "Vc::AlignedMasked requires an iterator to contiguous storage of an "
+                  "arithmetic type");
+    using WriteBack = std::integral_constant<
+        bool, !Traits::is_masked_functor_argument_immutable<UnaryFunction, V,
+                                                            typename V::mask_type>::value>;
+    if (count > 0) {
+        simd_for_each_aligned_masked_impl<V>(std::addressof(*first), count, f, WriteBack());
+    }
+}
+}  // namespace Detail
+
+template <class InputIt, class UnaryFunction>
+inline UnaryFunction simd_for_each(ScalarRemainderTag, InputIt first, InputIt last,
+                                   UnaryFunction f)
+{
+    return simd_for_each(first, last, std::move(f));
+}
+
+template <class InputIt, class UnaryFunction>
+inline UnaryFunction simd_for_each(AlignedMaskedTag, InputIt first, InputIt last,
+                                   UnaryFunction f)
+{
+    Detail::simd_for_each_aligned_masked(first, std::distance(first, last), f);
+    return f;
+}
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -161,6 +343,3024 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     return f;
 }
 
+template <typename InputIt, typename UnaryFunction>
+inline UnaryFunction simd_for_each_n(ScalarRemainderTag, InputIt first, std::size_t count,
+                                     UnaryFunction f)
+{
+    return simd_for_each_n(first, count, std::move(f));
+}
+
+template <typename InputIt, typename UnaryFunction>
+inline UnaryFunction simd_for_each_n(AlignedMaskedTag, InputIt first, std::size_t count,
+                                     UnaryFunction f)
+{
+    Detail::simd_for_each_aligned_masked(first, count, f);
+    return f;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// simd_transform
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::transform. The function \p f is called with
+ * `Vc::simdize<` *value type* `>` objects loaded from [\p first, \p last). Its return
+ * value is stored to the range starting at \p d_first. The remaining elements that do not
+ * fill a complete vector are passed one by one, using `Vc::simdize<` *value type* `, 1>`.
+ * Thus \p f should be a generic lambda (or a function object with a templated call
+ * operator). The return value of \p f must be convertible to `Vc::simdize<` *output
+ * value type* `, N>`, where N is the width of the argument.
+ *
+ * Example:
+ * \code
+ * std::vector<float> in = ..., out(in.size());
+ * Vc::simd_transform(in.begin(), in.end(), out.begin(),
+ *                    [](auto x) { return x * x + 1; });
+ * \endcode
+ *
+ * \return The output iterator past the last element written.
+ */
+template <class InputIt, class OutputIt, class UnaryOperation>
+inline OutputIt simd_transform(InputIt first, InputIt last, OutputIt d_first,
+                               UnaryOperation f)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef typename std::iterator_traits<OutputIt>::value_type U;
+    typedef simdize<T> V;
+    typedef simdize<U, V::size()> R;
+    typedef simdize<T, 1> V1;
+    typedef simdize<U, 1> R1;
+    // count instead of computing last - V::size(), which is invalid for short ranges
+    std::size_t count = std::distance(first, last);
+    for (; count >= V::size(); count -= V::size()) {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        const R result = f(tmp);
+        store_interleaved(result, std::addressof(*d_first));
+        first += V::size();
+        d_first += V::size();
+    }
+    for (; first != last; ++first, ++d_first) {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        const R1 result = f(tmp);
+        store_interleaved(result, std::addressof(*d_first));
+    }
+    return d_first;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of the binary std::transform. Like the unary simd_transform, but
+ * \p f is called with one vector from [\p first1, \p last1) and one vector of equal width
+ * from the range starting at \p first2.
+ *
+ * \return The output iterator past the last element written.
+ */
+template <class InputIt1, class InputIt2, class OutputIt, class BinaryOperation>
+inline OutputIt simd_transform(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                               OutputIt d_first, BinaryOperation f)
+{
+    typedef typename std::iterator_traits<InputIt1>::value_type T1;
+    typedef typename std::iterator_traits<InputIt2>::value_type T2;
+    typedef typename std::iterator_traits<OutputIt>::value_type U;
+    typedef simdize<T1> V1;
+    typedef simdize<T2, V1::size()> V2;
+    typedef simdize<U, V1::size()> R;
+    std::size_t count = std::distance(first1, last1);
+    for (; count >= V1::size(); count -= V1::size()) {
+        V1 a;
+        V2 b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        const R result = f(a, b);
+        store_interleaved(result, std::addressof(*d_first));
+        first1 += V1::size();
+        first2 += V1::size();
+        d_first += V1::size();
+    }
+    for (; first1 != last1; ++first1, ++first2, ++d_first) {
+        simdize<T1, 1> a;
+        simdize<T2, 1> b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        const simdize<U, 1> result = f(a, b);
+        store_interleaved(result, std::addressof(*d_first));
+    }
+    return d_first;
+}
+
+// simd_reduce
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Function object returning the smaller of its two arguments. For SIMD vectors the
+ * minimum is determined per entry. simd_reduce uses Vector::min() for the final
+ * horizontal reduction.
+ */
+struct Minimum {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        using std::min;
+        return min(a, b);
+    }
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Function object returning the larger of its two arguments. For SIMD vectors the
+ * maximum is determined per entry. simd_reduce uses Vector::max() for the final
+ * horizontal reduction.
+ */
+struct Maximum {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        using std::max;
+        return max(a, b);
+    }
+};
+
+namespace Detail
+{
+// transparent equivalents of std::plus<> and std::multiplies<>, which require C++14
+struct Plus {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a + b;
+    }
+};
+struct Multiplies {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a * b;
+    }
+};
+
+// horizontal reduction of the accumulator, using the dedicated Vector member functions
+// for the known operations
+template <class V, class T>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v,
+                                                          const std::plus<T> &)
+{
+    return v.sum();
+}
+template <class V, class T>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v,
+                                                          const std::multiplies<T> &)
+{
+    return v.product();
+}
+template <class V>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v, const Plus &)
+{
+    return v.sum();
+}
+template <class V>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v, const Multiplies &)
+{
+    return v.product();
+}
+template <class V>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v, const Minimum &)
+{
+    return v.min();
+}
+template <class V>
+Vc_INTRINSIC typename V::EntryType simd_reduce_horizontal(const V &v, const Maximum &)
+{
+    return v.max();
+}
+template <class V, class BinaryOperation>
+inline typename V::EntryType simd_reduce_horizontal(const V &v, const BinaryOperation &op)
+{
+    typename V::EntryType r = v[0];
+    for (std::size_t i = 1; i < V::size(); ++i) {
+        r = op(r, typename V::EntryType(v[i]));
+    }
+    return r;
+}
+
+// std::plus<T> and std::multiplies<T> for arithmetic T cannot be called with vectors,
+// use the transparent equivalents instead
+template <class BinaryOperation>
+Vc_INTRINSIC BinaryOperation simd_reduce_operation(BinaryOperation op)
+{
+    return op;
+}
+template <class T, class = enable_if<std::is_arithmetic<T>::value>>
+Vc_INTRINSIC Plus simd_reduce_operation(std::plus<T>)
+{
+    return {};
+}
+template <class T, class = enable_if<std::is_arithmetic<T>::value>>
+Vc_INTRINSIC Multiplies simd_reduce_operation(std::multiplies<T>)
+{
+    return {};
+}
+
+/**\internal
+ * The type of the accumulators for reducing vectors of type \p V into an initial value of
+ * type \p T. If \p T is wider than the entries of \p V, the reduction is computed in
+ * SimdArray<T, V::size()>, as std::accumulate computes it in \p T. Otherwise it is
+ * computed in \p V.
+ */
+template <class V, class T, class U = typename V::EntryType,
+          bool = std::is_arithmetic<T>::value && !std::is_same<T, U>::value>
+struct SimdReduceAccumulator {
+    typedef V type;
+};
+template <class V, class T, class U> struct SimdReduceAccumulator<V, T, U, true> {
+    static constexpr bool widen =
+        std::is_same<typename std::common_type<T, U>::type, T>::value &&
+        (sizeof(T) > sizeof(U) ||
+         (std::is_floating_point<T>::value && std::is_integral<U>::value));
+    typedef typename std::conditional<widen, SimdArray<T, V::size()>, V>::type type;
+};
+
+// converts the loaded vectors to the accumulator type; 8- and 16-bit entries are
+// converted via 32-bit integers, because simd_cast does not convert them to every type
+template <class A> Vc_INTRINSIC A simd_reduce_widen(const A &x) { return x; }
+template <class A, class V>
+Vc_INTRINSIC enable_if<(!std::is_same<A, V>::value && sizeof(typename V::EntryType) >= 4),
+                       A>
+simd_reduce_widen(const V &x)
+{
+    return simd_cast<A>(x);
+}
+template <class A, class V>
+Vc_INTRINSIC enable_if<(!std::is_same<A, V>::value && sizeof(typename V::EntryType) < 4),
+                       A>
+simd_reduce_widen(const V &x)
+{
+    typedef typename std::conditional<std::is_signed<typename V::EntryType>::value, int,
+                                      unsigned int>::type I;
+    return simd_cast<A>(simd_cast<SimdArray<I, V::size()>>(x));
+}
+
+/**\internal
+ * Loads the vectors via \p load, which is called with the element offset, and reduces
+ * them into four independent accumulators of the type determined by
+ * SimdReduceAccumulator. Independent accumulators hide the latency of \p op, which
+ * otherwise limits the loop to one operation per latency period. Returns the number of
+ * elements that were reduced into \p init.
+ */
+template <class V, class T, class BinaryOperation, class Load>
+inline std::size_t simd_reduce_impl(std::size_t count, T &init, BinaryOperation &op,
+                                    Load &&load)
+{
+    typedef typename SimdReduceAccumulator<V, T>::type A;
+    constexpr std::size_t N = V::size();
+    if (count < N) {
+        return 0;
+    }
+    A acc0 = simd_reduce_widen<A>(load(0));
+    std::size_t i = N;
+    // With a single entry per vector the compiler vectorizes the loop below by itself.
+    // Four scalar accumulators only get in its way, and GCC 12 miscompiles them for
+    // 16-bit entries.
+    if (N > 1 && count >= 4 * N) {
+        A acc1 = simd_reduce_widen<A>(load(N));
+        A acc2 = simd_reduce_widen<A>(load(2 * N));
+        A acc3 = simd_reduce_widen<A>(load(3 * N));
+        for (i = 4 * N; i + 4 * N <= count; i += 4 * N) {
+            acc0 = op(acc0, simd_reduce_widen<A>(load(i)));
+            acc1 = op(acc1, simd_reduce_widen<A>(load(i + N)));
+            acc2 = op(acc2, simd_reduce_widen<A>(load(i + 2 * N)));
+            acc3 = op(acc3, simd_reduce_widen<A>(load(i + 3 * N)));
+        }
+        acc0 = op(op(acc0, acc1), op(acc2, acc3));
+    }
+    for (; i + N <= count; i += N) {
+        acc0 = op(acc0, simd_reduce_widen<A>(load(i)));
+    }
+    init = op(init, T(simd_reduce_horizontal(acc0, op)));
+    return i;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::reduce for ranges of arithmetic values.
+ *
+ * The full vectors are reduced into four independent vector accumulators, which are
+ * combined and reduced horizontally once at the end. The horizontal reduction uses
+ * Vector::sum() for std::plus, Vector::product() for std::multiplies, and Vector::min()
+ * / Vector::max() for Vc::Minimum / Vc::Maximum. The remaining elements that do not
+ * fill a complete vector are reduced one by one.
+ *
+ * \param first, last The range of values to reduce. It must be contiguous in memory.
+ * \param init The initial value of the reduction. If its type is wider than the value
+ *             type of the range (e.g. `long long` for a range of `short`), the vectors
+ *             are converted and reduced in that type, as std::accumulate does.
+ * \param op An associative and commutative operation. It is called with two vectors as
+ *           well as with two scalars (e.g. a generic lambda or `std::plus<>`). The order
+ *           in which the elements are combined is unspecified, thus floating-point
+ *           results may differ from a sequential reduction.
+ *
+ * Example:
+ * \code
+ * std::vector<float> data = ...;
+ * float sum = Vc::simd_reduce(data.begin(), data.end(), 0.f);
+ * float max = Vc::simd_reduce(data.begin(), data.end(), data[0], Vc::Maximum());
+ * \endcode
+ */
+template <class InputIt, class T, class BinaryOperation>
+inline T simd_reduce(InputIt first, InputIt last, T init, BinaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_reduce requires a range of arithmetic values");
+    typedef simdize<ValueType> V;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return init;
+    }
+    const ValueType *mem = std::addressof(*first);
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    std::size_t i = Detail::simd_reduce_impl<V>(
+        count, init, op2, [&](std::size_t j) { return V(mem + j, Vc::Unaligned); });
+    for (; i < count; ++i) {
+        init = op2(init, T(mem[i]));
+    }
+    return init;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the sum of all elements in [\p first, \p last) plus \p init.
+ */
+template <class InputIt, class T>
+inline T simd_reduce(InputIt first, InputIt last, T init)
+{
+    return simd_reduce(first, last, init, Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::transform_reduce: applies \p transform to the vectors loaded
+ * from [\p first, \p last) and reduces the results with \p reduce as simd_reduce does.
+ * The remaining elements that do not fill a complete vector are passed to \p transform
+ * one by one, using `Vc::simdize<` *value type* `, 1>`.
+ *
+ * Example:
+ * \code
+ * // sum of squares
+ * float r = Vc::simd_transform_reduce(data.begin(), data.end(), 0.f, std::plus<float>(),
+ *                                     [](auto x) { return x * x; });
+ * \endcode
+ */
+template <class InputIt, class T, class BinaryOperation, class UnaryOperation>
+inline T simd_transform_reduce(InputIt first, InputIt last, T init,
+                               BinaryOperation reduce, UnaryOperation transform)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_transform_reduce requires a range of arithmetic values");
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    typedef decltype(transform(std::declval<V>())) R;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return init;
+    }
+    const ValueType *mem = std::addressof(*first);
+    auto &&reduce2 = Detail::simd_reduce_operation(reduce);
+    std::size_t i = Detail::simd_reduce_impl<R>(count, init, reduce2, [&](std::size_t j) {
+        return transform(V(mem + j, Vc::Unaligned));
+    });
+    for (; i < count; ++i) {
+        init = reduce2(init, T(transform(V1(mem[i]))[0]));
+    }
+    return init;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Binary variant of simd_transform_reduce: \p transform is called with one vector from
+ * [\p first1, \p last1) and one vector of equal width from the range starting at
+ * \p first2.
+ *
+ * Example:
+ * \code
+ * float dot = Vc::simd_transform_reduce(a.begin(), a.end(), b.begin(), 0.f);
+ * \endcode
+ */
+template <class InputIt1, class InputIt2, class T, class BinaryOperation1,
+          class BinaryOperation2>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                               BinaryOperation1 reduce, BinaryOperation2 transform)
+{
+    typedef typename std::iterator_traits<InputIt1>::value_type T1;
+    typedef typename std::iterator_traits<InputIt2>::value_type T2;
+    static_assert(std::is_arithmetic<T1>::value && std::is_arithmetic<T2>::value,
+                  "simd_transform_reduce requires ranges of arithmetic values");
+    typedef simdize<T1> V1;
+    typedef simdize<T2, V1::size()> V2;
+    typedef decltype(transform(std::declval<V1>(), std::declval<V2>())) R;
+    const std::size_t count = std::distance(first1, last1);
+    if (count == 0) {
+        return init;
+    }
+    const T1 *mem1 = std::addressof(*first1);
+    const T2 *mem2 = std::addressof(*first2);
+    auto &&reduce2 = Detail::simd_reduce_operation(reduce);
+    std::size_t i = Detail::simd_reduce_impl<R>(count, init, reduce2, [&](std::size_t j) {
+        return transform(V1(mem1 + j, Vc::Unaligned), V2(mem2 + j, Vc::Unaligned));
+    });
+    for (; i < count; ++i) {
+        init = reduce2(
+            init, T(transform(simdize<T1, 1>(mem1[i]), simdize<T2, 1>(mem2[i]))[0]));
+    }
+    return init;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the inner product of [\p first1, \p last1) and the range starting at \p first2,
+ * plus \p init.
+ */
+template <class InputIt1, class InputIt2, class T>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init)
+{
+    return simd_transform_reduce(first1, last1, first2, init, Detail::Plus(),
+                                 Detail::Multiplies());
+}
+
+// simd_find_if
+namespace Detail
+{
+// evaluates pred on the n < V::size() elements at mem, without touching memory outside
+// of [mem, mem + n)
+template <class V, class T, class Predicate>
+Vc_INTRINSIC typename V::mask_type simd_predicate_partial(const T *mem, std::size_t n,
+                                                          Predicate &pred)
+{
+    const typename V::IndexType indexes(Vc::IndexesFromZero);
+    const typename V::mask_type k =
+        V::mask_type::generate([&](std::size_t i) { return i < n; });
+    V tmp = V::Zero();
+    tmp.gather(mem, indexes, k);
+    return pred(tmp) && k;
+}
+
+// number of elements before the first MemoryAlignment boundary, or 0 if mem is not
+// aligned on sizeof(T)
+template <class V, class T> Vc_INTRINSIC std::size_t simd_alignment_peel(const T *mem)
+{
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(mem) % V::MemoryAlignment;
+    return misalignment % sizeof(T) != 0
+               ? 0
+               : (V::MemoryAlignment - misalignment) % V::MemoryAlignment / sizeof(T);
+}
+
+/**\internal
+ * Searches the full vectors starting at \p mem + \p i. Four vectors are tested per
+ * iteration and their masks are OR-combined, so that there is only one branch per four
+ * vectors as long as no element matches. Returns true and the index of the first match
+ * in \p i, or false and the index of the first element not tested in \p i.
+ */
+template <class V, class T, class Predicate, class Flags>
+inline bool simd_find_if_full(const T *mem, std::size_t &i, std::size_t count,
+                              Predicate &pred, Flags flags)
+{
+    typedef typename V::mask_type M;
+    constexpr std::size_t N = V::size();
+    for (; i + 4 * N <= count; i += 4 * N) {
+        const M m0 = pred(V(mem + i, flags));
+        const M m1 = pred(V(mem + i + N, flags));
+        const M m2 = pred(V(mem + i + 2 * N, flags));
+        const M m3 = pred(V(mem + i + 3 * N, flags));
+        if (Vc_IS_UNLIKELY(any_of(m0 | m1 | m2 | m3))) {
+            i += any_of(m0) ? m0.firstOne()
+                            : any_of(m1) ? N + m1.firstOne()
+                                         : any_of(m2) ? 2 * N + m2.firstOne()
+                                                      : 3 * N + m3.firstOne();
+            return true;
+        }
+    }
+    for (; i + N <= count; i += N) {
+        const M m = pred(V(mem + i, flags));
+        if (any_of(m)) {
+            i += m.firstOne();
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class V, class T, class Predicate>
+inline std::size_t simd_find_if_impl(const T *mem, std::size_t count, Predicate &pred)
+{
+    typedef typename V::mask_type M;
+    std::size_t i = std::min(count, simd_alignment_peel<V>(mem));
+    if (i > 0) {
+        const M m = simd_predicate_partial<V>(mem, i, pred);
+        if (any_of(m)) {
+            return m.firstOne();
+        }
+    }
+    const bool found =
+        reinterpret_cast<std::uintptr_t>(mem + i) % V::MemoryAlignment == 0
+            ? simd_find_if_full<V>(mem, i, count, pred, Vc::Aligned)
+            : simd_find_if_full<V>(mem, i, count, pred, Vc::Unaligned);
+    if (found) {
+        return i;
+    }
+    if (i < count) {
+        const M m = simd_predicate_partial<V>(mem + i, count - i, pred);
+        if (any_of(m)) {
+            return i + m.firstOne();
+        }
+    }
+    return count;
+}
+
+template <class V, class T, class Predicate, class Flags>
+inline std::size_t simd_count_if_full(const T *mem, std::size_t &i, std::size_t count,
+                                      Predicate &pred, Flags flags)
+{
+    constexpr std::size_t N = V::size();
+    std::size_t n0 = 0, n1 = 0, n2 = 0, n3 = 0;
+    for (; i + 4 * N <= count; i += 4 * N) {
+        n0 += pred(V(mem + i, flags)).count();
+        n1 += pred(V(mem + i + N, flags)).count();
+        n2 += pred(V(mem + i + 2 * N, flags)).count();
+        n3 += pred(V(mem + i + 3 * N, flags)).count();
+    }
+    for (; i + N <= count; i += N) {
+        n0 += pred(V(mem + i, flags)).count();
+    }
+    return (n0 + n1) + (n2 + n3);
+}
+
+template <class V, class T, class Predicate>
+inline std::size_t simd_count_if_impl(const T *mem, std::size_t count, Predicate &pred)
+{
+    std::size_t i = std::min(count, simd_alignment_peel<V>(mem));
+    std::size_t n = 0;
+    if (i > 0) {
+        n += simd_predicate_partial<V>(mem, i, pred).count();
+    }
+    n += reinterpret_cast<std::uintptr_t>(mem + i) % V::MemoryAlignment == 0
+             ? simd_count_if_full<V>(mem, i, count, pred, Vc::Aligned)
+             : simd_count_if_full<V>(mem, i, count, pred, Vc::Unaligned);
+    if (i < count) {
+        n += simd_predicate_partial<V>(mem + i, count - i, pred).count();
+    }
+    return n;
+}
+
+template <class V, class Predicate> struct NegatedPredicate {
+    Predicate &pred;
+    Vc_INTRINSIC typename V::mask_type operator()(const V &x) const { return !pred(x); }
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::find_if for contiguous ranges of arithmetic values.
+ *
+ * \p pred is called with `Vc::simdize<` *value type* `>` arguments and must return the
+ * corresponding mask type. The search is aligned to \c MemoryAlignment and tests four
+ * vectors per loop iteration with a single branch. The elements at the beginning and end
+ * of the range that do not fill a complete aligned vector are tested as a partially
+ * filled vector. The invalid entries of such a vector are zero and are never read from
+ * memory; \p pred must tolerate them and its result for them is ignored. Since whole
+ * vectors are tested, \p pred may be called for elements after the first match.
+ *
+ * Example:
+ * \code
+ * auto it = Vc::simd_find_if(data.begin(), data.end(),
+ *                            [](const Vc::float_v &x) { return x > 1.f; });
+ * \endcode
+ *
+ * \return An iterator to the first element for which \p pred is \c true, or \p last.
+ */
+template <class InputIt, class Predicate>
+inline InputIt simd_find_if(InputIt first, InputIt last, Predicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_find_if requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return last;
+    }
+    return first + Detail::simd_find_if_impl<simdize<T>>(std::addressof(*first), count,
+                                                          pred);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::find for contiguous ranges of arithmetic values. See
+ * simd_find_if.
+ *
+ * \return An iterator to the first element equal to \p value, or \p last.
+ */
+template <class InputIt, class T>
+inline InputIt simd_find(InputIt first, InputIt last, const T &value)
+{
+    typedef simdize<typename std::iterator_traits<InputIt>::value_type> V;
+    const V value_v = value;
+    return simd_find_if(first, last, [&](const V &x) { return x == value_v; });
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::count_if for contiguous ranges of arithmetic values. See
+ * simd_find_if for the requirements on \p pred. The number of matches is accumulated via
+ * Mask::count() in four independent counters.
+ */
+template <class InputIt, class Predicate>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count_if(
+    InputIt first, InputIt last, Predicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_count_if requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return 0;
+    }
+    return Detail::simd_count_if_impl<simdize<T>>(std::addressof(*first), count, pred);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns whether \p pred is \c true for at least one element in [\p first, \p last).
+ * See simd_find_if.
+ */
+template <class InputIt, class Predicate>
+inline bool simd_any_of(InputIt first, InputIt last, Predicate pred)
+{
+    return simd_find_if(first, last, std::move(pred)) != last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns whether \p pred is \c true for all elements in [\p first, \p last) (or the
+ * range is empty). See simd_find_if.
+ */
+template <class InputIt, class Predicate>
+inline bool simd_all_of(InputIt first, InputIt last, Predicate pred)
+{
+    typedef simdize<typename std::iterator_traits<InputIt>::value_type> V;
+    return simd_find_if(first, last, Detail::NegatedPredicate<V, Predicate>{pred}) ==
+           last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns whether \p pred is \c false for all elements in [\p first, \p last). See
+ * simd_find_if.
+ */
+template <class InputIt, class Predicate>
+inline bool simd_none_of(InputIt first, InputIt last, Predicate pred)
+{
+    return simd_find_if(first, last, std::move(pred)) == last;
+}
+
+// compress_store
+namespace Detail
+{
+// returns v with the entries selected by k moved to the front, in order; the remaining
+// entries are unspecified. The SSE and AVX2 implementations (sse/detail.h, avx/detail.h)
+// use shuffles driven by Common::CompressIndexes.
+template <class V> inline V compress(const V &v, const typename V::mask_type &k)
+{
+    V r = v;
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        if (k[i]) {
+            r[n++] = v[i];
+        }
+    }
+    return r;
+}
+
+// the AVX-512 implementation (avx/detail.h) stores with vcompressps / vpcompressd
+template <class V>
+inline std::size_t compress_store_impl(const V &v, const typename V::mask_type &k,
+                                       typename V::EntryType *mem)
+{
+    const V packed = compress(v, k);
+    const std::size_t n = k.count();
+    if (n == V::size()) {
+        packed.store(mem, Vc::Unaligned);
+    } else {
+        const typename V::IndexType indexes(Vc::IndexesFromZero);
+        packed.scatter(mem, indexes,
+                       V::mask_type::generate([&](std::size_t i) { return i < n; }));
+    }
+    return n;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Stores the entries of \p v selected by \p k contiguously to \p mem (left-packing, or
+ * stream compaction). Exactly `k.count()` entries are written; memory after them is not
+ * touched.
+ *
+ * On SSSE3 and AVX2 the entries are packed with a single shuffle (`pshufb` / `vpermd`)
+ * whose control is looked up with `k.toInt()`. With AVX-512 the 32- and 64-bit vectors
+ * use `vcompressps` / `vpcompressd` directly. Other vector types use a scalar fallback.
+ *
+ * Example:
+ * \code
+ * float *out = ...;
+ * out += Vc::compress_store(x, x > 0.f, out);  // append the positive entries of x
+ * \endcode
+ *
+ * \return The number of entries written, i.e. `k.count()`.
+ */
+template <class V>
+inline enable_if<Traits::is_simd_vector<V>::value, std::size_t> compress_store(
+    const V &v, const typename V::mask_type &k, typename V::EntryType *mem)
+{
+    return Detail::compress_store_impl(v, k, mem);
+}
+
+// expand_load
+namespace Detail
+{
+// the AVX-512 implementation (avx/detail.h) loads with vexpandps / vpexpandd
+template <class V>
+inline std::size_t expand_load_impl(V &v, const typename V::mask_type &k,
+                                    const typename V::EntryType *mem)
+{
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        if (k[i]) {
+            v[i] = mem[n++];
+        }
+    }
+    return n;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * The inverse of compress_store: loads `k.count()` contiguous entries from \p mem into
+ * the entries of \p v selected by \p k, in order. The other entries of \p v are not
+ * modified and memory after the loaded entries is not read.
+ *
+ * With AVX-512 the 32- and 64-bit vectors use `vexpandps` / `vpexpandd`. Other vector
+ * types use a scalar fallback.
+ *
+ * Example:
+ * \code
+ * const float *in = ...;
+ * in += Vc::expand_load(x, x < 0.f, in);  // replace the negative entries of x
+ * \endcode
+ *
+ * \return The number of entries read, i.e. `k.count()`.
+ */
+template <class V>
+inline enable_if<Traits::is_simd_vector<V>::value, std::size_t> expand_load(
+    V &v, const typename V::mask_type &k, const typename V::EntryType *mem)
+{
+    return Detail::expand_load_impl(v, k, mem);
+}
+
+// simd_copy_if / simd_remove_if
+namespace Detail
+{
+template <class V, class T, class Predicate>
+inline T *simd_copy_if_impl(const T *mem, std::size_t count, T *out, Predicate &pred)
+{
+    typedef typename V::mask_type M;
+    constexpr std::size_t N = V::size();
+    // The selected entries are collected with full vector stores in a local buffer, which
+    // is flushed to out in full vectors. Thus, nothing is written after the last copied
+    // element.
+    alignas(V::MemoryAlignment) T buffer[2 * N];
+    std::size_t buffered = 0;
+    auto &&append = [&](const V &v, const M &k) {
+        compress(v, k).store(&buffer[buffered], Vc::Unaligned);
+        buffered += k.count();
+        if (buffered >= N) {
+            V(&buffer[0], Vc::Aligned).store(out, Vc::Unaligned);
+            V(&buffer[N], Vc::Aligned).store(&buffer[0], Vc::Aligned);
+            out += N;
+            buffered -= N;
+        }
+    };
+    std::size_t i = 0;
+    for (; i + N <= count; i += N) {
+        const V v(mem + i, Vc::Unaligned);
+        append(v, pred(v));
+    }
+    if (i < count) {
+        const typename V::IndexType indexes(Vc::IndexesFromZero);
+        const M valid = M::generate([&](std::size_t j) { return j < count - i; });
+        V v = V::Zero();
+        v.gather(mem + i, indexes, valid);
+        append(v, pred(v) && valid);
+    }
+    return std::copy(&buffer[0], &buffer[buffered], out);
+}
+
+template <class V, class T, class Predicate>
+inline std::size_t simd_remove_if_impl(T *mem, std::size_t count, Predicate &pred)
+{
+    typedef typename V::mask_type M;
+    constexpr std::size_t N = V::size();
+    std::size_t out = 0;
+    std::size_t i = 0;
+    for (; i + N <= count; i += N) {
+        const V v(mem + i, Vc::Unaligned);
+        const M keep = !pred(v);
+        // out <= i, thus the full vector store only overwrites elements that were
+        // loaded already
+        compress(v, keep).store(mem + out, Vc::Unaligned);
+        out += keep.count();
+    }
+    if (i < count) {
+        const typename V::IndexType indexes(Vc::IndexesFromZero);
+        const M valid = M::generate([&](std::size_t j) { return j < count - i; });
+        V v = V::Zero();
+        v.gather(mem + i, indexes, valid);
+        out += compress_store(v, !pred(v) && valid, mem + out);
+    }
+    return out;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::copy_if for contiguous ranges of arithmetic values. See
+ * simd_find_if for the requirements on \p pred. The selected elements are left-packed
+ * with compress_store semantics, i.e. nothing is written after the last copied element.
+ *
+ * \return The output iterator past the last element written.
+ */
+template <class InputIt, class OutputIt, class Predicate>
+inline OutputIt simd_copy_if(InputIt first, InputIt last, OutputIt d_first, Predicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_copy_if requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    T *const out = std::addressof(*d_first);
+    return d_first + (Detail::simd_copy_if_impl<simdize<T>>(std::addressof(*first), count,
+                                                              out, pred) -
+                      out);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::remove_if for contiguous ranges of arithmetic values. See
+ * simd_find_if for the requirements on \p pred. The kept elements are left-packed in
+ * place with full vector stores. As for std::remove_if, the values of the elements after
+ * the returned iterator are unspecified.
+ *
+ * \return The iterator past the last kept element.
+ */
+template <class ForwardIt, class Predicate>
+inline ForwardIt simd_remove_if(ForwardIt first, ForwardIt last, Predicate pred)
+{
+    typedef typename std::iterator_traits<ForwardIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_remove_if requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return last;
+    }
+    return first +
+           Detail::simd_remove_if_impl<simdize<T>>(std::addressof(*first), count, pred);
+}
+
+// simd_sort
+namespace Detail
+{
+/**\internal
+ * Merges the sorted vectors \p a and \p b such that \p a holds the smallest and \p b the
+ * largest V::size() entries of both, each sorted ascending. Since the reversed \p b is
+ * sorted descending, min(a, reversed b) and max(a, reversed b) are bitonic and split the
+ * entries into the lower and upper half. The sorted() network then orders each half.
+ */
+template <class V> Vc_INTRINSIC void simd_sort_merge_step(V &a, V &b)
+{
+    const V rb = b.reversed();
+    b = Vc::max(a, rb).sorted();
+    a = Vc::min(a, rb).sorted();
+}
+
+/**\internal
+ * Merges the sorted runs [a, a + na) and [b, b + nb) into \p out. All pointers are
+ * aligned and \p na and \p nb are non-zero multiples of V::size().
+ */
+template <class V, class T>
+inline void simd_sort_merge(const T *a, std::size_t na, const T *b, std::size_t nb,
+                            T *out)
+{
+    constexpr std::size_t N = V::size();
+    const T *const a_end = a + na;
+    const T *const b_end = b + nb;
+    V lo(a, Vc::Aligned);
+    V hi(b, Vc::Aligned);
+    a += N;
+    b += N;
+    simd_sort_merge_step(lo, hi);
+    lo.store(out, Vc::Aligned);
+    out += N;
+    // hi holds the largest entries seen so far. The next vector must come from the run
+    // with the smaller head, otherwise an entry smaller than the ones in hi could follow.
+    while (a < a_end && b < b_end) {
+        if (*a < *b) {
+            lo.load(a, Vc::Aligned);
+            a += N;
+        } else {
+            lo.load(b, Vc::Aligned);
+            b += N;
+        }
+        simd_sort_merge_step(lo, hi);
+        lo.store(out, Vc::Aligned);
+        out += N;
+    }
+    for (; a < a_end; a += N) {
+        lo.load(a, Vc::Aligned);
+        simd_sort_merge_step(lo, hi);
+        lo.store(out, Vc::Aligned);
+        out += N;
+    }
+    for (; b < b_end; b += N) {
+        lo.load(b, Vc::Aligned);
+        simd_sort_merge_step(lo, hi);
+        lo.store(out, Vc::Aligned);
+        out += N;
+    }
+    hi.store(out, Vc::Aligned);
+}
+
+/**\internal
+ * The largest value of \p T, used to pad the last vector of a block. Padding entries
+ * always sort to the end and are never copied back.
+ */
+template <class T> constexpr T simd_sort_padding()
+{
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                 : std::numeric_limits<T>::max();
+}
+
+/**\internal
+ * The number of elements below which simd_sort_impl stops partitioning.
+ */
+template <class V>
+struct SimdSortBlock : std::integral_constant<std::size_t, 64 * V::size()> {
+};
+
+/**\internal
+ * Sorts the \p count <= SimdSortBlock<V>::value elements at \p mem. Each vector is
+ * sorted with the sorted() network, then the runs are merged pairwise, alternating
+ * between the two halves of \p scratch.
+ */
+template <class V, class T>
+inline void simd_sort_block(T *mem, std::size_t count, T *scratch)
+{
+    constexpr std::size_t N = V::size();
+    const std::size_t padded = (count + N - 1) / N * N;
+    T *src = scratch;
+    T *dst = scratch + SimdSortBlock<V>::value;
+    std::copy(mem, mem + count, src);
+    std::fill(src + count, src + padded, simd_sort_padding<T>());
+    for (std::size_t i = 0; i < padded; i += N) {
+        V(src + i, Vc::Aligned).sorted().store(src + i, Vc::Aligned);
+    }
+    for (std::size_t width = N; width < padded; width *= 2) {
+        for (std::size_t i = 0; i < padded; i += 2 * width) {
+            const std::size_t na = std::min(width, padded - i);
+            const std::size_t nb = std::min(width, padded - i - na);
+            if (nb == 0) {
+                std::copy(src + i, src + i + na, dst + i);
+            } else {
+                simd_sort_merge<V>(src + i, na, src + i + na, nb, dst + i);
+            }
+        }
+        std::swap(src, dst);
+    }
+    std::copy(src, src + count, mem);
+}
+
+/**\internal
+ * Moves the elements of [mem, mem + count) that are less than \p pivot (or equal to it if
+ * \p inclusive is \c true) to the front, preserving their order, and returns their
+ * number. The left side is packed in place with full compress stores, as in
+ * simd_remove_if_impl; the right side is packed into \p scratch and copied back
+ * afterwards. \p scratch must have room for count + V::size() elements.
+ */
+template <class V, class T>
+inline std::size_t simd_sort_partition(T *mem, std::size_t count, T pivot, bool inclusive,
+                                       T *scratch)
+{
+    typedef typename V::mask_type M;
+    constexpr std::size_t N = V::size();
+    const V p = pivot;
+    std::size_t left = 0;
+    std::size_t right = 0;
+    std::size_t i = 0;
+    for (; i + N <= count; i += N) {
+        const V v(mem + i, Vc::Unaligned);
+        M k = v < p;
+        if (inclusive) {
+            k |= v == p;
+        }
+        compress(v, k).store(mem + left, Vc::Unaligned);
+        compress(v, !k).store(scratch + right, Vc::Unaligned);
+        const std::size_t n = k.count();
+        left += n;
+        right += N - n;
+    }
+    for (; i < count; ++i) {
+        const T x = mem[i];
+        if (x < pivot || (inclusive && x == pivot)) {
+            mem[left++] = x;
+        } else {
+            scratch[right++] = x;
+        }
+    }
+    std::copy(scratch, scratch + right, mem + left);
+    return left;
+}
+
+template <class T> inline T simd_sort_median(T a, T b, T c)
+{
+    using std::swap;
+    if (b < a) {
+        swap(a, b);
+    }
+    return c < a ? a : c < b ? c : b;
+}
+
+/**\internal
+ * Quicksort with the vectorized partition above. The smaller side is sorted recursively
+ * and the larger side iteratively, which bounds the recursion depth by log2(count). If
+ * the pivot selection degenerates, std::sort takes over after \p depth partitions.
+ */
+template <class V, class T>
+void simd_sort_impl(T *mem, std::size_t count, T *scratch, int depth)
+{
+    while (count > SimdSortBlock<V>::value) {
+        if (depth-- == 0) {
+            std::sort(mem, mem + count);
+            return;
+        }
+        const T pivot =
+            simd_sort_median(mem[count / 4], mem[count / 2], mem[count / 4 * 3]);
+        std::size_t left = simd_sort_partition<V>(mem, count, pivot, false, scratch);
+        if (left == 0) {
+            // the pivot is the minimum: split off all elements equal to it, they are in
+            // their final place already
+            left = simd_sort_partition<V>(mem, count, pivot, true, scratch);
+            mem += left;
+            count -= left;
+        } else if (left < count - left) {
+            simd_sort_impl<V>(mem, left, scratch, depth);
+            mem += left;
+            count -= left;
+        } else {
+            simd_sort_impl<V>(mem + left, count - left, scratch, depth);
+            count = left;
+        }
+    }
+    simd_sort_block<V>(mem, count, scratch);
+}
+
+/**\internal
+ * The vector type simd_sort uses for \p T. Detail::compress has AVX2 permutations only
+ * for 32- and 64-bit entries; otherwise the generic fallback would dominate the
+ * partition, and the SSE vector (with pshufb) is faster.
+ */
+template <class T> struct SimdSortVector {
+#if defined Vc_IMPL_AVX2
+    typedef typename std::conditional<sizeof(T) == 2, SSE::Vector<T>, Vector<T>>::type type;
+#elif defined Vc_IMPL_AVX
+    typedef SSE::Vector<T> type;
+#else
+    typedef Vector<T> type;
+#endif
+};
+
+template <class T>
+inline void simd_sort_dispatch(T *mem, std::size_t count, std::false_type)
+{
+    std::sort(mem, mem + count);
+}
+
+template <class T>
+inline void simd_sort_dispatch(T *mem, std::size_t count, std::true_type)
+{
+    typedef typename SimdSortVector<T>::type V;
+    constexpr std::size_t Block = SimdSortBlock<V>::value;
+    if (V::size() == 1 || count < 2 * V::size()) {
+        std::sort(mem, mem + count);
+        return;
+    }
+    // the partition needs count + V::size() elements, simd_sort_block needs 2 * Block
+    T *scratch = Vc::malloc<T, Vc::AlignOnVector>(std::max(count, Block) + Block);
+    int depth = 0;
+    for (std::size_t n = count; n > 1; n /= 2) {
+        depth += 2;
+    }
+    simd_sort_impl<V>(mem, count, scratch, depth);
+    Vc::free(scratch);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Sorts a contiguous range of \c float, \c double, \c int, \c uint, \c short, or
+ * \c ushort values in ascending order.
+ *
+ * Large ranges are split with a quicksort whose partition step packs both sides with
+ * compress stores. Blocks of up to 64 vectors are sorted by applying Vector::sorted() to
+ * every vector and merging the resulting runs with a bitonic merge network in registers.
+ * Other value types, and targets without SIMD vectors, use std::sort.
+ *
+ * The sort is not stable and the range must not contain NaNs.
+ */
+template <class RandomIt> inline void simd_sort(RandomIt first, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_sort requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count > 1) {
+        Detail::simd_sort_dispatch(std::addressof(*first), count,
+                                   Traits::is_valid_vector_argument<T>());
+    }
+}
+
+// argsorted / sorted_with_index
+namespace Detail
+{
+/**\internal
+ * Returns the position of every entry of \p v in the sorted vector; equal entries keep
+ * the order of their lanes. Every rotation of \p v is compared against \p v once, thus
+ * the cost is linear in V::size() and no permutation has to be known at compile time.
+ */
+template <class V> inline typename V::IndexType sorted_ranks(const V &v)
+{
+    typedef typename V::EntryType T;
+    constexpr std::size_t N = V::size();
+    const V lane(Vc::IndexesFromZero);
+    V rank = V::Zero();
+    for (std::size_t r = 1; r < N; ++r) {
+        const V w = v.rotated(r);
+        // w[i] == v[(i + r) % N] comes from a lower lane iff i + r >= N
+        ++rank(w < v || (w == v && lane >= V(T(N - r))));
+    }
+    return simd_cast<typename V::IndexType>(rank);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the permutation that sorts \p v: `v[argsorted(v)[i]]` is the i-th smallest
+ * entry of \p v. Equal entries keep their relative order.
+ *
+ * Example:
+ * \code
+ * float_v v = ...;
+ * const auto perm = Vc::argsorted(v);
+ * // v.sorted()[i] == v[perm[i]]
+ * \endcode
+ */
+template <class V>
+inline enable_if<Traits::is_simd_vector<V>::value, typename V::IndexType> argsorted(
+    const V &v)
+{
+    typedef typename V::IndexType I;
+    typename I::EntryType perm[I::size()];
+    I(Vc::IndexesFromZero).scatter(perm, Detail::sorted_ranks(v));
+    return I(perm, Vc::Unaligned);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Sorts \p v like Vector::sorted() and applies the same permutation to the companion
+ * vector \p idx (usually `V::IndexType`, but any vector type with the same number of
+ * entries works). Equal entries of \p v keep their relative order.
+ *
+ * Example:
+ * \code
+ * float_v scores = ...;
+ * float_v::IndexType ids = ...;
+ * std::tie(scores, ids) = Vc::sorted_with_index(scores, ids);
+ * \endcode
+ *
+ * \return The pair of the sorted \p v and the permuted \p idx.
+ */
+template <class V, class I>
+inline enable_if<(Traits::is_simd_vector<V>::value && Traits::is_simd_vector<I>::value &&
+                  V::size() == I::size()),
+                 std::pair<V, I>>
+sorted_with_index(const V &v, const I &idx)
+{
+    const auto rank = Detail::sorted_ranks(v);
+    typename V::EntryType values[V::size()];
+    typename I::EntryType indexes[I::size()];
+    v.scatter(values, rank);
+    idx.scatter(indexes, rank);
+    return {V(values, Vc::Unaligned), I(indexes, Vc::Unaligned)};
+}
+
+// simd_argsort
+namespace Detail
+{
+/**\internal
+ * The number of elements below which simd_argsort_impl stops partitioning.
+ */
+constexpr std::size_t SimdArgsortBlock = 16;
+
+/**\internal
+ * simd_sort_partition for keys with a payload of the same size. The payload vector \p PV
+ * is compressed with the same mask.
+ */
+template <class V, class PV, class T, class P>
+inline std::size_t simd_argsort_partition(T *keys, P *payload, std::size_t count, T pivot,
+                                          bool inclusive, T *key_scratch,
+                                          P *payload_scratch)
+{
+    typedef typename V::mask_type M;
+    typedef typename PV::mask_type PM;
+    constexpr std::size_t N = V::size();
+    const V p = pivot;
+    std::size_t left = 0;
+    std::size_t right = 0;
+    std::size_t i = 0;
+    for (; i + N <= count; i += N) {
+        const V v(keys + i, Vc::Unaligned);
+        const PV pv(payload + i, Vc::Unaligned);
+        M k = v < p;
+        if (inclusive) {
+            k |= v == p;
+        }
+        const PM pk = simd_cast<PM>(k);
+        compress(v, k).store(keys + left, Vc::Unaligned);
+        compress(pv, pk).store(payload + left, Vc::Unaligned);
+        compress(v, !k).store(key_scratch + right, Vc::Unaligned);
+        compress(pv, !pk).store(payload_scratch + right, Vc::Unaligned);
+        const std::size_t n = k.count();
+        left += n;
+        right += N - n;
+    }
+    for (; i < count; ++i) {
+        const T x = keys[i];
+        const P y = payload[i];
+        if (x < pivot || (inclusive && x == pivot)) {
+            keys[left] = x;
+            payload[left++] = y;
+        } else {
+            key_scratch[right] = x;
+            payload_scratch[right++] = y;
+        }
+    }
+    std::copy(key_scratch, key_scratch + right, keys + left);
+    std::copy(payload_scratch, payload_scratch + right, payload + left);
+    return left;
+}
+
+template <class T, class P>
+inline void simd_argsort_insertion(T *keys, P *payload, std::size_t count)
+{
+    for (std::size_t i = 1; i < count; ++i) {
+        const T x = keys[i];
+        const P y = payload[i];
+        std::size_t j = i;
+        for (; j > 0 && x < keys[j - 1]; --j) {
+            keys[j] = keys[j - 1];
+            payload[j] = payload[j - 1];
+        }
+        keys[j] = x;
+        payload[j] = y;
+    }
+}
+
+template <class T, class P>
+inline void simd_argsort_fallback(T *keys, P *payload, std::size_t count)
+{
+    std::vector<std::pair<T, P>> pairs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        pairs[i] = {keys[i], payload[i]};
+    }
+    std::sort(pairs.begin(), pairs.end());
+    for (std::size_t i = 0; i < count; ++i) {
+        keys[i] = pairs[i].first;
+        payload[i] = pairs[i].second;
+    }
+}
+
+/**\internal
+ * simd_sort_impl for keys with a payload.
+ */
+template <class V, class PV, class T, class P>
+void simd_argsort_impl(T *keys, P *payload, std::size_t count, T *key_scratch,
+                       P *payload_scratch, int depth)
+{
+    while (count > SimdArgsortBlock) {
+        if (depth-- == 0) {
+            simd_argsort_fallback(keys, payload, count);
+            return;
+        }
+        const T pivot =
+            simd_sort_median(keys[count / 4], keys[count / 2], keys[count / 4 * 3]);
+        std::size_t left = simd_argsort_partition<V, PV>(
+            keys, payload, count, pivot, false, key_scratch, payload_scratch);
+        if (left == 0) {
+            left = simd_argsort_partition<V, PV>(keys, payload, count, pivot, true,
+                                                 key_scratch, payload_scratch);
+            keys += left;
+            payload += left;
+            count -= left;
+        } else if (left < count - left) {
+            simd_argsort_impl<V, PV>(keys, payload, left, key_scratch, payload_scratch,
+                                     depth);
+            keys += left;
+            payload += left;
+            count -= left;
+        } else {
+            simd_argsort_impl<V, PV>(keys + left, payload + left, count - left,
+                                     key_scratch, payload_scratch, depth);
+            count = left;
+        }
+    }
+    simd_argsort_insertion(keys, payload, count);
+}
+
+template <class T, class RandomIt>
+inline void simd_argsort_dispatch(const T *mem, std::size_t count, RandomIt d_first,
+                                  std::false_type)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type P;
+    for (std::size_t i = 0; i < count; ++i) {
+        d_first[i] = P(i);
+    }
+    std::sort(d_first, d_first + count,
+              [&](const P &a, const P &b) { return mem[a] < mem[b]; });
+}
+
+template <class T, class RandomIt>
+inline void simd_argsort_dispatch(const T *mem, std::size_t count, RandomIt d_first,
+                                  std::true_type)
+{
+    typedef unsigned int P;
+    typedef typename SimdSortVector<T>::type V;
+    typedef typename SimdSortVector<P>::type PV;
+    static_assert(V::size() == PV::size(),
+                  "simd_argsort requires key and payload vectors of equal size");
+    if (V::size() == 1 || count > std::numeric_limits<P>::max()) {
+        simd_argsort_dispatch(mem, count, d_first, std::false_type());
+        return;
+    }
+    // the keys are sorted in a copy, the payload are their indexes
+    const std::size_t size = 2 * count + V::size();
+    T *keys = Vc::malloc<T, Vc::AlignOnVector>(size);
+    P *payload = Vc::malloc<P, Vc::AlignOnVector>(size);
+    std::copy(mem, mem + count, keys);
+    for (std::size_t i = 0; i < count; ++i) {
+        payload[i] = P(i);
+    }
+    int depth = 0;
+    for (std::size_t n = count; n > 1; n /= 2) {
+        depth += 2;
+    }
+    simd_argsort_impl<V, PV>(keys, payload, count, keys + count, payload + count, depth);
+    std::copy(payload, payload + count, d_first);
+    Vc::free(keys);
+    Vc::free(payload);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Writes the indexes that sort the contiguous range [\p first, \p last) to \p d_first,
+ * i.e. `first[d_first[i]]` is the i-th smallest element. The input range is not
+ * modified. The order of equal elements is unspecified and the range must not contain
+ * NaNs.
+ *
+ * For 32-bit keys (\c float, \c int, \c uint) the keys are sorted in a copy, together
+ * with their indexes: the quicksort partition of simd_sort packs the key and index
+ * vectors with the same compress mask. Other value types use std::sort on the indexes.
+ *
+ * \return The iterator past the last index written.
+ */
+template <class RandomIt, class RandomIt2>
+inline RandomIt2 simd_argsort(RandomIt first, RandomIt last, RandomIt2 d_first)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_argsort requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    if (count > 0) {
+        Detail::simd_argsort_dispatch(
+            std::addressof(*first), count, d_first,
+            std::integral_constant<bool, (sizeof(T) == 4 &&
+                                          Traits::is_valid_vector_argument<T>::value)>());
+    }
+    return d_first + count;
+}
+
+// simd_nth_element / simd_partial_sort / simd_top_k
+namespace Detail
+{
+/**\internal
+ * Orders values and vectors by \c < (\p Largest = \c false) or by \c > (\p Largest =
+ * \c true), i.e. the first argument is "better" than the second.
+ */
+template <bool Largest> struct SelectionOrder {
+    template <class T> Vc_INTRINSIC auto operator()(const T &a, const T &b) const
+        -> decltype(a < b)
+    {
+        return a < b;
+    }
+};
+template <> struct SelectionOrder<true> {
+    template <class T> Vc_INTRINSIC auto operator()(const T &a, const T &b) const
+        -> decltype(a > b)
+    {
+        return a > b;
+    }
+};
+
+/**\internal
+ * Collects a superset of the \p k best elements of [mem, mem + count), \p k <= \p count,
+ * into a small candidate buffer. The buffer starts with the first \p k elements and the
+ * threshold is the worst of them. Then every vector is compared against the threshold
+ * and rejected as a whole unless one of its entries is better. The accepted entries (and
+ * their indexes if \p WithIndexes) are appended with compress_store. Whenever the
+ * buffer is full, it is reduced to its \p k best elements with std::nth_element, which
+ * tightens the threshold.
+ */
+template <class V, bool Largest, bool WithIndexes> class SimdSelection
+{
+    typedef typename V::EntryType T;
+    typedef typename V::IndexType IV;
+    typedef typename V::mask_type M;
+    typedef typename IV::EntryType I;
+    static constexpr std::size_t N = V::size();
+
+public:
+    SimdSelection(std::size_t k)
+        : k_(k), capacity_(std::max<std::size_t>(4 * k, 64 * N) + N)
+        , values_(capacity_), indexes_(WithIndexes ? capacity_ : 0)
+    {
+    }
+
+    void run(const T *mem, std::size_t count)
+    {
+        const SelectionOrder<Largest> better;
+        std::copy(mem, mem + k_, values_.begin());
+        if (WithIndexes) {
+            for (std::size_t i = 0; i < k_; ++i) {
+                indexes_[i] = I(i);
+            }
+        }
+        size_ = k_;
+        threshold_ = *std::max_element(values_.begin(), values_.begin() + k_, better);
+        V t = threshold_;
+        std::size_t i = k_;
+        for (; i + 4 * N <= count; i += 4 * N) {
+            const V v0(mem + i, Vc::Unaligned);
+            const V v1(mem + i + N, Vc::Unaligned);
+            const V v2(mem + i + 2 * N, Vc::Unaligned);
+            const V v3(mem + i + 3 * N, Vc::Unaligned);
+            const M m0 = better(v0, t);
+            const M m1 = better(v1, t);
+            const M m2 = better(v2, t);
+            const M m3 = better(v3, t);
+            if (Vc_IS_UNLIKELY(any_of(m0 | m1 | m2 | m3))) {
+                // the masks of v1 to v3 may use an outdated threshold, which only adds
+                // candidates
+                append(v0, m0, i);
+                append(v1, m1, i + N);
+                append(v2, m2, i + 2 * N);
+                append(v3, m3, i + 3 * N);
+                t = threshold_;
+            }
+        }
+        for (; i + N <= count; i += N) {
+            const V v(mem + i, Vc::Unaligned);
+            const M m = better(v, t);
+            if (Vc_IS_UNLIKELY(any_of(m))) {
+                append(v, m, i);
+                t = threshold_;
+            }
+        }
+        for (; i < count; ++i) {
+            if (better(mem[i], threshold_)) {
+                if (size_ == capacity_) {
+                    shrink();
+                }
+                values_[size_] = mem[i];
+                if (WithIndexes) {
+                    indexes_[size_] = I(i);
+                }
+                ++size_;
+            }
+        }
+        shrink();
+    }
+
+    /// the k best values, in unspecified order
+    const T *values() const { return values_.data(); }
+    /// the indexes of values()
+    const I *indexes() const { return indexes_.data(); }
+    /// the k-th best value
+    T threshold() const { return threshold_; }
+
+private:
+    void append(const V &v, const M &m, std::size_t offset)
+    {
+        if (size_ + N > capacity_) {
+            shrink();
+        }
+        if (WithIndexes) {
+            compress_store(IV(Vc::IndexesFromZero) + I(offset),
+                           simd_cast<typename IV::mask_type>(m), &indexes_[size_]);
+        }
+        size_ += compress_store(v, m, &values_[size_]);
+    }
+
+    void shrink()
+    {
+        const SelectionOrder<Largest> better;
+        if (WithIndexes) {
+            std::vector<std::size_t> order(size_);
+            for (std::size_t i = 0; i < size_; ++i) {
+                order[i] = i;
+            }
+            std::nth_element(order.begin(), order.begin() + (k_ - 1), order.end(),
+                             [&](std::size_t a, std::size_t b) {
+                                 return better(values_[a], values_[b]);
+                             });
+            std::vector<T> values(k_);
+            std::vector<I> indexes(k_);
+            for (std::size_t i = 0; i < k_; ++i) {
+                values[i] = values_[order[i]];
+                indexes[i] = indexes_[order[i]];
+            }
+            std::copy(values.begin(), values.end(), values_.begin());
+            std::copy(indexes.begin(), indexes.end(), indexes_.begin());
+        } else {
+            std::nth_element(values_.begin(), values_.begin() + (k_ - 1),
+                             values_.begin() + size_, better);
+        }
+        size_ = k_;
+        threshold_ = values_[k_ - 1];
+    }
+
+    const std::size_t k_;
+    const std::size_t capacity_;
+    std::size_t size_ = 0;
+    T threshold_ = T();
+    std::vector<T> values_;
+    std::vector<I> indexes_;
+};
+
+/**\internal
+ * Moves the elements less than or equal to \p t to the front and returns their number.
+ * Since there are few of them, whole vectors are rejected with a single compare and the
+ * rare hits are swapped to the front one by one.
+ */
+template <class V, class T>
+inline std::size_t simd_move_to_front(T *mem, std::size_t count, T t)
+{
+    constexpr std::size_t N = V::size();
+    const V tv = t;
+    std::size_t front = 0;
+    std::size_t i = 0;
+    auto &&visit = [&](std::size_t j) {
+        // front <= j: if mem[front] was part of the current vector, it was rejected
+        // already
+        if (!(t < mem[j])) {
+            std::swap(mem[front++], mem[j]);
+        }
+    };
+    for (; i + N <= count; i += N) {
+        if (Vc_IS_UNLIKELY(any_of(V(mem + i, Vc::Unaligned) <= tv))) {
+            for (std::size_t j = i; j < i + N; ++j) {
+                visit(j);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        visit(i);
+    }
+    return front;
+}
+
+template <class T> inline bool simd_select_vectorizable(std::size_t k, std::size_t count)
+{
+    typedef typename SimdSortVector<T>::type V;
+    typedef typename V::IndexType::EntryType I;
+    return V::size() > 1 && k > 0 && count >= 2 * k &&
+           count >= SimdSortBlock<V>::value &&
+           count < std::size_t(std::numeric_limits<I>::max());
+}
+
+template <class T>
+inline void simd_nth_element_dispatch(T *mem, std::size_t nth, std::size_t count,
+                                      std::true_type)
+{
+    typedef typename SimdSortVector<T>::type V;
+    if (!simd_select_vectorizable<T>(nth + 1, count)) {
+        std::nth_element(mem, mem + nth, mem + count);
+        return;
+    }
+    SimdSelection<V, false, false> selection(nth + 1);
+    selection.run(mem, count);
+    // [mem, mem + front) contains the nth + 1 smallest elements and the duplicates of
+    // the threshold
+    const std::size_t front = simd_move_to_front<V>(mem, count, selection.threshold());
+    std::nth_element(mem, mem + nth, mem + front);
+}
+
+template <class T>
+inline void simd_nth_element_dispatch(T *mem, std::size_t nth, std::size_t count,
+                                      std::false_type)
+{
+    std::nth_element(mem, mem + nth, mem + count);
+}
+
+/**\internal
+ * Writes the indexes and values of the \p k largest elements to \p indexes and \p
+ * values, in unspecified order.
+ */
+template <class T, class P>
+inline void simd_top_k_candidates(const T *mem, std::size_t count, std::size_t k,
+                                  P *indexes, T *values, std::false_type)
+{
+    std::vector<P> order(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        order[i] = P(i);
+    }
+    std::nth_element(order.begin(), order.begin() + (k - 1), order.end(),
+                     [&](const P &a, const P &b) { return mem[b] < mem[a]; });
+    for (std::size_t i = 0; i < k; ++i) {
+        indexes[i] = order[i];
+        values[i] = mem[order[i]];
+    }
+}
+
+template <class T, class P>
+inline void simd_top_k_candidates(const T *mem, std::size_t count, std::size_t k,
+                                  P *indexes, T *values, std::true_type)
+{
+    if (!simd_select_vectorizable<T>(k, count)) {
+        simd_top_k_candidates(mem, count, k, indexes, values, std::false_type());
+        return;
+    }
+    SimdSelection<typename SimdSortVector<T>::type, true, true> selection(k);
+    selection.run(mem, count);
+    std::copy(selection.indexes(), selection.indexes() + k, indexes);
+    std::copy(selection.values(), selection.values() + k, values);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::nth_element for contiguous ranges of arithmetic values.
+ *
+ * A first pass determines the value of the \p nth element: it keeps a small buffer of
+ * candidates together with a running threshold, and rejects whole vectors with a single
+ * compare and \c any_of. Only the (rare) vectors with a better entry are appended to the
+ * buffer with compress_store. A second pass, which again rejects whole vectors, moves the
+ * elements up to that value to the front, where std::nth_element finishes the job.
+ *
+ * This pays off if \p nth is small compared to the size of the range; otherwise, or for
+ * value types without a SIMD vector, std::nth_element is used. The range must not
+ * contain NaNs.
+ */
+template <class RandomIt>
+inline void simd_nth_element(RandomIt first, RandomIt nth, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_nth_element requires a range of arithmetic values");
+    if (nth == last) {
+        return;
+    }
+    Detail::simd_nth_element_dispatch(std::addressof(*first), nth - first,
+                                      std::distance(first, last),
+                                      Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::partial_sort for contiguous ranges of arithmetic values:
+ * simd_nth_element followed by simd_sort of [\p first, \p middle).
+ */
+template <class RandomIt>
+inline void simd_partial_sort(RandomIt first, RandomIt middle, RandomIt last)
+{
+    if (first == middle) {
+        return;
+    }
+    simd_nth_element(first, middle - 1, last);
+    simd_sort(first, middle);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Writes the indexes of the \p k largest elements of the contiguous range [\p first,
+ * \p last) to \p d_first, ordered from the largest to the smallest element. If the range
+ * has fewer than \p k elements, all indexes are written. The input range is not
+ * modified. The order of equal elements is unspecified and the range must not contain
+ * NaNs.
+ *
+ * The candidates are selected as in simd_nth_element, together with their indexes, and
+ * the final \p k candidates are ordered with simd_argsort.
+ *
+ * Example:
+ * \code
+ * std::vector<float> scores = ...;
+ * std::vector<int> best(10);
+ * Vc::simd_top_k(scores.begin(), scores.end(), best.size(), best.begin());
+ * \endcode
+ *
+ * \return The iterator past the last index written.
+ */
+template <class RandomIt, class RandomIt2>
+inline RandomIt2 simd_top_k(RandomIt first, RandomIt last, std::size_t k,
+                            RandomIt2 d_first)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    typedef typename std::iterator_traits<RandomIt2>::value_type P;
+    static_assert(std::is_arithmetic<T>::value,
+                  "simd_top_k requires a range of arithmetic values");
+    const std::size_t count = std::distance(first, last);
+    k = std::min(k, count);
+    if (k == 0) {
+        return d_first;
+    }
+    std::vector<P> candidates(k);
+    std::vector<T> values(k);
+    Detail::simd_top_k_candidates(std::addressof(*first), count, k, candidates.data(),
+                                  values.data(), Traits::is_valid_vector_argument<T>());
+    std::vector<P> order(k);
+    simd_argsort(values.begin(), values.end(), order.begin());
+    for (std::size_t i = 0; i < k; ++i, ++d_first) {
+        *d_first = candidates[order[k - 1 - i]];
+    }
+    return d_first;
+}
+
+// simd_inclusive_scan / simd_exclusive_scan
+namespace Detail
+{
+/**\internal
+ * In-register inclusive scan of \p v (Hillis-Steele). In every step only the entries at
+ * or above the shift distance are combined, thus \p op does not need an identity
+ * element.
+ */
+template <class V, class BinaryOperation>
+Vc_INTRINSIC V simd_scan_vector(const V &v, BinaryOperation &op)
+{
+    typedef typename V::EntryType T;
+    const V lane(Vc::IndexesFromZero);
+    V r = v;
+    for (std::size_t shift = 1; shift < V::size(); shift *= 2) {
+        r(lane >= V(T(shift))) = op(r.shifted(-int(shift)), r);
+    }
+    return r;
+}
+template <class V> Vc_INTRINSIC V simd_scan_vector(const V &v, Plus &)
+{
+    return v.partialSum();
+}
+
+/**\internal
+ * Broadcasts the last entry of \p v.
+ */
+template <class V> Vc_INTRINSIC V simd_scan_broadcast_last(const V &v)
+{
+    return V(typename V::EntryType(v[V::size() - 1]));
+}
+
+/**\internal
+ * Writes the inclusive (or, if \p Exclusive, the exclusive) scan of [mem, mem + count)
+ * with the initial value \p carry to \p out, which may be equal to \p mem. Every vector
+ * is scanned in registers and combined with the carry, i.e. the broadcast total of all
+ * previous elements. Four vectors are processed per iteration: their broadcast totals
+ * are combined among themselves first, so that the carry depends on a single \p op per
+ * iteration. Returns the combination of \p carry and all elements.
+ */
+template <class V, bool Exclusive, class T, class BinaryOperation>
+inline T simd_scan_impl(const T *mem, std::size_t count, T *out, BinaryOperation &op,
+                        T carry)
+{
+    constexpr std::size_t N = V::size();
+    const typename V::mask_type first_lane = V(Vc::IndexesFromZero) == V::Zero();
+    // the prefix of the scan with the carry c in front of the scanned vector s
+    auto &&store = [&](std::size_t offset, const V &c, const V &s) {
+        if (Exclusive) {
+            V r = op(c, s.shifted(-1));
+            r(first_lane) = c;
+            r.store(out + offset, Vc::Unaligned);
+        } else {
+            op(c, s).store(out + offset, Vc::Unaligned);
+        }
+    };
+    V c = carry;
+    std::size_t i = 0;
+    for (; i + 4 * N <= count; i += 4 * N) {
+        const V s0 = simd_scan_vector(V(mem + i, Vc::Unaligned), op);
+        const V s1 = simd_scan_vector(V(mem + i + N, Vc::Unaligned), op);
+        const V s2 = simd_scan_vector(V(mem + i + 2 * N, Vc::Unaligned), op);
+        const V s3 = simd_scan_vector(V(mem + i + 3 * N, Vc::Unaligned), op);
+        const V t0 = simd_scan_broadcast_last(s0);
+        const V t01 = op(t0, simd_scan_broadcast_last(s1));
+        const V t012 = op(t01, simd_scan_broadcast_last(s2));
+        const V t0123 = op(t012, simd_scan_broadcast_last(s3));
+        store(i, c, s0);
+        store(i + N, op(c, t0), s1);
+        store(i + 2 * N, op(c, t01), s2);
+        store(i + 3 * N, op(c, t012), s3);
+        c = op(c, t0123);
+    }
+    for (; i + N <= count; i += N) {
+        const V s = simd_scan_vector(V(mem + i, Vc::Unaligned), op);
+        store(i, c, s);
+        c = op(c, simd_scan_broadcast_last(s));
+    }
+    carry = c[0];
+    for (; i < count; ++i) {
+        const T x = mem[i];
+        if (Exclusive) {
+            out[i] = carry;
+            carry = op(carry, x);
+        } else {
+            carry = op(carry, x);
+            out[i] = carry;
+        }
+    }
+    return carry;
+}
+
+/**\internal
+ * Reduces [mem, mem + count) into \p init in order, i.e. \p op only needs to be
+ * associative: the total of every vector is the last entry of its in-register scan.
+ */
+template <class V, class T, class BinaryOperation>
+inline T simd_scan_reduce(const T *mem, std::size_t count, T init, BinaryOperation &op)
+{
+    constexpr std::size_t N = V::size();
+    std::size_t i = 0;
+    for (; i + N <= count; i += N) {
+        init = op(init, T(simd_scan_vector(V(mem + i, Vc::Unaligned), op)[N - 1]));
+    }
+    for (; i < count; ++i) {
+        init = op(init, mem[i]);
+    }
+    return init;
+}
+
+// the known operations are commutative, thus the reduction may use independent vector
+// accumulators
+template <class V, class T, class BinaryOperation>
+inline T simd_scan_reduce_commutative(const T *mem, std::size_t count, T init,
+                                      BinaryOperation &op)
+{
+    std::size_t i = simd_reduce_impl<V>(count, init, op, [&](std::size_t j) {
+        return V(mem + j, Vc::Unaligned);
+    });
+    for (; i < count; ++i) {
+        init = op(init, mem[i]);
+    }
+    return init;
+}
+template <class V, class T>
+inline T simd_scan_reduce(const T *mem, std::size_t count, T init, Plus &op)
+{
+    return simd_scan_reduce_commutative<V>(mem, count, init, op);
+}
+template <class V, class T>
+inline T simd_scan_reduce(const T *mem, std::size_t count, T init, Multiplies &op)
+{
+    return simd_scan_reduce_commutative<V>(mem, count, init, op);
+}
+template <class V, class T>
+inline T simd_scan_reduce(const T *mem, std::size_t count, T init, Minimum &op)
+{
+    return simd_scan_reduce_commutative<V>(mem, count, init, op);
+}
+template <class V, class T>
+inline T simd_scan_reduce(const T *mem, std::size_t count, T init, Maximum &op)
+{
+    return simd_scan_reduce_commutative<V>(mem, count, init, op);
+}
+
+template <class InputIt, class OutputIt> struct SimdScanTypes {
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    static_assert(std::is_arithmetic<T>::value,
+                  "the SIMD scans require a range of arithmetic values");
+    static_assert(
+        std::is_same<T, typename std::iterator_traits<OutputIt>::value_type>::value,
+        "the SIMD scans require input and output ranges of equal value types");
+    typedef simdize<T> V;
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::inclusive_scan for contiguous ranges of arithmetic values.
+ * \p d_first may be equal to \p first.
+ *
+ * Every vector is scanned in registers (via Vector::partialSum() for addition) and
+ * combined with the carried result of the previous vectors, broadcast to all entries.
+ *
+ * \param first, last The range of values to scan.
+ * \param d_first The beginning of the output range. It must be contiguous and have the
+ *                same value type.
+ * \param op An associative operation. It is called with two vectors as well as with two
+ *           scalars, like the operation of simd_reduce. Floating-point results may differ
+ *           from a sequential scan, because the entries of a vector are combined in a
+ *           tree.
+ * \param init The value that is combined with the first element.
+ *
+ * Example:
+ * \code
+ * std::vector<int> counts = ...;
+ * std::vector<int> offsets(counts.size() + 1);
+ * offsets[0] = 0;
+ * Vc::simd_inclusive_scan(counts.begin(), counts.end(), offsets.begin() + 1);
+ * \endcode
+ *
+ * \return The output iterator past the last element written.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation, class T>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                    BinaryOperation op, T init)
+{
+    typedef Detail::SimdScanTypes<InputIt, OutputIt> Types;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    Detail::simd_scan_impl<typename Types::V, false>(
+        std::addressof(*first), count, std::addressof(*d_first), op2,
+        typename Types::T(init));
+    return d_first + count;
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * The first element is copied to the output unchanged.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                    BinaryOperation op)
+{
+    if (first == last) {
+        return d_first;
+    }
+    const typename std::iterator_traits<InputIt>::value_type init = *first;
+    *d_first = init;
+    return simd_inclusive_scan(first + 1, last, d_first + 1, std::move(op), init);
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums.
+ */
+template <class InputIt, class OutputIt>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    return simd_inclusive_scan(first, last, d_first, Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vectorized variant of std::exclusive_scan for contiguous ranges of arithmetic values.
+ * The i-th output element is the combination of \p init and the first i input elements.
+ * See simd_inclusive_scan for the requirements on the ranges and on \p op.
+ *
+ * \return The output iterator past the last element written.
+ */
+template <class InputIt, class OutputIt, class T, class BinaryOperation>
+inline OutputIt simd_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init,
+                                    BinaryOperation op)
+{
+    typedef Detail::SimdScanTypes<InputIt, OutputIt> Types;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    Detail::simd_scan_impl<typename Types::V, true>(
+        std::addressof(*first), count, std::addressof(*d_first), op2,
+        typename Types::T(init));
+    return d_first + count;
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums, starting with \p init.
+ */
+template <class InputIt, class OutputIt, class T>
+inline OutputIt simd_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    return simd_exclusive_scan(first, last, d_first, init, Detail::Plus());
+}
+
+// scatter_reduce / scatter_add
+namespace Detail
+{
+// returns whether two active lanes share an index, same(r) compares lane i with lane
+// (i + r) % N
+template <bool Masked, class I, class M, class Same>
+inline bool any_index_conflict(const I &, const M &, Same &same)
+{
+    M conflicts(false);
+    Common::unrolled_loop<std::size_t, 1, I::size() / 2 + 1>(
+        [&](std::size_t r) { conflicts |= same(r); });
+    return any_of(conflicts);
+}
+
+#ifdef Vc_IMPL_AVX512
+// AVX-512CD: vpconflictd sets bit j of lane i for every lane j < i with the same index
+template <bool Masked, class M, class Same>
+inline bool any_index_conflict(const fixed_size_simd<int, 8> &idx, const M &mask, Same &)
+{
+    const __m256i conflicts = _mm256_conflict_epi32(simd_cast<AVX2::int_v>(idx).data());
+    if (!Masked) {
+        return !_mm256_testz_si256(conflicts, conflicts);
+    }
+    const __mmask8 k = mask.toInt();
+    return _mm256_mask_test_epi32_mask(k, conflicts, _mm256_set1_epi32(k)) != 0;
+}
+template <bool Masked, class M, class Same>
+inline bool any_index_conflict(const fixed_size_simd<int, 4> &idx, const M &mask, Same &)
+{
+    const __m128i conflicts = _mm_conflict_epi32(simd_cast<SSE::int_v>(idx).data());
+    if (!Masked) {
+        return !_mm_testz_si128(conflicts, conflicts);
+    }
+    const __mmask8 k = mask.toInt();
+    return _mm_mask_test_epi32_mask(k, conflicts, _mm_set1_epi32(k)) != 0;
+}
+#endif  // Vc_IMPL_AVX512
+
+/**\internal
+ * Combines the entries of \p values that share an index in \p idx and applies the
+ * combined values to memory with one gather and one scatter.
+ *
+ * Duplicates are detected in-register by comparing \p idx against its rotations. Every
+ * pair of lanes is at a rotation distance of at most N/2 in one direction, so that many
+ * compares suffice to rule out conflicts (AVX-512CD needs a single vpconflictd). Only if
+ * there is one, all rotations are combined, after which every lane of a group holds the
+ * combination of the whole group. Thus the scatter may write an address several times,
+ * but always with the same value, and needs no mask for the full vector case.
+ */
+template <bool Masked, class V, class BinaryOperation>
+inline void scatter_reduce_impl(typename V::EntryType *mem,
+                                const typename V::IndexType &idx, const V &values,
+                                const typename V::MaskType &mask, BinaryOperation &op)
+{
+    typedef typename V::IndexType I;
+    typedef typename V::MaskType M;
+    constexpr std::size_t N = V::size();
+    // +1 for the lanes in mask, -1 for the others: two lanes are active iff the sum is 2
+    I active(1);
+    if (Masked) {
+        active = -1;
+        active(simd_cast<typename I::MaskType>(mask)) = 1;
+    }
+    // lane i and lane (i + r) % N are active and share their index
+    const auto same = [&](std::size_t r) -> M {
+        const auto eq = idx == idx.rotated(r);
+        return simd_cast<M>(Masked ? eq && active + active.rotated(r) == 2 : eq);
+    };
+
+    V acc = values;
+    if (Vc_IS_UNLIKELY(any_index_conflict<Masked>(idx, mask, same))) {
+        Common::unrolled_loop<std::size_t, 1, N>(
+            [&](std::size_t r) { acc(same(r)) = op(acc, values.rotated(r)); });
+    }
+    if (Masked) {
+        V old = V::Zero();
+        old.gather(mem, idx, mask);
+        op(old, acc).scatter(mem, idx, mask);
+    } else {
+        op(V(mem, idx), acc).scatter(mem, idx);
+    }
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Applies `mem[idx[i]] = op(mem[idx[i]], values[i])` for every entry \p i selected by
+ * \p mask. Unlike Vector::scatter, \p idx may contain duplicates: the entries of
+ * \p values that share an index are combined in-register first and every address is
+ * updated once. This makes histogramming and sparse accumulation vectorizable.
+ *
+ * \param mem The array the indexes refer to.
+ * \param idx The indexes into \p mem. Any vector type with V::size() entries.
+ * \param values The values to combine with memory.
+ * \param mask Selects the entries that take part.
+ * \param op An associative and commutative binary operation, callable with two \p V
+ *           arguments (e.g. std::plus<T>, Vc::Minimum, Vc::Maximum). The entries sharing
+ *           an index are combined with each other before they are combined with memory,
+ *           thus floating-point sums may round differently than a sequential loop.
+ *
+ * Example:
+ * \code
+ * std::vector<float> bins(64);
+ * float_v::IndexType bin = ...;
+ * Vc::scatter_reduce(bins.data(), bin, float_v::One(), std::plus<float>());
+ * \endcode
+ */
+template <class V, class IT, class BinaryOperation>
+inline enable_if<(Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value &&
+                  V::size() == IT::size()),
+                 void>
+scatter_reduce(typename V::EntryType *mem, const IT &idx, const V &values,
+               const typename V::MaskType &mask, BinaryOperation op)
+{
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    const auto idx2 = simd_cast<typename V::IndexType>(idx);
+    if (mask.isFull()) {
+        Detail::scatter_reduce_impl<false>(mem, idx2, values, mask, op2);
+    } else if (!mask.isEmpty()) {
+        Detail::scatter_reduce_impl<true>(mem, idx2, values, mask, op2);
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Combines all entries of \p values with memory.
+ */
+template <class V, class IT, class BinaryOperation>
+inline enable_if<(Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value &&
+                  V::size() == IT::size() &&
+                  !std::is_convertible<BinaryOperation, typename V::MaskType>::value),
+                 void>
+scatter_reduce(typename V::EntryType *mem, const IT &idx, const V &values,
+               BinaryOperation op)
+{
+    scatter_reduce(mem, idx, values, typename V::MaskType(true), op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Adds the entries of \p values selected by \p mask to `mem[idx[i]]`. Duplicate indexes
+ * accumulate. See scatter_reduce.
+ */
+template <class V, class IT>
+inline enable_if<(Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value &&
+                  V::size() == IT::size()),
+                 void>
+scatter_add(typename V::EntryType *mem, const IT &idx, const V &values,
+            const typename V::MaskType &mask)
+{
+    scatter_reduce(mem, idx, values, mask, Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Adds all entries of \p values.
+ */
+template <class V, class IT>
+inline enable_if<(Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value &&
+                  V::size() == IT::size()),
+                 void>
+scatter_add(typename V::EntryType *mem, const IT &idx, const V &values)
+{
+    scatter_reduce(mem, idx, values, typename V::MaskType(true), Detail::Plus());
+}
+
+// simd_histogram
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Binning for simd_histogram: \p nbins bins of equal width covering [\p lo, \p hi).
+ * The bin of a sample is computed with one subtraction, one multiplication and one
+ * conversion. Integral samples are binned in double precision.
+ *
+ * A binning type for simd_histogram provides `size()`, the number of bins, and a call
+ * operator that maps a vector of samples to `V::IndexType` bin numbers, where samples
+ * outside of all bins map to `size()`.
+ */
+template <class T> class UniformBinning
+{
+    typedef typename std::conditional<std::is_floating_point<T>::value, T, double>::type F;
+    F lo, hi, scale;
+    std::size_t nbins;
+
+public:
+    UniformBinning(T lo_, T hi_, std::size_t nbins_)
+        : lo(lo_), hi(hi_), scale(F(nbins_) / (F(hi_) - F(lo_))), nbins(nbins_)
+    {
+    }
+
+    /// Returns the number of bins.
+    std::size_t size() const { return nbins; }
+
+    /// Returns the bin of every entry of \p x, or size() if it is outside [lo, hi).
+    template <class V> typename V::IndexType operator()(const V &x) const
+    {
+        typedef typename V::IndexType I;
+        typedef typename std::conditional<std::is_same<typename V::EntryType, F>::value, V,
+                                          SimdArray<F, V::size()>>::type FV;
+        const FV y = simd_cast<FV>(x);
+        const auto valid = y >= FV(lo) && y < FV(hi);
+        // y < hi may still round up to nbins; invalid entries must not overflow the
+        // conversion
+        I bin = min(simd_cast<I>((iif(valid, y, FV(lo)) - FV(lo)) * FV(scale)),
+                    I(int(nbins - 1)));
+        bin(!simd_cast<typename I::MaskType>(valid)) = I(int(nbins));
+        return bin;
+    }
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Binning for simd_histogram with arbitrary bin edges: bin \c i covers the half-open
+ * interval [edges[i], edges[i + 1]). The edges must be sorted in ascending order. The bin
+ * of a sample is found with a branch-free binary search that processes all entries of a
+ * vector in lockstep, gathering one edge per entry on every level.
+ */
+template <class T> class EdgeBinning
+{
+    std::vector<T> edges;
+    std::size_t top;  // the largest power of two not greater than the number of bins
+
+public:
+    /// Copies the edges from the range [\p first, \p last), which must hold at least two.
+    template <class ForwardIt>
+    EdgeBinning(ForwardIt first, ForwardIt last) : edges(first, last), top(1)
+    {
+        while (top * 2 <= size()) {
+            top *= 2;
+        }
+    }
+
+    /// Returns the number of bins, i.e. one less than the number of edges.
+    std::size_t size() const { return edges.size() - 1; }
+
+    /// Returns the bin of every entry of \p x, or size() if it is outside of all bins.
+    template <class V> typename V::IndexType operator()(const V &x) const
+    {
+        typedef typename V::IndexType I;
+        typedef typename I::MaskType IM;
+        const T *e = edges.data();
+        const int last = int(size());
+        // invariant: e[pos] <= x, for all x inside the edges
+        I pos(0);
+        for (std::size_t step = top; step > 0; step /= 2) {
+            const I next = pos + int(step);
+            const I clamped = min(next, I(last));
+            pos(simd_cast<IM>(V(e, clamped) <= x) && next <= last) = next;
+        }
+        pos(!simd_cast<IM>(x >= V(e[0]) && x < V(e[last]))) = I(last);
+        return pos;
+    }
+};
+
+namespace Detail
+{
+/**\internal
+ * Counts the samples in [\p mem, \p mem + \p count) into \p bins (adding to the current
+ * values). Every lane owns a private sub-histogram, thus the increments of one vector
+ * never collide. The sub-histograms are interleaved (bin-major), so that the N counters of
+ * a popular bin share a cacheline, and have an extra row for the samples outside all bins.
+ *
+ * The counter offsets of four vectors are computed before any counter is incremented:
+ * the independent bin computations overlap and the increments form one long run of
+ * scalar read-modify-writes, which is about twice as fast as interleaving them.
+ */
+template <class V, class RandomIt, class Binning>
+inline void simd_histogram_impl(const typename V::EntryType *mem, std::size_t count,
+                                RandomIt bins, const Binning &binning)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::IndexType I;
+    typedef unsigned Counter;
+    constexpr std::size_t N = V::size();
+    constexpr std::size_t Unroll = 4;
+    const std::size_t nbins = binning.size();
+    std::vector<Counter> sub((nbins + 1) * N);
+    Counter *const counters = sub.data();
+    const I lane(Vc::IndexesFromZero);
+    int offsets[Unroll * N];
+    // stores the counter offsets of the samples in bin to offsets + k * N
+    const auto prepare = [&](I bin, std::size_t k) {
+        bin *= int(N);
+        bin += lane;
+        bin.store(offsets + k * N, Vc::Unaligned);
+    };
+    const auto increment = [&](std::size_t n) {
+        for (std::size_t j = 0; j < n; ++j) {
+            ++counters[offsets[j]];
+        }
+    };
+    // a lane counts at most one sample per vector, flush before a counter can overflow
+    constexpr std::size_t MaxBlock = std::numeric_limits<Counter>::max() / N * N;
+    while (count > 0) {
+        const std::size_t block = std::min(count, MaxBlock);
+        std::size_t i = 0;
+        for (; i + Unroll * N <= block; i += Unroll * N) {
+            for (std::size_t k = 0; k < Unroll; ++k) {
+                prepare(binning(V(mem + i + k * N, Vc::Unaligned)), k);
+            }
+            increment(Unroll * N);
+        }
+        for (; i + N <= block; i += N) {
+            prepare(binning(V(mem + i, Vc::Unaligned)), 0);
+            increment(N);
+        }
+        if (i < block) {
+            const std::size_t rest = block - i;
+            const V x([&](std::size_t j) { return j < rest ? mem[i + j] : T(); });
+            I bin = binning(x);
+            bin(lane >= int(rest)) = int(nbins);
+            prepare(bin, 0);
+            increment(N);
+        }
+        for (std::size_t b = 0; b < nbins; ++b) {
+            Counter sum = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                sum += counters[b * N + j];
+            }
+            bins[b] += sum;
+        }
+        std::fill(sub.begin(), sub.end(), Counter());
+        mem += block;
+        count -= block;
+    }
+}
+
+template <class InputIt> struct SimdHistogramTypes {
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef simdize<T> V;
+    static_assert(Traits::is_simd_vector<V>::value,
+                  "simd_histogram requires an arithmetic value type that is vectorizable");
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Counts the samples in [\p first, \p last) into the bins given by \p binning.
+ *
+ * Every vector of samples is mapped to bin numbers with one call to \p binning and
+ * counted into per-lane sub-histograms, so that the lanes never collide. The
+ * sub-histograms are merged into \p bins at the end.
+ *
+ * Example:
+ * \code
+ * std::vector<float> samples = ...;
+ * std::vector<std::size_t> counts(100);
+ * Vc::simd_histogram(samples.begin(), samples.end(), counts.begin(),
+ *                    Vc::UniformBinning<float>(0.f, 1.f, counts.size()));
+ * \endcode
+ *
+ * \param first The beginning of a contiguous range of samples.
+ * \param last The end of the range.
+ * \param bins A random-access iterator to `binning.size()` counters. The counts are added
+ *             to the current values.
+ * \param binning UniformBinning, EdgeBinning, or a user-defined type with the same
+ *                interface. Samples outside of all bins are not counted.
+ */
+template <class InputIt, class RandomIt, class Binning>
+inline void simd_histogram(InputIt first, InputIt last, RandomIt bins,
+                           const Binning &binning)
+{
+    typedef typename Detail::SimdHistogramTypes<InputIt>::V V;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return;
+    }
+    Detail::simd_histogram_impl<V>(std::addressof(*first), count, bins, binning);
+}
+
+// simd_lower_bound
+namespace Detail
+{
+/**\internal
+ * Searches the keys of \p K vectors in lockstep and stores the lower bounds to \p pos.
+ * All lanes share the remaining length \p n, thus every level is one gather and one
+ * compare per vector without a data-dependent branch, and the K * N loads of a level are
+ * independent of each other. With \p Prefetch, both candidates of the next level are
+ * prefetched while the current level is loaded.
+ */
+template <bool Prefetch, std::size_t K, class V>
+Vc_ALWAYS_INLINE void simd_lower_bound_impl(const typename V::EntryType *mem,
+                                            std::size_t n, const V *keys,
+                                            typename V::IndexType *pos)
+{
+    typedef typename V::IndexType I;
+    typedef typename I::MaskType IM;
+    for (std::size_t k = 0; k < K; ++k) {
+        pos[k] = I(0);
+    }
+    if (n == 0) {
+        return;
+    }
+    // invariant: the lower bound of every entry is in [pos, pos + n]
+    while (n > 1) {
+        const std::size_t half = n / 2;
+        n -= half;
+        for (std::size_t k = 0; k < K; ++k) {
+            I probe = pos[k];
+            probe += int(half);
+            if (Prefetch && n > 1) {
+                for (std::size_t j = 0; j < V::size(); ++j) {
+                    prefetchClose(mem + pos[k][j] + n / 2, VectorAbi::Best<float>());
+                    prefetchClose(mem + probe[j] + n / 2, VectorAbi::Best<float>());
+                }
+            }
+            pos[k](simd_cast<IM>(V(mem, probe) < keys[k])) = probe;
+        }
+    }
+    for (std::size_t k = 0; k < K; ++k) {
+        pos[k](simd_cast<IM>(V(mem, pos[k]) < keys[k])) += 1;
+    }
+}
+
+template <bool Prefetch, class RandomIt, class V>
+inline typename V::IndexType simd_lower_bound(RandomIt first, RandomIt last,
+                                              const V &keys)
+{
+    static_assert(std::is_same<typename std::iterator_traits<RandomIt>::value_type,
+                               typename V::EntryType>::value,
+                  "simd_lower_bound requires the sorted range and the keys to have the "
+                  "same value type");
+    typename V::IndexType pos;
+    const std::size_t n = std::distance(first, last);
+    simd_lower_bound_impl<Prefetch, 1>(n == 0 ? nullptr : std::addressof(*first), n,
+                                       &keys, &pos);
+    return pos;
+}
+
+template <class RandomIt, class KeyIt, class OutputIt>
+inline OutputIt simd_lower_bound(RandomIt first, RandomIt last, KeyIt keys_first,
+                                 KeyIt keys_last, OutputIt out)
+{
+    typedef typename std::iterator_traits<KeyIt>::value_type T;
+    typedef simdize<T> V;
+    typedef typename V::IndexType I;
+    static_assert(Traits::is_simd_vector<V>::value,
+                  "simd_lower_bound requires an arithmetic key type that is vectorizable");
+    static_assert(
+        std::is_same<typename std::iterator_traits<RandomIt>::value_type, T>::value,
+        "simd_lower_bound requires the sorted range and the keys to have the same value "
+        "type");
+    constexpr std::size_t N = V::size();
+    constexpr std::size_t Unroll = 4;
+    const std::size_t count = std::distance(keys_first, keys_last);
+    const std::size_t n = std::distance(first, last);
+    if (count == 0) {
+        return out;
+    }
+    const T *const mem = n == 0 ? nullptr : std::addressof(*first);
+    const T *const k = std::addressof(*keys_first);
+    V keys[Unroll];
+    I pos[Unroll];
+    std::size_t i = 0;
+    // searching several vectors in lockstep keeps more cache misses in flight than
+    // software prefetches do (which only add to the outstanding loads), thus none are
+    // issued here
+    for (; i + Unroll * N <= count; i += Unroll * N) {
+        for (std::size_t u = 0; u < Unroll; ++u) {
+            keys[u] = V(k + i + u * N, Vc::Unaligned);
+        }
+        simd_lower_bound_impl<false, Unroll>(mem, n, keys, pos);
+        for (std::size_t u = 0; u < Unroll; ++u) {
+            for (std::size_t j = 0; j < N; ++j) {
+                *out++ = pos[u][j];
+            }
+        }
+    }
+    for (; i + N <= count; i += N) {
+        keys[0] = V(k + i, Vc::Unaligned);
+        simd_lower_bound_impl<false, 1>(mem, n, keys, pos);
+        for (std::size_t j = 0; j < N; ++j) {
+            *out++ = pos[0][j];
+        }
+    }
+    if (i < count) {
+        const std::size_t rest = count - i;
+        keys[0] = V([&](std::size_t j) { return k[i + (j < rest ? j : 0)]; });
+        simd_lower_bound_impl<false, 1>(mem, n, keys, pos);
+        for (std::size_t j = 0; j < rest; ++j) {
+            *out++ = pos[0][j];
+        }
+    }
+    return out;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the position of the first element in the sorted range [\p first, \p last) that
+ * is not less than the key, for every entry of \p keys (like `std::lower_bound`).
+ *
+ * All entries are searched in lockstep with a branch-free binary search: every level
+ * gathers one element per entry and conditionally advances its position. Thus the
+ * search does not mispredict and the loads of all entries overlap, whereas
+ * `std::lower_bound` waits for one cache miss per level and key.
+ *
+ * \param first The beginning of a contiguous range sorted in ascending order, with the
+ *              same value type as \p keys and less than `INT_MAX` elements.
+ * \param last The end of the sorted range.
+ * \param keys The values to search for.
+ *
+ * \return The offsets from \p first of the lower bounds.
+ */
+template <class RandomIt, class V>
+inline enable_if<Traits::is_simd_vector<V>::value, typename V::IndexType>
+simd_lower_bound(RandomIt first, RandomIt last, const V &keys)
+{
+    return Detail::simd_lower_bound<false>(first, last, keys);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Like above, but additionally prefetches the two elements that may be read on the next
+ * level of the search, for every entry of \p keys. This pays off for sorted ranges that
+ * are much larger than the cache, when one vector of keys is searched at a time.
+ * Request this with a prefetch flag, e.g. Vc::PrefetchDefault, as last argument; its
+ * strides are ignored.
+ */
+template <class RandomIt, class V, class Flags>
+inline enable_if<Traits::is_simd_vector<V>::value, typename V::IndexType>
+simd_lower_bound(RandomIt first, RandomIt last, const V &keys, Flags,
+                 typename Flags::EnableIfPrefetch = nullptr)
+{
+    return Detail::simd_lower_bound<true>(first, last, keys);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Writes the lower bound in the sorted range [\p first, \p last) of every key in
+ * [\p keys_first, \p keys_last) to \p out (the offset from \p first).
+ *
+ * The keys are searched as with the vector overload above, except that four vectors of
+ * keys are searched in lockstep, so that even more cache misses are in flight.
+ *
+ * Example:
+ * \code
+ * std::vector<float> sorted = ...;
+ * std::vector<float> keys = ...;
+ * std::vector<int> positions(keys.size());
+ * Vc::simd_lower_bound(sorted.begin(), sorted.end(), keys.begin(), keys.end(),
+ *                      positions.begin());
+ * \endcode
+ *
+ * \return The end of the output range.
+ */
+template <class RandomIt, class KeyIt, class OutputIt>
+inline OutputIt simd_lower_bound(RandomIt first, RandomIt last, KeyIt keys_first,
+                                 KeyIt keys_last, OutputIt out)
+{
+    return Detail::simd_lower_bound(first, last, keys_first, keys_last, out);
+}
+
+// parallel_simd_for_each
+namespace Detail
+{
+constexpr std::size_t gcd(std::size_t a, std::size_t b)
+{
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+/**\internal
+ * Splits a range of \p n objects of \p Sizeof Bytes, starting at \p addr, into chunks
+ * for the ThreadPool. All chunk boundaries except the first and last are a multiple of
+ * \p VSize objects apart and, if possible, on a cacheline boundary. Consequently, no two
+ * chunks write to the same cacheline.
+ */
+template <std::size_t Sizeof, std::size_t VSize> class ParallelChunks
+{
+    // the alignment of Vc::AlignOnCacheline, see Vc::malloc
+    static constexpr std::size_t Cacheline = 64;
+    // the number of objects after which the address is on a cacheline boundary again
+    static constexpr std::size_t ObjectsPerLine = Cacheline / gcd(Cacheline, Sizeof);
+    static constexpr std::size_t Granularity =
+        ObjectsPerLine / gcd(ObjectsPerLine, VSize) * VSize;
+    // a chunk should be large enough to amortize the scheduling overhead
+    static constexpr std::size_t MinChunkBytes = 16 * 1024;
+    static constexpr std::size_t MinChunk =
+        (MinChunkBytes / Sizeof + Granularity - 1) / Granularity * Granularity;
+
+    std::size_t n;
+    std::size_t head = 0;
+    std::size_t chunk;
+
+public:
+    ParallelChunks(const void *addr, std::size_t n_, std::size_t threads) : n(n_)
+    {
+        const auto misalignment = reinterpret_cast<std::uintptr_t>(addr) % Cacheline;
+        for (std::size_t i = 0; i < ObjectsPerLine; ++i) {
+            if ((misalignment + i * Sizeof) % Cacheline == 0) {
+                head = std::min(i, n);
+                break;
+            }
+        }
+        // aim for several chunks per thread so that work stealing can balance the load
+        const std::size_t target = (n - head + 4 * threads - 1) / (4 * threads);
+        chunk = std::max(std::size_t(MinChunk),
+                         (target + Granularity - 1) / Granularity * Granularity);
+    }
+
+    std::size_t count() const
+    {
+        return n <= head + chunk ? 1 : (n - head + chunk - 1) / chunk;
+    }
+
+    std::size_t begin(std::size_t i) const
+    {
+        return i == 0 ? 0 : std::min(n, head + i * chunk);
+    }
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_for_each.
+ *
+ * The range is split into chunks that are processed concurrently by the threads of \p
+ * pool. Each chunk is processed via `simd_for_each(policy, ...)`. Chunk boundaries are
+ * a multiple of the vector width apart and placed on cacheline boundaries (if the
+ * alignment of the value type permits), thus no two threads ever write to the same
+ * cacheline.
+ *
+ * \p f is copied for every chunk and the copies are called concurrently. The range must
+ * be contiguous.
+ *
+ * \param pool The ThreadPool to execute on.
+ * \param policy Either Vc::ScalarRemainder or Vc::AlignedMasked.
+ * \param first The beginning of the range.
+ * \param last The end of the range.
+ * \param f The function to call. See simd_for_each for the accepted signatures.
+ */
+template <class Policy, class InputIt, class UnaryFunction>
+inline void parallel_simd_for_each(ThreadPool &pool, Policy policy, InputIt first,
+                                   InputIt last, UnaryFunction f)
+{
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    using V = simdize<ValueType>;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return;
+    }
+    const Detail::ParallelChunks<sizeof(ValueType), V::Size> chunks(
+        std::addressof(*first), n, pool.size());
+    pool.run(chunks.count(), [&](std::size_t i) {
+        simd_for_each(policy, first + chunks.begin(i), first + chunks.begin(i + 1), f);
+    });
+}
+
+/**
+ * \ingroup Utilities
+ * Multi-threaded variant of simd_for_each, using ThreadPool::global().
+ */
+template <class Policy, class InputIt, class UnaryFunction>
+inline void parallel_simd_for_each(Policy policy, InputIt first, InputIt last,
+                                   UnaryFunction f)
+{
+    parallel_simd_for_each(ThreadPool::global(), policy, first, last, std::move(f));
+}
+
+/**
+ * \ingroup Utilities
+ * Multi-threaded variant of simd_for_each_n.
+ */
+template <class Policy, class InputIt, class UnaryFunction>
+inline void parallel_simd_for_each_n(ThreadPool &pool, Policy policy, InputIt first,
+                                     std::size_t count, UnaryFunction f)
+{
+    parallel_simd_for_each(pool, policy, first, first + count, std::move(f));
+}
+
+/**
+ * \ingroup Utilities
+ * Multi-threaded variant of simd_for_each_n, using ThreadPool::global().
+ */
+template <class Policy, class InputIt, class UnaryFunction>
+inline void parallel_simd_for_each_n(Policy policy, InputIt first, std::size_t count,
+                                     UnaryFunction f)
+{
+    parallel_simd_for_each(ThreadPool::global(), policy, first, first + count,
+                           std::move(f));
+}
+
+// parallel_simd_inclusive_scan / parallel_simd_exclusive_scan
+namespace Detail
+{
+/**\internal
+ * Two-pass parallel scan: the first pass reduces every chunk except the last one, the
+ * chunk totals are combined sequentially into the initial value of every chunk, and the
+ * second pass scans all chunks with their initial value. The first chunk of an inclusive
+ * scan without \p init starts with its first element.
+ */
+template <bool Exclusive, class T, class BinaryOperation>
+inline void parallel_simd_scan(ThreadPool &pool, const T *mem, std::size_t count, T *out,
+                               BinaryOperation &op, const T *init)
+{
+    typedef simdize<T> V;
+    const ParallelChunks<sizeof(T), V::Size> chunks(out, count, pool.size());
+    const std::size_t n = chunks.count();
+    std::vector<T> offsets(n);
+    // offsets[i] holds the total of chunk i after the first pass
+    if (n > 1) {
+        pool.run(n - 1, [&](std::size_t i) {
+            const std::size_t begin = chunks.begin(i);
+            const std::size_t end = chunks.begin(i + 1);
+            offsets[i] =
+                simd_scan_reduce<V>(mem + begin + 1, end - begin - 1, mem[begin], op);
+        });
+    }
+    // offsets[i] becomes the initial value of chunk i (except for chunk 0 without init)
+    T carry = init ? *init : offsets[0];
+    for (std::size_t i = init ? 0 : 1; i < n; ++i) {
+        const T total = offsets[i];
+        offsets[i] = carry;
+        carry = op(carry, total);
+    }
+    pool.run(n, [&](std::size_t i) {
+        const std::size_t begin = chunks.begin(i);
+        const std::size_t end = chunks.begin(i + 1);
+        if (i == 0 && !init) {
+            out[0] = mem[0];
+            simd_scan_impl<V, false>(mem + 1, end - 1, out + 1, op, out[0]);
+        } else {
+            simd_scan_impl<V, Exclusive>(mem + begin, end - begin, out + begin, op,
+                                         offsets[i]);
+        }
+    });
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_inclusive_scan.
+ *
+ * The range is split into chunks as for parallel_simd_for_each. In a first pass the
+ * threads of \p pool reduce their chunks, then the chunk totals are combined into the
+ * initial value of every chunk, and a second pass scans all chunks concurrently. Thus,
+ * the input is read twice and \p op must be associative. For Vc::Minimum, Vc::Maximum,
+ * and addition and multiplication the first pass uses the simd_reduce kernel, which also
+ * assumes commutativity.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation, class T>
+inline OutputIt parallel_simd_inclusive_scan(ThreadPool &pool, InputIt first,
+                                             InputIt last, OutputIt d_first,
+                                             BinaryOperation op, T init)
+{
+    typedef typename Detail::SimdScanTypes<InputIt, OutputIt>::T ValueType;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    const ValueType init2 = init;
+    Detail::parallel_simd_scan<false>(pool, std::addressof(*first), count,
+                                      std::addressof(*d_first), op2, &init2);
+    return d_first + count;
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * The first element is copied to the output unchanged.
+ */
+template <class InputIt, class OutputIt, class BinaryOperation>
+inline OutputIt parallel_simd_inclusive_scan(ThreadPool &pool, InputIt first,
+                                             InputIt last, OutputIt d_first,
+                                             BinaryOperation op)
+{
+    typedef typename Detail::SimdScanTypes<InputIt, OutputIt>::T ValueType;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    Detail::parallel_simd_scan<false>(pool, std::addressof(*first), count,
+                                      std::addressof(*d_first), op2,
+                                      static_cast<const ValueType *>(nullptr));
+    return d_first + count;
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums.
+ */
+template <class InputIt, class OutputIt>
+inline OutputIt parallel_simd_inclusive_scan(ThreadPool &pool, InputIt first,
+                                             InputIt last, OutputIt d_first)
+{
+    return parallel_simd_inclusive_scan(pool, first, last, d_first, Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums, using ThreadPool::global().
+ */
+template <class InputIt, class OutputIt>
+inline OutputIt parallel_simd_inclusive_scan(InputIt first, InputIt last,
+                                             OutputIt d_first)
+{
+    return parallel_simd_inclusive_scan(ThreadPool::global(), first, last, d_first,
+                                        Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_exclusive_scan. See parallel_simd_inclusive_scan for
+ * the algorithm.
+ */
+template <class InputIt, class OutputIt, class T, class BinaryOperation>
+inline OutputIt parallel_simd_exclusive_scan(ThreadPool &pool, InputIt first,
+                                             InputIt last, OutputIt d_first, T init,
+                                             BinaryOperation op)
+{
+    typedef typename Detail::SimdScanTypes<InputIt, OutputIt>::T ValueType;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return d_first;
+    }
+    auto &&op2 = Detail::simd_reduce_operation(op);
+    const ValueType init2 = init;
+    Detail::parallel_simd_scan<true>(pool, std::addressof(*first), count,
+                                     std::addressof(*d_first), op2, &init2);
+    return d_first + count;
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums, starting with \p init.
+ */
+template <class InputIt, class OutputIt, class T>
+inline OutputIt parallel_simd_exclusive_scan(ThreadPool &pool, InputIt first,
+                                             InputIt last, OutputIt d_first, T init)
+{
+    return parallel_simd_exclusive_scan(pool, first, last, d_first, init, Detail::Plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \overload
+ * Computes the prefix sums, starting with \p init, using ThreadPool::global().
+ */
+template <class InputIt, class OutputIt, class T>
+inline OutputIt parallel_simd_exclusive_scan(InputIt first, InputIt last,
+                                             OutputIt d_first, T init)
+{
+    return parallel_simd_exclusive_scan(ThreadPool::global(), first, last, d_first, init,
+                                        Detail::Plus());
+}
+
+// parallel_simd_histogram
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_histogram.
+ *
+ * The range is split into one slice per thread of \p pool. Every thread counts its slice
+ * into a private copy of the histogram (with its own per-lane sub-histograms), and the
+ * copies are added to \p bins at the end.
+ */
+template <class InputIt, class RandomIt, class Binning>
+inline void parallel_simd_histogram(ThreadPool &pool, InputIt first, InputIt last,
+                                    RandomIt bins, const Binning &binning)
+{
+    typedef typename Detail::SimdHistogramTypes<InputIt>::V V;
+    const std::size_t count = std::distance(first, last);
+    if (count == 0) {
+        return;
+    }
+    const auto *mem = std::addressof(*first);
+    const std::size_t nbins = binning.size();
+    // a slice of less than MinSlice samples does not amortize its private histogram
+    const std::size_t MinSlice = 16 * 1024 + 16 * nbins;
+    const std::size_t threads =
+        std::max(std::size_t(1), std::min(pool.size(), count / MinSlice));
+    if (threads == 1) {
+        Detail::simd_histogram_impl<V>(mem, count, bins, binning);
+        return;
+    }
+    // slice boundaries are a multiple of V::size() apart
+    const std::size_t slice = (count / threads + V::size() - 1) / V::size() * V::size();
+    std::vector<std::vector<std::size_t>> partial(threads);
+    pool.run(threads, [&](std::size_t t) {
+        const std::size_t begin = std::min(count, t * slice);
+        const std::size_t end = t + 1 == threads ? count : std::min(count, begin + slice);
+        partial[t].assign(nbins, 0);
+        Detail::simd_histogram_impl<V>(mem + begin, end - begin, partial[t].begin(),
+                                       binning);
+    });
+    for (std::size_t b = 0; b < nbins; ++b) {
+        std::size_t sum = 0;
+        for (std::size_t t = 0; t < threads; ++t) {
+            sum += partial[t][b];
+        }
+        bins[b] += sum;
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * Multi-threaded variant of simd_histogram, using ThreadPool::global().
+ */
+template <class InputIt, class RandomIt, class Binning>
+inline void parallel_simd_histogram(InputIt first, InputIt last, RandomIt bins,
+                                    const Binning &binning)
+{
+    parallel_simd_histogram(ThreadPool::global(), first, last, bins, binning);
+}
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
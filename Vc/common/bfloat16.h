@@ -0,0 +1,103 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_BFLOAT16_H_
+#define VC_COMMON_BFLOAT16_H_
+
+#include <cstdint>
+#include "float16.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar float <-> bfloat16 conversions {{{1
+/**\internal
+ * Converts the bfloat16 bit pattern \p h to float. bfloat16 is the upper half of a float,
+ * thus the conversion is exact.
+ */
+Vc_INTRINSIC Vc_CONST float bfloat16_to_float(std::uint16_t h)
+{
+    return bits_to_float(std::uint32_t(h) << 16);
+}
+
+/**\internal
+ * Converts \p x to the bfloat16 bit pattern with round to nearest even. NaNs keep their
+ * sign and upper payload bits and are quieted.
+ */
+Vc_INTRINSIC Vc_CONST std::uint16_t float_to_bfloat16(float x)
+{
+    const std::uint32_t f = float_bits(x);
+    if ((f & 0x7fffffffu) > 0x7f800000u) {  // nan
+        return static_cast<std::uint16_t>((f >> 16) | 0x40u);
+    }
+    return static_cast<std::uint16_t>((f + 0x7fffu + ((f >> 16) & 1u)) >> 16);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile bfloat16.h <Vc/Vc>
+ *
+ * A bfloat16 (brain floating point) storage type: the upper 16 bits of an IEEE 754
+ * binary32.
+ *
+ * Like Vc::float16, bfloat16 only stores values. Vc::float_v (and SimdArray<float, N>) can
+ * load from and store to `bfloat16` arrays, honoring the Vc::Aligned, Vc::Unaligned, and
+ * Vc::Streaming flags, and can gather from them. No special instructions are required:
+ * widening to float is a 16-bit shift and narrowing rounds to nearest even with integer
+ * operations on the float bit patterns.
+ */
+class bfloat16
+{
+public:
+    bfloat16() = default;
+    Vc_INTRINSIC bfloat16(float x) : bits(Detail::float_to_bfloat16(x)) {}
+    Vc_INTRINSIC operator float() const { return Detail::bfloat16_to_float(bits); }
+
+    /// Returns a bfloat16 object with the bit pattern \p x.
+    static Vc_INTRINSIC bfloat16 fromBits(std::uint16_t x)
+    {
+        bfloat16 r;
+        r.bits = x;
+        return r;
+    }
+    /// Returns the bit pattern.
+    Vc_INTRINSIC std::uint16_t toBits() const { return bits; }
+
+private:
+    std::uint16_t bits;
+};
+static_assert(sizeof(bfloat16) == 2, "bfloat16 must not have padding");
+
+}  // namespace Vc
+
+#endif  // VC_COMMON_BFLOAT16_H_
+
+// vim: foldmethod=marker
@@ -36,6 +36,12 @@ namespace Common
 
 alignas(64) extern unsigned int RandomState[];
 alignas(32) extern const unsigned int AllBitsSet[8];
+/**\internal
+ * Lane permutations for left-packing (compressing) up to 8 entries. Entry \c k holds the
+ * indexes of the bits set in \c k, followed by the indexes of the bits not set in \c k.
+ * The indexes are stored in 4-bit nibbles, starting with the least significant nibble.
+ */
+alignas(64) extern const unsigned int CompressIndexes[256];
 
 }  // namespace Common
 }  // namespace Vc
@@ -0,0 +1,247 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DISPATCH_H_
+#define VC_COMMON_DISPATCH_H_
+
+#include <atomic>
+#include <cstdlib>
+#include <utility>
+#include "../global.h"
+#include "macros.h"
+
+#if defined(Vc_GCC) && Vc_GCC >= 0x40400 && defined __SSE__
+#define Vc_TARGET_NO_SIMD __attribute__((target("no-sse2,no-avx")))
+#else
+#define Vc_TARGET_NO_SIMD
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Ranks a kernel variant compiled with the ImplementationT \p features for the CPU the
+ * code is executing on. The rank grows with the Vc::Implementation and then with the
+ * number of extra instructions the variant uses. Returns -1 if the variant would not run,
+ * i.e. the CPU does not support its implementation (see isImplementationSupported()) or
+ * the extra instructions it requires.
+ *
+ * Implemented in src/support_x86.cpp.
+ */
+int Vc_VDECL dispatchRank(unsigned int features);
+
+template <unsigned int Features>
+constexpr unsigned int implementation_features(ImplementationT<Features>)
+{
+    return Features;
+}
+
+template <class D> class DispatchRegistrar;
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch>
+ *
+ * Calls a kernel through a function pointer that points to the variant compiled for the
+ * best Vc::Implementation the executing CPU supports.
+ *
+ * Vc::Implementation is a compile-time choice. To ship a single binary to CPUs with
+ * different SIMD extensions, compile the kernel translation unit several times with
+ * different `Vc_IMPL` values and register each variant with Vc_DISPATCH_VARIANT. The
+ * CMake macro `vc_compile_for_all_implementations` (cmake/VcMacros.cmake) generates the
+ * copies and their compile flags:
+ * \code
+ * vc_compile_for_all_implementations(_srcs kernels.cpp ONLY SSE2 SSE4_2 AVX AVX2+FMA+BMI2)
+ * add_executable(app main.cpp ${_srcs})
+ * \endcode
+ *
+ * The dispatcher type is declared in a header shared by the kernel and its callers:
+ * \code
+ * // kernels.h
+ * using saxpy = Vc::Dispatcher<struct saxpy_tag, void(float, const float *, float *, std::size_t)>;
+ *
+ * // kernels.cpp, compiled once per Vc_IMPL
+ * #include <Vc/Vc>
+ * #include <Vc/dispatch>
+ * #include "kernels.h"
+ * static void saxpy_impl(float a, const float *x, float *y, std::size_t n) { ... }
+ * Vc_DISPATCH_VARIANT(saxpy, saxpy_impl);
+ *
+ * // main.cpp, compiled for the baseline target
+ * saxpy::call(2.f, x, y, n);
+ * \endcode
+ *
+ * The variant is selected on the first call with Vc::bestImplementationSupported() and
+ * Vc::extraInstructionsSupported() and the resulting function pointer is cached; every
+ * later call is a single indirect call. If no registered variant runs on the CPU the
+ * program aborts.
+ *
+ * Some rules keep the variants from mixing:
+ * \li The signature must not contain Vc types. Vc::float_v and SimdArray have a different
+ *     size and layout in each variant.
+ * \li The kernel functions need internal linkage (`static` or an unnamed namespace), so
+ *     that the linker cannot merge variants. The same holds for helper functions and
+ *     templates of your own. The function templates of %Vc are distinct per variant
+ *     already: with GCC and clang Vc::Vector and Vc::Mask carry the implementation in
+ *     their mangled names.
+ * \li Do not call the dispatcher from a kernel translation unit and do not call kernels
+ *     before `main` starts: registration happens during dynamic initialization of the
+ *     kernel translation units.
+ * \li Link the kernel objects directly (as above). When they are part of a static library,
+ *     nothing references them and the linker drops the registration.
+ *
+ * \tparam Tag A type that makes different kernels with equal signatures distinct.
+ * \tparam F The function type of the kernel.
+ */
+template <class Tag, class F> class Dispatcher;
+
+template <class Tag, class R, class... Args> class Dispatcher<Tag, R(Args...)>
+{
+public:
+    using function_type = R(Args...);
+
+    /// Calls the selected variant with \p args.
+    static Vc_ALWAYS_INLINE R call(Args... args)
+    {
+        return pointer.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+    }
+
+    /// Returns the selected variant.
+    static function_type *get()
+    {
+        function_type *f = pointer.load(std::memory_order_relaxed);
+        return f == &resolve ? select() : f;
+    }
+
+    /// Returns the Vc::Implementation of the selected variant.
+    static Implementation implementation()
+    {
+        const Node *n = best();
+        return n ? static_cast<Implementation>(n->features & ImplementationMask)
+                 : ScalarImpl;
+    }
+
+private:
+    friend class Detail::DispatchRegistrar<Dispatcher>;
+
+    struct Node {
+        function_type *function;
+        unsigned int features;
+        const Node *next;
+    };
+
+    static const Node *best()
+    {
+        const Node *r = nullptr;
+        int rank = -1;
+        for (const Node *n = head; n; n = n->next) {
+            const int nrank = Detail::dispatchRank(n->features);
+            if (nrank > rank) {
+                rank = nrank;
+                r = n;
+            }
+        }
+        return r;
+    }
+
+    static function_type *select()
+    {
+        const Node *n = best();
+        if (!n) {
+            // no variant that runs on this CPU was linked in
+            std::abort();
+        }
+        pointer.store(n->function, std::memory_order_relaxed);
+        return n->function;
+    }
+
+    // the initial value of pointer: selects on the first call. Concurrent first calls
+    // select the same variant, therefore the race on pointer is benign.
+    static R resolve(Args... args) { return select()(std::forward<Args>(args)...); }
+
+    static std::atomic<function_type *> pointer;
+    static const Node *head;
+};
+
+template <class Tag, class R, class... Args>
+std::atomic<R (*)(Args...)> Dispatcher<Tag, R(Args...)>::pointer{
+    &Dispatcher<Tag, R(Args...)>::resolve};
+template <class Tag, class R, class... Args>
+const typename Dispatcher<Tag, R(Args...)>::Node *Dispatcher<Tag, R(Args...)>::head =
+    nullptr;
+
+namespace Detail
+{
+/**\internal
+ * A static object of this type adds a kernel variant to the list of \p D. The constructor
+ * runs before `main` from the kernel translation units, which are compiled with e.g. AVX2
+ * flags. It is therefore not inlined into their initialization code and, with GCC,
+ * compiled without SIMD instructions.
+ */
+template <class D> class DispatchRegistrar
+{
+public:
+    Vc_NEVER_INLINE Vc_TARGET_NO_SIMD DispatchRegistrar(typename D::function_type *f,
+                                                        unsigned int features)
+        : node{f, features, D::head}
+    {
+        D::head = &node;
+    }
+
+private:
+    typename D::Node node;
+};
+}  // namespace Detail
+}  // namespace Vc
+
+#undef Vc_TARGET_NO_SIMD
+
+#define Vc_DISPATCH_CONCAT_IMPL_(a_, b_) a_##b_
+#define Vc_DISPATCH_CONCAT_(a_, b_) Vc_DISPATCH_CONCAT_IMPL_(a_, b_)
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch>
+ *
+ * Registers \p function_ as the variant of the Vc::Dispatcher type \p dispatcher_ for the
+ * Vc::CurrentImplementation of the translation unit. Use it at namespace scope.
+ */
+#define Vc_DISPATCH_VARIANT(dispatcher_, function_)                                      \
+    namespace                                                                            \
+    {                                                                                    \
+    const ::Vc::Detail::DispatchRegistrar<dispatcher_> Vc_DISPATCH_CONCAT_(              \
+        Vc_dispatch_registrar_, __LINE__)(                                               \
+        &function_,                                                                      \
+        ::Vc::Detail::implementation_features(::Vc::CurrentImplementation()));           \
+    }                                                                                    \
+    static_assert(true, "")
+
+#endif  // VC_COMMON_DISPATCH_H_
+
+// vim: foldmethod=marker
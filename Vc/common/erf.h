@@ -0,0 +1,265 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// ErfTraits {{{1
+/**\internal
+ * Offsets of the coefficients in c_erf<T> (highest degree first) and the range limits.
+ */
+template <class T> struct ErfTraits;
+template <> struct ErfTraits<float> {
+    // erf(x) = x · P(x²) / Q(x²) for |x| ≤ 4, minimax relative error 2⁻²⁴·²
+    // erfc(x) = e^(-x²) · P(x) / Q(x) for 0 ≤ x ≤ 10.1, minimax relative error 2⁻²⁶·⁴
+    enum { ErfP = 0, ErfQ = 6, FastErfcP = 12, FastErfcQ = 17, FastErfcEnd = 23 };
+    enum { FastErfcSteps = 0 };  // see erfc_rational
+    static constexpr float erf_saturation() { return 4.f; }  // erf(x) rounds to 1 above
+    static constexpr float erfc_underflow() { return 10.1f; }
+};
+template <> struct ErfTraits<double> {
+    // erf(x) = x · P(x²) for |x| < ½, minimax relative error 2⁻⁵⁷·⁸
+    // erfc(x) = e^(-x²) · P(x) / Q(x) for 0 ≤ x ≤ 27.3 with a minimax relative error of
+    // 2⁻⁵³·⁹ (FastErfc) and for ½ ≤ x ≤ 27.3 with 2⁻⁵⁶ (Erfc)
+    enum {
+        ErfSmall = 0,
+        FastErfcP = 9,
+        FastErfcQ = 19,
+        FastErfcEnd = 30,
+        ErfcP = 30,
+        ErfcQ = 42,
+        End = 55
+    };
+    enum { FastErfcSteps = 6, ErfcSteps = 12 };  // see erfc_rational
+    static constexpr double erf_saturation() { return 6.; }
+    static constexpr double erfc_underflow() { return 27.3; }
+};
+
+// exp_minus_square {{{1
+/**\internal
+ * Returns e^(-x²). The rounding error of x² would be amplified by x² (e.g. 745 ulp close
+ * to the underflow of double), therefore it is computed exactly and applied to the result.
+ */
+template <class V> Vc_INTRINSIC V exp_minus_square(const V &x)
+{
+    V lo;
+    const V hi = two_prod(x, x, lo);
+    const V e = exp(-hi);
+    return madd(-e, lo, e);  // e^(-hi - lo) ≈ e^-hi · (1 - lo)
+}
+
+// horner_compensated {{{1
+/**\internal
+ * Like horner, but the last \p steps steps also accumulate their rounding errors in \p err
+ * (compensated Horner scheme). The polynomial is the unevaluated sum of the return value
+ * and \p err, which is accurate to about one ulp even where the terms grow with \p x and
+ * the plain Horner scheme loses several bits.
+ */
+template <class V, class F>
+Vc_INTRINSIC V horner_compensated(const V &x, const F &coeff, int first, int last,
+                                  int steps, V &err)
+{
+    const int split = std::max(first + 1, last - steps);
+    V p = horner(x, coeff, first, split);
+    err = V::Zero();
+    for (int i = split; i < last; ++i) {
+        V prod_err, sum_err;
+        p = two_sum(two_prod(p, x, prod_err), coeff(i), sum_err);
+        err = madd(err, x, prod_err + sum_err);
+    }
+    return p;
+}
+
+// erfc_rational {{{1
+/**\internal
+ * Returns e^(-x²) · P(x) / Q(x) for x ≥ 0, with the coefficients of P in [p, q[ and of Q in
+ * [q, end[. The terms of P and Q grow with x, therefore the last \p steps Horner steps are
+ * compensated and the remainder of the division is corrected for.
+ */
+template <class V, class F>
+Vc_INTRINSIC V erfc_rational(const V &x, const F &coeff, int p, int q, int end, int steps)
+{
+    V p_err, q_err, rq_err;
+    const V ps = horner_compensated(x, coeff, p, q, steps, p_err);
+    const V qs = horner_compensated(x, coeff, q, end, steps, q_err);
+    const V r = ps / qs;
+    const V rq = two_prod(r, qs, rq_err);
+    // P / Q = r + (P - r · Q) / Q, where ps - rq is exact
+    const V g = r + ((ps - rq) - rq_err + p_err - r * q_err) / qs;
+    return exp_minus_square(x) * g;
+}
+//}}}1
+}  // namespace Detail
+
+// erf {{{1
+/**\internal
+ * float, fast: a single rational approximation, without exp.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> erf(Vector<float, Abi> x,
+                                                         Precision::FastTag)
+{
+    using V = Vector<float, Abi>;
+    using C = Detail::Const<float, Abi>;
+    using Traits = Detail::ErfTraits<float>;
+    const auto coeff = [](int i) { return C::erfCoeff(i); };
+    const V z = x * x;
+    V r = x * Detail::polynomial<Traits::ErfP, Traits::ErfQ>(z, coeff) /
+          Detail::polynomial<Traits::ErfQ, Traits::FastErfcP>(z, coeff);
+    r(abs(x) > V(Traits::erf_saturation())) = copysign(V::One(), x);
+    return r;
+}
+
+/**\internal
+ * double: a polynomial for |x| < ½ and 1 - erfc(|x|) above, which cancels by less than one
+ * bit.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> erf(Vector<double, Abi> x,
+                                                           Precision::FastTag)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+    using Traits = Detail::ErfTraits<double>;
+    const auto coeff = [](int i) { return C::erfCoeff(i); };
+    const V ax = abs(x);
+    V r = copysign(V::One() - Detail::erfc_rational(ax, coeff, Traits::FastErfcP,
+                                                    Traits::FastErfcQ,
+                                                    Traits::FastErfcEnd,
+                                                    Traits::FastErfcSteps),
+                   x);
+    r(ax > V(Traits::erf_saturation())) = copysign(V::One(), x);
+    r(ax < V(0.5)) =
+        x * Detail::polynomial<Traits::ErfSmall, Traits::FastErfcP>(x * x, coeff);
+    return r;
+}
+
+/**\internal
+ * float, accurate: the fast double implementation rounds correctly in almost all cases.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> erf(Vector<float, Abi> x,
+                                                         Precision::AccurateTag)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(erf(simd_cast<D>(x), Precision::Fast));
+}
+
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> erf(Vector<double, Abi> x,
+                                                           Precision::AccurateTag)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+    using Traits = Detail::ErfTraits<double>;
+    const auto coeff = [](int i) { return C::erfCoeff(i); };
+    const V ax = abs(x);
+    V r = copysign(V::One() - Detail::erfc_rational(ax, coeff, Traits::ErfcP,
+                                                    Traits::ErfcQ, Traits::End,
+                                                    Traits::ErfcSteps),
+                   x);
+    r(ax > V(Traits::erf_saturation())) = copysign(V::One(), x);
+    r(ax < V(0.5)) =
+        x * Detail::polynomial<Traits::ErfSmall, Traits::FastErfcP>(x * x, coeff);
+    return r;
+}
+
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> erf(Vector<T, Abi> x,
+                                               Precision::DefaultTag = {})
+{
+    return erf(x, Precision::Accurate);
+}
+
+// erfc {{{1
+/**\internal
+ * fast: a single rational approximation of erfc(x) · e^(x²) for x ≥ 0, and
+ * erfc(x) = 2 - erfc(-x) for x < 0.
+ */
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> erfc(Vector<T, Abi> x, Precision::FastTag)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using Traits = Detail::ErfTraits<T>;
+    const auto coeff = [](int i) { return C::erfCoeff(i); };
+    const V ax = abs(x);
+    V r = Detail::erfc_rational(ax, coeff, Traits::FastErfcP, Traits::FastErfcQ,
+                                Traits::FastErfcEnd, Traits::FastErfcSteps);
+    r.setZero(ax > V(Traits::erfc_underflow()));
+    r(x < V::Zero()) = V(T(2)) - r;
+    return r;
+}
+
+/**\internal
+ * float, accurate: the fast double implementation covers the whole float range, including
+ * the subnormal results.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> erfc(Vector<float, Abi> x,
+                                                          Precision::AccurateTag)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(erfc(simd_cast<D>(x), Precision::Fast));
+}
+
+/**\internal
+ * double, accurate: 1 - erf(x) for |x| < ½ and a rational approximation of
+ * erfc(x) · e^(x²) fitted to ½ ≤ x ≤ 27.3 above.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> erfc(Vector<double, Abi> x,
+                                                            Precision::AccurateTag)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+    using Traits = Detail::ErfTraits<double>;
+    const auto coeff = [](int i) { return C::erfCoeff(i); };
+    const V ax = abs(x);
+    V r = Detail::erfc_rational(ax, coeff, Traits::ErfcP, Traits::ErfcQ, Traits::End,
+                                Traits::ErfcSteps);
+    r.setZero(ax > V(Traits::erfc_underflow()));
+    r(x < V::Zero()) = V(2.) - r;
+    const V small = Detail::polynomial<Traits::ErfSmall, Traits::FastErfcP>(x * x, coeff);
+    r(ax < V(0.5)) = V::One() - x * small;
+    return r;
+}
+
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> erfc(Vector<T, Abi> x,
+                                                Precision::DefaultTag = {})
+{
+    return erfc(x, Precision::Accurate);
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -41,44 +41,339 @@ constexpr float MAXLOGF = 88.72283905206835f;
 constexpr float MINLOGF = -103.278929903431851103f; /* log(2^-149) */
 constexpr float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
 
-template <typename Abi, typename = enable_if<std::is_same<Abi, VectorAbi::Sse>::value ||
-                                             std::is_same<Abi, VectorAbi::Avx>::value>>
-inline Vector<float, detail::not_fixed_size_abi<Abi>> exp(Vector<float, Abi> x)
+namespace Detail
+{
+// exp_scale {{{1
+/**\internal
+ * Returns \p z · 2ⁿ. ldexp only adds \p n to the exponent bits, which breaks for subnormal
+ * and overflowing results. Splitting the scale into two factors that are normal numbers
+ * makes the final multiplication round (or overflow) correctly.
+ */
+template <class V>
+Vc_INTRINSIC V exp_scale(const V &z, const SimdArray<int, V::Size> &n)
+{
+    const SimdArray<int, V::Size> n1 = n >> 1;
+    return z * ldexp(V::One(), n1) * ldexp(V::One(), n - n1);
+}
+
+// expm1_reduced {{{1
+/**\internal
+ * Returns eʳ - 1 for |r| ≤ ½·ln(2).
+ */
+template <class Abi> Vc_INTRINSIC Vector<float, Abi> expm1_reduced(Vector<float, Abi> r)
+{
+    using V = Vector<float, Abi>;
+    // Cephes expf. Theoretical peak relative error in [-0.5, +0.5] is 4.2e-9.
+    const V p = Vc::polynomial(r, 1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f,
+                               4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f);
+    return madd(p, r * r, r);
+}
+template <class Abi> Vc_INTRINSIC Vector<double, Abi> expm1_reduced(Vector<double, Abi> r)
+{
+    using V = Vector<double, Abi>;
+    // Taylor series up to r¹³. The truncation error is below 2⁻⁵⁷ and, unlike the Padé
+    // form of Cephes exp, there is no division and no cancellation in its denominator.
+    // expm1 needs the extra accuracy: for n = 1 the reconstruction doubles the error.
+    const V p = Vc::polynomial(r, 1. / 6227020800., 1. / 479001600., 1. / 39916800.,
+                               1. / 3628800., 1. / 362880., 1. / 40320., 1. / 5040.,
+                               1. / 720., 1. / 120., 1. / 24., 1. / 6., 0.5);
+    return madd(p, r * r, r);
+}
+
+/**\internal
+ * Precision::Fast: minimax polynomials of lower degree, with a relative error of 2⁻²³·²
+ * (float) and 2⁻⁵¹·⁶ (double).
+ */
+template <class Abi>
+Vc_INTRINSIC Vector<float, Abi> expm1_reduced(Vector<float, Abi> r, Precision::FastTag)
+{
+    using V = Vector<float, Abi>;
+    const V p = Vc::polynomial(r, 8.312700316e-03f, 4.189018905e-02f, 1.666711271e-01f,
+                               4.999923110e-01f);
+    return madd(p, r * r, r);
+}
+template <class Abi>
+Vc_INTRINSIC Vector<double, Abi> expm1_reduced(Vector<double, Abi> r, Precision::FastTag)
+{
+    using V = Vector<double, Abi>;
+    const V p = Vc::polynomial(r, 2.74767585072986757e-07, 2.76349950345359704e-06,
+                               2.48019318422572115e-05, 1.98411852264939972e-04,
+                               1.38888885160905889e-03, 8.33333337087693166e-03,
+                               4.16666666681370576e-02, 1.66666666666115404e-01,
+                               4.99999999999983236e-01);
+    return madd(p, r * r, r);
+}
+
+// exp2m1_reduced {{{1
+/**\internal
+ * Returns 2ᶠ - 1 for |f| ≤ ½.
+ */
+template <class Abi> Vc_INTRINSIC Vector<float, Abi> exp2m1_reduced(Vector<float, Abi> f)
+{
+    using V = Vector<float, Abi>;
+    // Cephes exp2f
+    const V p = Vc::polynomial(f, 1.535336188319500E-4f, 1.339887440266574E-3f,
+                               9.618437357674640E-3f, 5.550332471162809E-2f,
+                               2.402264791363012E-1f, 6.931472028550421E-1f);
+    return p * f;
+}
+template <class Abi> Vc_INTRINSIC Vector<double, Abi> exp2m1_reduced(Vector<double, Abi> f)
+{
+    using V = Vector<double, Abi>;
+    // Cephes exp2: 2ᶠ = 1 + 2f·P(f²) / (Q(f²) - f·P(f²))
+    const V f2 = f * f;
+    const V p = f * Vc::polynomial(f2, 2.30933477057345225087E-2,
+                                   2.02020656693165307700E1, 1.51390680115615096133E3);
+    const V q =
+        Vc::polynomial(f2, 1., 2.33184211722314911771E2, 4.36821166879210612817E3);
+    return (p + p) / (q - p);
+}
+
+// exp10m1_reduced {{{1
+/**\internal
+ * Returns 10ᶠ - 1 for |f| ≤ ½·log₁₀(2).
+ */
+template <class Abi> Vc_INTRINSIC Vector<float, Abi> exp10m1_reduced(Vector<float, Abi> f)
 {
     using V = Vector<float, Abi>;
-    typedef typename V::Mask M;
-    typedef Detail::Const<float, Abi> C;
-
-        const M overflow  = x > MAXLOGF;
-        const M underflow = x < MINLOGF;
-
-        // log₂(eˣ) = x * log₂(e) * log₂(2)
-        //          = log₂(2^(x * log₂(e)))
-        // => eˣ = 2^(x * log₂(e))
-        // => n  = ⌊x * log₂(e) + ½⌋
-        // => y  = x - n * ln(2)       | recall that: ln(2) * log₂(e) == 1
-        // <=> eˣ = 2ⁿ * eʸ
-        V z = floor(C::log2_e() * x + 0.5f);
-        const auto n = static_cast<Vc::SimdArray<int, V::Size>>(z);
-        x -= z * C::ln2_large();
-        x -= z * C::ln2_small();
-
-        /* Theoretical peak relative error in [-0.5, +0.5] is 4.2e-9. */
-        z = ((((( 1.9875691500E-4f  * x
-                + 1.3981999507E-3f) * x
-                + 8.3334519073E-3f) * x
-                + 4.1665795894E-2f) * x
-                + 1.6666665459E-1f) * x
-                + 5.0000001201E-1f) * (x * x)
-                + x
-                + 1.0f;
-
-        x = ldexp(z, n); // == z * 2ⁿ
-
-        x(overflow) = std::numeric_limits<typename V::EntryType>::infinity();
-        x.setZero(underflow);
-
-        return x;
-    }
+    // Cephes exp10f
+    const V p = Vc::polynomial(f, 2.063216740311022E-1f, 5.420251702225484E-1f,
+                               1.171292686296281E+0f, 2.034649854009453E+0f,
+                               2.650948748208892E+0f, 2.302585167056758E+0f);
+    return p * f;
+}
+template <class Abi>
+Vc_INTRINSIC Vector<double, Abi> exp10m1_reduced(Vector<double, Abi> f)
+{
+    using V = Vector<double, Abi>;
+    // Cephes exp10: 10ᶠ = 1 + 2f·P(f²) / (Q(f²) - f·P(f²))
+    const V f2 = f * f;
+    const V p = f * Vc::polynomial(f2, 4.09962519798587023075E-2,
+                                   1.17452732554344059015E1, 4.06717289936872725516E2,
+                                   2.39423741207388267439E3);
+    const V q = Vc::polynomial(f2, 1., 8.50936160849306532625E1, 1.27209271178345121210E3,
+                               2.07960819286001865907E3);
+    return (p + p) / (q - p);
+}
+
+// ExpTraits {{{1
+/**\internal
+ * The range limits (x with a finite or non-zero result) and the Cody-Waite constants of
+ * the argument reductions.
+ */
+template <class T> struct ExpTraits;
+template <> struct ExpTraits<float> {
+    static constexpr float max_log() { return MAXLOGF; }
+    static constexpr float min_log() { return MINLOGF; }
+    static constexpr float max_log2() { return 127.99999237060546875f; }  // 128 - ulp
+    static constexpr float min_log2() { return -150.f; }
+    static constexpr float max_log10() { return 38.531839419103626f; }
+    static constexpr float min_log10() { return -45.154499349597181f; }  // log₁₀(2⁻¹⁵⁰)
+    static constexpr float min_expm1() { return -18.f; }  // eˣ - 1 rounds to -1
+    // log(2⁻¹²⁵): the smallest x for which the single ldexp of Precision::Fast cannot
+    // produce a subnormal (it only adds to the exponent bits)
+    static constexpr float min_fast_log() { return -86.6433975699931636771f; }
+    static constexpr float min_fast_log2() { return -125.f; }
+    static constexpr float min_fast_log10() { return -37.6287494579976494017f; }
+    static constexpr float ln2() { return 6.93147180559945309417E-1f; }
+    static constexpr float ln10() { return 2.30258509299404568402E0f; }
+    static constexpr float log2_10() { return 3.32192809488736234787f; }
+    static constexpr float log10_2_large() { return 3.00781250000000000000E-1f; }
+    static constexpr float log10_2_small() { return 2.48745663981195213739E-4f; }
+};
+template <> struct ExpTraits<double> {
+    static constexpr double max_log() { return 7.09782712893383973096E2; }
+    static constexpr double min_log() { return -7.45133219101941108420E2; }  // log(2⁻¹⁰⁷⁵)
+    static constexpr double max_log2() { return 1023.9999999999998863; }  // 1024 - ulp
+    static constexpr double min_log2() { return -1075.; }
+    static constexpr double max_log10() { return 3.08254715559916743851E2; }
+    static constexpr double min_log10() { return -3.23607245701624069654E2; }  // log₁₀(2⁻¹⁰⁷⁵)
+    static constexpr double min_expm1() { return -40.; }  // eˣ - 1 rounds to -1
+    static constexpr double min_fast_log() { return -7.07703271351704160915E2; }
+    static constexpr double min_fast_log2() { return -1021.; }
+    static constexpr double min_fast_log10() { return -3.07351625572924800313E2; }
+    static constexpr double ln2() { return 6.93147180559945309417E-1; }
+    static constexpr double ln10() { return 2.30258509299404568402E0; }
+    static constexpr double log2_10() { return 3.32192809488736234787E0; }
+    static constexpr double log10_2_large() { return 3.01025390625000000000E-1; }
+    static constexpr double log10_2_small() { return 4.60503898119521373889E-6; }
+};
+
+// exp_reduce {{{1
+/**\internal
+ * Splits eˣ into 2ⁿ · eʳ with n = ⌊x · log₂(e) + ½⌋ and r = x - n · ln(2).
+ *
+ * log₂(eˣ) = x * log₂(e) * log₂(2)
+ *          = log₂(2^(x * log₂(e)))
+ * => eˣ = 2^(x * log₂(e))
+ * => n  = ⌊x * log₂(e) + ½⌋
+ * => r  = x - n * ln(2)       | recall that: ln(2) * log₂(e) == 1
+ * <=> eˣ = 2ⁿ * eʳ
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> exp_reduce(Vector<T, Abi> x,
+                                           SimdArray<int, Vector<T, Abi>::Size> &n)
+{
+    typedef Detail::Const<T, Abi> C;
+    const Vector<T, Abi> z = floor(madd(C::log2_e(), x, Vector<T, Abi>(T(0.5))));
+    n = simd_cast<SimdArray<int, Vector<T, Abi>::Size>>(z);
+    x = madd(-z, C::ln2_large(), x);
+    return madd(-z, C::ln2_small(), x);
+}
+//}}}1
+}  // namespace Detail
+
+// exp {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log();
+    const auto underflow = x < Traits::min_log();
+
+    SimdArray<int, V::Size> n;
+    const V r = Detail::exp_reduce(x, n);
+    x = Detail::exp_scale(V::One() + Detail::expm1_reduced(r), n);  // == eʳ * 2ⁿ
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+
+/**\internal
+ * Precision::Fast: a shorter polynomial and a single ldexp instead of exp_scale. Results
+ * below 2⁻¹²⁵ (float) and 2⁻¹⁰²¹ (double) are flushed to zero.
+ */
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp(Vector<T, Abi> x, Precision::FastTag)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log();
+    const auto underflow = x < Traits::min_fast_log();
+
+    SimdArray<int, V::Size> n;
+    const V r = Detail::exp_reduce(x, n);
+    x = ldexp(V::One() + Detail::expm1_reduced(r, Precision::Fast), n);
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+
+// expm1 {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> expm1(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log();
+    const auto underflow = x < Traits::min_expm1();
+    const auto subnormal = abs(x) < std::numeric_limits<T>::min();  // t · p would flush
+    const V x0 = x;
+
+    SimdArray<int, V::Size> n;
+    const V p = Detail::expm1_reduced(Detail::exp_reduce(x, n));
+    // eˣ - 1 = 2ⁿ · (eʳ - 1) + 2ⁿ - 1 = 2 · (t · (eʳ - 1) + (t - ½)) with t = 2ⁿ⁻¹.
+    // For n = 0 the result is eʳ - 1 without cancellation, and using 2ⁿ⁻¹ keeps t
+    // finite up to the overflow threshold.
+    const V t = ldexp(V::One(), n - 1);
+    x = Detail::madd(t, p, t - V(T(0.5)));
+    x += x;
+
+    x(subnormal) = x0;
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x(underflow) = V(T(-1));
+    return x;
+}
+
+// exp2 {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp2(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    // not x >= 128: SSE implements >= as not-less-than, which is true for NaN
+    const auto overflow = x > Traits::max_log2();
+    const auto underflow = x < Traits::min_log2();
+
+    // 2ˣ = 2ⁿ · 2ᶠ with n = ⌊x + ½⌋ and the exact f = x - n
+    const V z = floor(x + V(T(0.5)));
+    const auto n = simd_cast<SimdArray<int, V::Size>>(z);
+    x = Detail::exp_scale(V::One() + Detail::exp2m1_reduced(x - z), n);
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+
+/**\internal
+ * Precision::Fast: 2ᶠ = e^(f·ln(2)) with the polynomial of exp, and the range of exp.
+ */
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp2(Vector<T, Abi> x, Precision::FastTag)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log2();
+    const auto underflow = x < Traits::min_fast_log2();
+
+    const V z = floor(x + V(T(0.5)));
+    const auto n = simd_cast<SimdArray<int, V::Size>>(z);
+    const V r = (x - z) * V(Traits::ln2());
+    x = ldexp(V::One() + Detail::expm1_reduced(r, Precision::Fast), n);
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+
+// exp10 {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp10(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log10();
+    const auto underflow = x < Traits::min_log10();
+
+    // 10ˣ = 2ⁿ · 10ᶠ with n = ⌊x · log₂(10) + ½⌋ and f = x - n · log₁₀(2)
+    const V z = floor(Detail::madd(V(Traits::log2_10()), x, V(T(0.5))));
+    const auto n = simd_cast<SimdArray<int, V::Size>>(z);
+    x = Detail::madd(-z, V(Traits::log10_2_large()), x);
+    x = Detail::madd(-z, V(Traits::log10_2_small()), x);
+    x = Detail::exp_scale(V::One() + Detail::exp10m1_reduced(x), n);
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+
+/**\internal
+ * Precision::Fast: 10ᶠ = e^(f·ln(10)) with the polynomial of exp, and the range of exp.
+ */
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> exp10(Vector<T, Abi> x, Precision::FastTag)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::ExpTraits<T>;
+    const auto overflow = x > Traits::max_log10();
+    const auto underflow = x < Traits::min_fast_log10();
+
+    const V z = floor(Detail::madd(V(Traits::log2_10()), x, V(T(0.5))));
+    const auto n = simd_cast<SimdArray<int, V::Size>>(z);
+    x = Detail::madd(-z, V(Traits::log10_2_large()), x);
+    x = Detail::madd(-z, V(Traits::log10_2_small()), x);
+    const V r = x * V(Traits::ln10());
+    x = ldexp(V::One() + Detail::expm1_reduced(r, Precision::Fast), n);
+
+    x(overflow) = std::numeric_limits<T>::infinity();
+    x.setZero(underflow);
+    return x;
+}
+//}}}1
 
 #endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -0,0 +1,139 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FLOAT16_H_
+#define VC_COMMON_FLOAT16_H_
+
+#include <cstdint>
+#include <cstring>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar float <-> binary16 conversions {{{1
+Vc_INTRINSIC Vc_CONST std::uint32_t float_bits(float x)
+{
+    std::uint32_t r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+Vc_INTRINSIC Vc_CONST float bits_to_float(std::uint32_t x)
+{
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+/**\internal
+ * Converts the binary16 bit pattern \p h to float. The conversion is exact. The exponent
+ * and mantissa bits are moved into the float representation and rescaled with a
+ * multiplication by 2^112, which also normalizes subnormal inputs. This relies on the
+ * FPU not flushing denormal inputs to zero (DAZ).
+ */
+Vc_INTRINSIC Vc_CONST float half_to_float(std::uint16_t h)
+{
+    const std::uint32_t expmant = h & 0x7fffu;
+    std::uint32_t r = float_bits(bits_to_float(expmant << 13) * bits_to_float(0x77800000u));
+    if (expmant > 0x7bffu) {  // inf or nan
+        r |= 0x7f800000u;
+    }
+    return bits_to_float(r | (std::uint32_t(h & 0x8000u) << 16));
+}
+
+/**\internal
+ * Converts \p x to the binary16 bit pattern with round to nearest even. Values beyond the
+ * binary16 range turn into infinity, NaNs turn into a quiet NaN.
+ */
+Vc_INTRINSIC Vc_CONST std::uint16_t float_to_half(float x)
+{
+    std::uint32_t f = float_bits(x);
+    const std::uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+    std::uint32_t r;
+    if (f >= 0x47800000u) {  // >= 2^16: inf or nan
+        r = f > 0x7f800000u ? 0x7e00u : 0x7c00u;
+    } else if (f < 0x38800000u) {  // < 2^-14: the result is subnormal or zero
+        // adding 0.5 aligns the binary16 subnormal mantissa with the low mantissa bits
+        // of the sum and lets the FPU do the rounding
+        r = float_bits(bits_to_float(f) + bits_to_float(0x3f000000u)) - 0x3f000000u;
+    } else {
+        const std::uint32_t mantissa_odd = (f >> 13) & 1u;
+        r = (f + 0xc8000fffu + mantissa_odd) >> 13;  // rebias the exponent and round
+    }
+    return static_cast<std::uint16_t>(r | (sign >> 16));
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile float16.h <Vc/Vc>
+ *
+ * An IEEE 754 binary16 (half precision) storage type.
+ *
+ * float16 only stores values; there is no arithmetic on it. Use it for arrays in memory
+ * and let the float vectors do the work: Vc::float_v (and SimdArray<float, N>) can load
+ * from and store to `float16` arrays, honoring the Vc::Aligned, Vc::Unaligned, and
+ * Vc::Streaming flags, and can gather from them. With F16C (Vc_IMPL_F16C) the conversions
+ * use the `vcvtph2ps`/`vcvtps2ph` instructions, otherwise an exact SSE2 integer sequence.
+ * Conversions to float16 round to nearest even.
+ *
+ * \code
+ * std::vector<Vc::float16> weights = ...;
+ * Vc::float_v w(&weights[i]);  // float16 -> float
+ * (w * scale).store(&weights[i]);  // float -> float16
+ * \endcode
+ */
+class float16
+{
+public:
+    float16() = default;
+    Vc_INTRINSIC float16(float x) : bits(Detail::float_to_half(x)) {}
+    Vc_INTRINSIC operator float() const { return Detail::half_to_float(bits); }
+
+    /// Returns a float16 object with the binary16 bit pattern \p x.
+    static Vc_INTRINSIC float16 fromBits(std::uint16_t x)
+    {
+        float16 r;
+        r.bits = x;
+        return r;
+    }
+    /// Returns the binary16 bit pattern.
+    Vc_INTRINSIC std::uint16_t toBits() const { return bits; }
+
+private:
+    std::uint16_t bits;
+};
+static_assert(sizeof(float16) == 2, "float16 must not have padding");
+
+}  // namespace Vc
+
+#endif  // VC_COMMON_FLOAT16_H_
+
+// vim: foldmethod=marker
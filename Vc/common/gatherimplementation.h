@@ -39,13 +39,34 @@ enum class GatherScatterImplementation : int {
     SimpleLoop,
     SetIndexZero,
     BitScanLoop,
-    PopcntSwitch
+    PopcntSwitch,
+    Hardware
 };
 
 using SimpleLoopT   = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SimpleLoop>;
 using SetIndexZeroT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SetIndexZero>;
 using BitScanLoopT  = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::BitScanLoop>;
 using PopcntSwitchT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::PopcntSwitch>;
+using HardwareT     = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::Hardware>;
+
+/**\internal
+ * Selects the masked gather strategy for the running process. The choice is made in this
+ * order:
+ * \li the \c VC_GATHER_STRATEGY environment variable (\c simple, \c bsf, \c popcnt, or
+ * \c hardware),
+ * \li a table of processors (CpuId::processorFamily() / CpuId::processorModel()) whose
+ * winner is known,
+ * \li a micro-calibration that times \p run for every candidate strategy and picks the
+ * fastest.
+ *
+ * \p run must execute a fixed gather workload with the given strategy and return a value
+ * derived from the gathered data (it is consumed to keep the work from being optimized
+ * away).
+ *
+ * The result is computed on every call. Callers cache it.
+ */
+GatherScatterImplementation Vc_VDECL
+selectGatherImplementation(float (*run)(GatherScatterImplementation));
 
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeGather(SetIndexZeroT,
@@ -312,6 +333,35 @@ Vc_ALWAYS_INLINE void executeGather(PopcntSwitchT,
     }
 }
 
+/**\internal
+ * Executes the masked gather with the strategy \p impl chosen at runtime.
+ *
+ * The Hardware strategy needs ABI-specific instructions and is therefore executed by the
+ * caller. Here it falls back to SimpleLoop. PopcntSwitch falls back to BitScanLoop for
+ * vector sizes it does not support.
+ */
+template <typename V, typename MT, typename IT>
+Vc_INTRINSIC void executeGather(GatherScatterImplementation impl, V &v, const MT *mem,
+                                const IT &indexes, typename V::MaskArgument mask)
+{
+    using PopcntOrBitScanT = std::integral_constant<
+        GatherScatterImplementation,
+        (V::Size == 2 || V::Size == 4 || V::Size == 8 || V::Size == 16)
+            ? GatherScatterImplementation::PopcntSwitch
+            : GatherScatterImplementation::BitScanLoop>;
+    switch (impl) {
+    case GatherScatterImplementation::BitScanLoop:
+        executeGather(BitScanLoopT(), v, mem, indexes, mask);
+        break;
+    case GatherScatterImplementation::PopcntSwitch:
+        executeGather(PopcntOrBitScanT(), v, mem, indexes, mask);
+        break;
+    default:
+        executeGather(SimpleLoopT(), v, mem, indexes, mask);
+        break;
+    }
+}
+
 }  // namespace Common
 }  // namespace Vc
 
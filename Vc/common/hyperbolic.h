@@ -0,0 +1,174 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// TanhTraits {{{1
+/**\internal
+ * Offsets of the coefficients in c_tanh<T> (highest degree first) and the range limits.
+ */
+template <class T> struct TanhTraits;
+template <> struct TanhTraits<float> {
+    // tanh(x) = x · P(x²) / Q(x²) for |x| ≤ 9, minimax relative error 2⁻²⁵·⁴
+    enum { P = 0, Q = 5, End = 10 };
+    static constexpr float saturation() { return 9.f; }  // tanh(x) rounds to 1 above
+};
+template <> struct TanhTraits<double> {
+    // tanh(x) = x + x³ · R(x²) for |x| < 0.625, minimax relative error 2⁻⁵⁶·⁴
+    enum { R = 0, End = 11 };
+    static constexpr double small() { return 0.625; }
+};
+//}}}1
+}  // namespace Detail
+
+// tanh {{{1
+/**\internal
+ * float, fast: a single rational approximation, without exp.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> tanh(Vector<float, Abi> x,
+                                                          Precision::FastTag)
+{
+    using V = Vector<float, Abi>;
+    using C = Detail::Const<float, Abi>;
+    using Traits = Detail::TanhTraits<float>;
+    const auto coeff = [](int i) { return C::tanhCoeff(i); };
+    const V z = x * x;
+    V r = x * Detail::polynomial<Traits::P, Traits::Q>(z, coeff) /
+          Detail::polynomial<Traits::Q, Traits::End>(z, coeff);
+    r(abs(x) > V(Traits::saturation())) = copysign(V::One(), x);
+    return r;
+}
+
+/**\internal
+ * double, fast: tanh|x| = t / (t + 2) with t = e²ˣ - 1 does not cancel for any x.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> tanh(Vector<double, Abi> x,
+                                                            Precision::FastTag)
+{
+    using V = Vector<double, Abi>;
+    const V ax = abs(x);
+    const V t = expm1(ax + ax);
+    V r = t / (t + V(2.));
+    r(ax > V(20.)) = V::One();  // t = inf
+    return copysign(r, x);
+}
+
+/**\internal
+ * float, accurate: the fast double implementation rounds correctly in almost all cases.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> tanh(Vector<float, Abi> x,
+                                                          Precision::AccurateTag)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(tanh(simd_cast<D>(x), Precision::Fast));
+}
+
+/**\internal
+ * double, accurate: a polynomial for |x| < 0.625 and 1 - 2 / (e²ˣ + 1) above, where the
+ * cancellation is small enough.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> tanh(Vector<double, Abi> x,
+                                                            Precision::AccurateTag)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+    using Traits = Detail::TanhTraits<double>;
+    const auto coeff = [](int i) { return C::tanhCoeff(i); };
+    const V ax = abs(x);
+    const V e = exp(ax + ax);
+    V r = V::One() - V(2.) / (e + V::One());
+
+    const V z = x * x;
+    r(ax < V(Traits::small())) =
+        Detail::madd(ax * z, Detail::polynomial<Traits::R, Traits::End>(z, coeff), ax);
+    return copysign(r, x);
+}
+
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> tanh(Vector<T, Abi> x,
+                                                Precision::DefaultTag = {})
+{
+    return tanh(x, Precision::Accurate);
+}
+
+// sigmoid {{{1
+/**\internal
+ * fast: 1 / (1 + e⁻ˣ), which flushes to 0 where e⁻ˣ overflows (the result would be
+ * subnormal for float).
+ */
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> sigmoid(Vector<T, Abi> x, Precision::FastTag)
+{
+    using V = Vector<T, Abi>;
+    return V::One() / (V::One() + exp(-x));
+}
+
+/**\internal
+ * float, accurate: the fast double implementation covers the whole float range.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> sigmoid(Vector<float, Abi> x,
+                                                             Precision::AccurateTag)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(sigmoid(simd_cast<D>(x), Precision::Fast));
+}
+
+/**\internal
+ * double, accurate: with e = e^-|x|, σ(x) = 1 / (1 + e) for x ≥ 0 and e / (1 + e) for
+ * x < 0. e never overflows, and the results for x < 0 are correct down to the subnormals.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> sigmoid(Vector<double, Abi> x,
+                                                               Precision::AccurateTag)
+{
+    using V = Vector<double, Abi>;
+    const V e = exp(-abs(x));
+    V r = V::One() / (V::One() + e);
+    r(x < V::Zero()) *= e;
+    return r;
+}
+
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> sigmoid(Vector<T, Abi> x,
+                                                   Precision::DefaultTag = {})
+{
+    return sigmoid(x, Precision::Accurate);
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
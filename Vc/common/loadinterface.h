@@ -55,7 +55,7 @@ template <typename U, typename Flags = DefaultLoadTag,
           typename = enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+              Traits::is_load_store_type<U, EntryType>::value &&Traits::is_load_store_flag<Flags>::value>>
 explicit Vc_INTRINSIC Vector(const U *x, Flags flags = Flags())
 {
     load<U, Flags>(x, flags);
@@ -94,7 +94,7 @@ template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value && Traits::is_load_store_flag<Flags>::value, void>
+              Traits::is_load_store_type<U, EntryType>::value && Traits::is_load_store_flag<Flags>::value, void>
 {};
 
 public:
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_COMMON_MATH_H_INTERNAL 1
 
 #include "trigonometric.h"
+#include "polynomial.h"
 
 #include "const.h"
 #include "macros.h"
@@ -49,91 +50,182 @@ template <class T, size_t N> SimdArray<int, N> fpclassify(const SimdArray<T, N>
     return SimdArray<int, N>([&](std::size_t i) { return std::fpclassify(x[i]); });
 }
 
+// add_sat & sub_sat {{{1
+/**
+ * Returns the component-wise sum of \p a and \p b, saturated to the range of \p T
+ * instead of wrapping around on overflow.
+ *
+ * The backends provide overloads that map to a single instruction for 8- and 16-bit
+ * integers. This generic implementation covers the remaining integral types.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, Vector<T, Abi>> add_sat(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    using V = Vector<T, Abi>;
+    const V upper = std::numeric_limits<T>::max();
+    const V lower = std::numeric_limits<T>::min();
+    // the bounds are adjusted with the positive or negative part of b only, so that no
+    // intermediate result can overflow
+    const auto hi = a > upper - max(b, V::Zero());
+    const auto lo = a < lower - min(b, V::Zero());
+    V r = b;
+    r.setZero(hi || lo);
+    r += a;
+    r(hi) = upper;
+    r(lo) = lower;
+    return r;
+}
+
+/**
+ * Returns the component-wise difference `a - b`, saturated to the range of \p T instead
+ * of wrapping around on overflow.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, Vector<T, Abi>> sub_sat(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    using V = Vector<T, Abi>;
+    const V upper = std::numeric_limits<T>::max();
+    const V lower = std::numeric_limits<T>::min();
+    const auto hi = a > upper + min(b, V::Zero());
+    const auto lo = a < lower + max(b, V::Zero());
+    V r = b;
+    r.setZero(hi || lo);
+    r = a - r;
+    r(hi) = upper;
+    r(lo) = lower;
+    return r;
+}
+
 #ifdef Vc_IMPL_SSE
 // for SSE, AVX, and AVX2
 #include "logarithm.h"
 #include "exponential.h"
-#ifdef Vc_IMPL_AVX
-inline AVX::double_v exp(AVX::double_v _x)
+#include "power.h"
+#include "hyperbolic.h"
+#include "erf.h"
+
+// precision tiers {{{
+/* Functions without a dedicated implementation for a tier map the tags here:
+ * Precision::Default always selects the untagged function, Precision::Fast falls back to
+ * it, and Precision::Accurate evaluates float in double. The double implementations
+ * already are the most accurate ones.
+ */
+#define Vc_DEFAULT_TIER_(name_)                                                          \
+    template <typename T, typename Abi>                                                  \
+    Vc_INTRINSIC Vector<T, Detail::math_abi<T, Abi>> name_(const Vector<T, Abi> &x,      \
+                                                           Precision::DefaultTag)        \
+    {                                                                                    \
+        return name_(x);                                                                 \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#define Vc_FAST_IS_DEFAULT_TIER_(name_)                                                  \
+    template <typename T, typename Abi>                                                  \
+    Vc_INTRINSIC Vector<T, Detail::math_abi<T, Abi>> name_(const Vector<T, Abi> &x,      \
+                                                           Precision::FastTag)           \
+    {                                                                                    \
+        return name_(x);                                                                 \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#define Vc_ACCURATE_TIER_(name_)                                                         \
+    template <typename Abi>                                                              \
+    Vc_INTRINSIC Vector<float, Detail::math_abi<float, Abi>> name_(                      \
+        const Vector<float, Abi> &x, Precision::AccurateTag)                             \
+    {                                                                                    \
+        using D = SimdArray<double, Vector<float, Abi>::Size>;                           \
+        return simd_cast<Vector<float, Abi>>(name_(simd_cast<D>(x)));                    \
+    }                                                                                    \
+    template <typename Abi>                                                              \
+    Vc_INTRINSIC Vector<double, Detail::math_abi<double, Abi>> name_(                    \
+        const Vector<double, Abi> &x, Precision::AccurateTag)                            \
+    {                                                                                    \
+        return name_(x);                                                                 \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#define Vc_TIERS_(name_)                                                                 \
+    Vc_DEFAULT_TIER_(name_);                                                             \
+    Vc_ACCURATE_TIER_(name_)
+
+Vc_TIERS_(sin);
+Vc_TIERS_(cos);
+Vc_TIERS_(asin);
+Vc_TIERS_(atan);
+Vc_TIERS_(exp);
+Vc_TIERS_(exp2);
+Vc_TIERS_(exp10);
+Vc_TIERS_(expm1);
+Vc_TIERS_(log);
+Vc_TIERS_(log2);
+Vc_TIERS_(log10);
+Vc_TIERS_(log1p);
+Vc_TIERS_(cbrt);
+Vc_FAST_IS_DEFAULT_TIER_(asin);
+Vc_FAST_IS_DEFAULT_TIER_(atan);
+Vc_FAST_IS_DEFAULT_TIER_(expm1);
+Vc_FAST_IS_DEFAULT_TIER_(log1p);
+Vc_FAST_IS_DEFAULT_TIER_(cbrt);
+#undef Vc_DEFAULT_TIER_
+#undef Vc_FAST_IS_DEFAULT_TIER_
+#undef Vc_ACCURATE_TIER_
+#undef Vc_TIERS_
+
+#define Vc_BINARY_TIERS_(name_)                                                          \
+    template <typename T, typename Abi, typename Tag,                                    \
+              typename = enable_if<Traits::is_precision_tag<Tag>::value &&               \
+                                   !std::is_same<Tag, Precision::AccurateTag>::value>>   \
+    Vc_INTRINSIC Vector<T, Detail::math_abi<T, Abi>> name_(                              \
+        const Vector<T, Abi> &a, const Vector<T, Abi> &b, Tag)                           \
+    {                                                                                    \
+        return name_(a, b);                                                              \
+    }                                                                                    \
+    template <typename Abi>                                                              \
+    Vc_INTRINSIC Vector<float, Detail::math_abi<float, Abi>> name_(                      \
+        const Vector<float, Abi> &a, const Vector<float, Abi> &b,                        \
+        Precision::AccurateTag)                                                          \
+    {                                                                                    \
+        using D = SimdArray<double, Vector<float, Abi>::Size>;                           \
+        return simd_cast<Vector<float, Abi>>(name_(simd_cast<D>(a), simd_cast<D>(b)));   \
+    }                                                                                    \
+    template <typename Abi>                                                              \
+    Vc_INTRINSIC Vector<double, Detail::math_abi<double, Abi>> name_(                    \
+        const Vector<double, Abi> &a, const Vector<double, Abi> &b,                      \
+        Precision::AccurateTag)                                                          \
+    {                                                                                    \
+        return name_(a, b);                                                              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_BINARY_TIERS_(atan2);
+Vc_BINARY_TIERS_(pow);
+Vc_BINARY_TIERS_(hypot);
+#undef Vc_BINARY_TIERS_
+
+template <typename T, typename Abi>
+Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
+                         Vector<T, Detail::math_abi<T, Abi>> *sin, Vector<T, Abi> *cos,
+                         Precision::DefaultTag)
 {
-    AVX::Vector<double> x = _x;
-    typedef AVX::Vector<double> V;
-        typedef V::Mask M;
-    typedef AVX::Const<double> C;
-
-        const M overflow  = x > Vc::Detail::doubleConstant< 1, 0x0006232bdd7abcd2ull, 9>(); // max log
-        const M underflow = x < Vc::Detail::doubleConstant<-1, 0x0006232bdd7abcd2ull, 9>(); // min log
-
-        V px = floor(C::log2_e() * x + 0.5);
-        __m128i tmp = _mm256_cvttpd_epi32(px.data());
-    const SimdArray<int, V::Size> n = SSE::int_v{tmp};
-        x -= px * C::ln2_large(); //Vc::Detail::doubleConstant<1, 0x00062e4000000000ull, -1>();  // ln2
-        x -= px * C::ln2_small(); //Vc::Detail::doubleConstant<1, 0x0007f7d1cf79abcaull, -20>(); // ln2
-
-        const double P[] = {
-            Vc::Detail::doubleConstant<1, 0x000089cdd5e44be8ull, -13>(),
-            Vc::Detail::doubleConstant<1, 0x000f06d10cca2c7eull,  -6>(),
-            Vc::Detail::doubleConstant<1, 0x0000000000000000ull,   0>()
-        };
-        const double Q[] = {
-            Vc::Detail::doubleConstant<1, 0x00092eb6bc365fa0ull, -19>(),
-            Vc::Detail::doubleConstant<1, 0x0004ae39b508b6c0ull,  -9>(),
-            Vc::Detail::doubleConstant<1, 0x000d17099887e074ull,  -3>(),
-            Vc::Detail::doubleConstant<1, 0x0000000000000000ull,   1>()
-        };
-        const V x2 = x * x;
-        px = x * ((P[0] * x2 + P[1]) * x2 + P[2]);
-        x =  px / ((((Q[0] * x2 + Q[1]) * x2 + Q[2]) * x2 + Q[3]) - px);
-        x = V::One() + 2.0 * x;
-
-        x = ldexp(x, n); // == x * 2ⁿ
-
-        x(overflow) = std::numeric_limits<double>::infinity();
-        x.setZero(underflow);
-
-        return x;
-    }
-#endif  // Vc_IMPL_AVX
-
-inline SSE::double_v exp(SSE::double_v::AsArg _x) {
-    SSE::Vector<double> x = _x;
-    typedef SSE::Vector<double> V;
-        typedef V::Mask M;
-    typedef SSE::Const<double> C;
-
-        const M overflow  = x > Vc::Detail::doubleConstant< 1, 0x0006232bdd7abcd2ull, 9>(); // max log
-        const M underflow = x < Vc::Detail::doubleConstant<-1, 0x0006232bdd7abcd2ull, 9>(); // min log
-
-        V px = floor(C::log2_e() * x + 0.5);
-    SimdArray<int, V::Size> n;
-        _mm_storel_epi64(reinterpret_cast<__m128i *>(&n), _mm_cvttpd_epi32(px.data()));
-        x -= px * C::ln2_large(); //Vc::Detail::doubleConstant<1, 0x00062e4000000000ull, -1>();  // ln2
-        x -= px * C::ln2_small(); //Vc::Detail::doubleConstant<1, 0x0007f7d1cf79abcaull, -20>(); // ln2
-
-        const double P[] = {
-            Vc::Detail::doubleConstant<1, 0x000089cdd5e44be8ull, -13>(),
-            Vc::Detail::doubleConstant<1, 0x000f06d10cca2c7eull,  -6>(),
-            Vc::Detail::doubleConstant<1, 0x0000000000000000ull,   0>()
-        };
-        const double Q[] = {
-            Vc::Detail::doubleConstant<1, 0x00092eb6bc365fa0ull, -19>(),
-            Vc::Detail::doubleConstant<1, 0x0004ae39b508b6c0ull,  -9>(),
-            Vc::Detail::doubleConstant<1, 0x000d17099887e074ull,  -3>(),
-            Vc::Detail::doubleConstant<1, 0x0000000000000000ull,   1>()
-        };
-        const V x2 = x * x;
-        px = x * ((P[0] * x2 + P[1]) * x2 + P[2]);
-        x =  px / ((((Q[0] * x2 + Q[1]) * x2 + Q[2]) * x2 + Q[3]) - px);
-        x = V::One() + 2.0 * x;
-
-        x = ldexp(x, n); // == x * 2ⁿ
-
-        x(overflow) = std::numeric_limits<double>::infinity();
-        x.setZero(underflow);
-
-        return x;
-    }
-
+    sincos(x, sin, cos);
+}
+template <typename Abi>
+Vc_INTRINSIC void sincos(const Vector<float, Abi> &x,
+                         Vector<float, Detail::math_abi<float, Abi>> *sin,
+                         Vector<float, Abi> *cos, Precision::AccurateTag)
+{
+    using D = SimdArray<double, Vector<float, Abi>::Size>;
+    D s, c;
+    sincos(simd_cast<D>(x), &s, &c);
+    *sin = simd_cast<Vector<float, Abi>>(s);
+    *cos = simd_cast<Vector<float, Abi>>(c);
+}
+template <typename Abi>
+Vc_INTRINSIC void sincos(const Vector<double, Abi> &x,
+                         Vector<double, Detail::math_abi<double, Abi>> *sin,
+                         Vector<double, Abi> *cos, Precision::AccurateTag)
+{
+    sincos(x, sin, cos);
+}
+// }}}
 #endif
 }  // namespace Vc
 
@@ -0,0 +1,254 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_POLYNOMIAL_H_
+#define VC_COMMON_POLYNOMIAL_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// madd {{{1
+/**\internal
+ * Returns `a * b + c`. With FMA (or FMA4) this is a single fused instruction. Without it
+ * Vc::fma would have to emulate the single rounding at a high cost, while the polynomials
+ * of the math functions do not need it.
+ */
+template <class V> Vc_INTRINSIC V madd(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return fma(a, b, c);
+#else
+    V r = a * b;
+    r += c;
+    return r;
+#endif
+}
+
+// horner {{{1
+/**\internal
+ * Evaluates the polynomial with the coefficients `coeff(first)`, …, `coeff(last - 1)`,
+ * highest degree first, at \p x. \p coeff returns a constant from one of the tables in
+ * Const<T, Abi>.
+ *
+ * This is the strictly sequential scheme, for callers that track the rounding error of
+ * every step. Otherwise use polynomial<First, Last>.
+ */
+template <class V, class F>
+Vc_INTRINSIC V horner(const V &x, const F &coeff, int first, int last)
+{
+    V p = coeff(first);
+    for (int i = first + 1; i < last; ++i) {
+        p = madd(p, x, coeff(i));
+    }
+    return p;
+}
+
+// HornerScheme {{{1
+/**\internal
+ * Evaluates the \p N coefficients `coeff(First)`, …, `coeff(First + N - 1)`, highest
+ * degree first, as a chain of N - 1 dependent multiply-adds. The indexes are compile-time
+ * constants, thus \p coeff may read them from a local array without any loads remaining.
+ */
+template <int First, int N> struct HornerScheme {
+    template <class V, class F> static Vc_INTRINSIC V eval(const V &x, const F &coeff)
+    {
+        return madd(HornerScheme<First, N - 1>::eval(x, coeff), x,
+                    V(coeff(First + N - 1)));
+    }
+};
+template <int First> struct HornerScheme<First, 1> {
+    template <class V, class F> static Vc_INTRINSIC V eval(const V &, const F &coeff)
+    {
+        return V(coeff(First));
+    }
+};
+
+// EstrinScheme {{{1
+/**\internal
+ * Returns the largest power of two below \p n (for n > 1).
+ */
+constexpr int estrin_split(int n, int k = 1)
+{
+    return 2 * k < n ? estrin_split(n, 2 * k) : k;
+}
+/**\internal
+ * Returns log₂(k) for a power of two \p k.
+ */
+constexpr int estrin_level(int k) { return k > 1 ? 1 + estrin_level(k / 2) : 0; }
+
+/**\internal
+ * Evaluates the same polynomial as HornerScheme as a tree: P(x) = Hi(x) · xᴷ + Lo(x),
+ * where Lo holds the K lowest coefficients and K is the largest power of two below N.
+ * Both halves are independent, which shortens the dependency chain from N - 1 to about
+ * log₂(N) multiply-adds, plus the squarings that compute x², x⁴, … in parallel. It
+ * needs a few more instructions than Horner, thus it only pays off if madd is a single
+ * instruction.
+ */
+template <int First, int N, int K = estrin_split(N)> struct EstrinScheme {
+    static constexpr int Levels = estrin_level(K) + 1;
+
+    template <class V, class F> static Vc_INTRINSIC V eval(const V &x, const F &coeff)
+    {
+        V xpow[Levels];  // x, x², x⁴, …
+        xpow[0] = x;
+        for (int i = 1; i < Levels; ++i) {
+            xpow[i] = xpow[i - 1] * xpow[i - 1];
+        }
+        return node(xpow, coeff);
+    }
+
+    template <class V, class F> static Vc_INTRINSIC V node(const V *xpow, const F &coeff)
+    {
+        return madd(EstrinScheme<First, N - K>::node(xpow, coeff), xpow[estrin_level(K)],
+                    EstrinScheme<First + N - K, K>::node(xpow, coeff));
+    }
+};
+template <int First, int K> struct EstrinScheme<First, 1, K> {
+    template <class V, class F> static Vc_INTRINSIC V eval(const V &, const F &coeff)
+    {
+        return V(coeff(First));
+    }
+    template <class V, class F> static Vc_INTRINSIC V node(const V *, const F &coeff)
+    {
+        return V(coeff(First));
+    }
+};
+
+// EstrinHornerScheme {{{1
+/**\internal
+ * The Estrin scheme for all but the two lowest order coefficients, which are added with
+ * two Horner steps. In the series expansions of the math functions the lowest order
+ * terms dominate. Pure Estrin rounds the sum of these terms and then adds the rest,
+ * whereas here every intermediate rounding error is scaled down by x, as in the Horner
+ * scheme. For |x| < 1 the result is as accurate as Horner's, with a dependency chain
+ * shortened by the Estrin part.
+ */
+template <int First, int N> struct EstrinHornerScheme {
+    template <class V, class F> static Vc_INTRINSIC V eval(const V &x, const F &coeff)
+    {
+        const V p = EstrinScheme<First, N - 2>::eval(x, coeff);
+        return madd(madd(p, x, V(coeff(First + N - 2))), x, V(coeff(First + N - 1)));
+    }
+};
+
+// polynomial {{{1
+/**\internal
+ * With FMA, polynomials of degree 5 and higher use EstrinHornerScheme, otherwise the
+ * Horner scheme. Below degree 5 the shorter chain does not make up for the squarings.
+ */
+template <int First, int N>
+using PolynomialScheme = typename std::conditional<
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    (N >= 6),
+#else
+    false,
+#endif
+    EstrinHornerScheme<First, N>, HornerScheme<First, N>>::type;
+
+/**\internal
+ * Evaluates the polynomial with the coefficients `coeff(First)`, …, `coeff(Last - 1)`,
+ * highest degree first, at \p x.
+ */
+template <int First, int Last, class V, class F>
+Vc_INTRINSIC V polynomial(const V &x, const F &coeff)
+{
+    static_assert(Last > First, "the polynomial needs at least one coefficient");
+    return PolynomialScheme<First, Last - First>::eval(x, coeff);
+}
+
+/**\internal
+ * Evaluates the coefficients given as arguments with \p Scheme.
+ */
+template <class Scheme, class V, class... Ts>
+Vc_INTRINSIC V polynomial_with(const V &x, Ts... coeffs)
+{
+    using T = typename V::EntryType;
+    const T c[] = {static_cast<T>(coeffs)...};
+    return Scheme::eval(x, [&](int i) { return c[i]; });
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ *
+ * Evaluates the polynomial with the coefficients \p coeffs at \p x. The coefficients
+ * are given highest degree first, e.g. `Vc::polynomial(x, a, b, c)` returns
+ * `(a·x + b)·x + c`. Pass constants: the function is always inlined, so the coefficients
+ * are broadcast at compile time.
+ *
+ * With FMA (or FMA4) polynomials of degree 5 and higher evaluate all but the two lowest
+ * order terms with the Estrin scheme (see Vc::estrin) and add those with the Horner
+ * scheme (see Vc::horner). This shortens the dependency chain, while the rounding errors
+ * stay as small as with Horner as long as |x| < 1 and the lowest order terms dominate, as
+ * for the usual series expansions. Without FMA the Horner scheme is used.
+ */
+template <class V, class... Ts>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> polynomial(const V &x,
+                                                                       Ts... coeffs)
+{
+    return Detail::polynomial_with<Detail::PolynomialScheme<0, sizeof...(Ts)>>(x,
+                                                                            coeffs...);
+}
+
+/**
+ * \ingroup Math
+ *
+ * Like Vc::polynomial, but always uses the Horner scheme: one multiply-add per
+ * coefficient, each depending on the previous one. It needs the fewest instructions and
+ * is the best choice if the surrounding code keeps the execution units busy anyway.
+ */
+template <class V, class... Ts>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> horner(const V &x,
+                                                                   Ts... coeffs)
+{
+    return Detail::polynomial_with<Detail::HornerScheme<0, sizeof...(Ts)>>(x, coeffs...);
+}
+
+/**
+ * \ingroup Math
+ *
+ * Like Vc::polynomial, but always uses the Estrin scheme: the polynomial is split into
+ * halves that are evaluated independently, which shortens the dependency chain from n
+ * to about log₂(n) multiply-adds for n coefficients, at the cost of the squarings x², x⁴,
+ * … Since the sum of the lowest order terms is rounded before the rest is added, the
+ * error can be about one ulp larger than with Vc::horner.
+ */
+template <class V, class... Ts>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> estrin(const V &x,
+                                                                   Ts... coeffs)
+{
+    return Detail::polynomial_with<Detail::EstrinScheme<0, sizeof...(Ts)>>(x, coeffs...);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_POLYNOMIAL_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,311 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The cbrt polynomial is taken from Cephes and the split of ln(2) used by the double pow
+from fdlibm, which carry the following notices:
+
+Cephes Math Library Release 2.2:  June, 1992
+Copyright 1984, 1987, 1989 by Stephen L. Moshier
+Direct inquiries to 30 Frost Street, Cambridge, MA 02140
+
+Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+Developed at SunSoft, a Sun Microsystems, Inc. business.
+Permission to use, copy, modify, and distribute this
+software is freely granted, provided that this notice
+is preserved.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// two_prod {{{1
+/**\internal
+ * Returns a · b and stores its rounding error in \p err, i.e. a · b = result + err
+ * exactly. Without FMA this is Dekker's product of the Veltkamp halves, which requires
+ * |a|, |b| < 2⁹⁹⁶ (2¹¹⁵ for float).
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> two_prod(const Vector<T, Abi> &a, const Vector<T, Abi> &b,
+                                     Vector<T, Abi> &err)
+{
+    using V = Vector<T, Abi>;
+    const V p = a * b;
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    err = fma(a, b, -p);
+#else
+    // 2¹² + 1 or 2²⁷ + 1
+    const V split = V(std::is_same<T, float>::value ? T(4097) : T(134217729.));
+    const V ta = split * a, tb = split * b;
+    const V ah = ta - (ta - a), bh = tb - (tb - b);
+    const V al = a - ah, bl = b - bh;
+    err = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+    return p;
+}
+
+// two_sum {{{1
+/**\internal
+ * Returns a + b and stores its rounding error in \p err (Knuth's branch-free two-sum).
+ */
+template <class V> Vc_INTRINSIC V two_sum(const V &a, const V &b, V &err)
+{
+    const V s = a + b;
+    const V bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+// log_dd {{{1
+/**\internal
+ * Returns ln(\p x) as the unevaluated sum of the return value and \p lo, with a relative
+ * error below 2⁻⁶¹, for positive finite \p x. pow needs the extra bits: an error δ in
+ * y · ln(x) becomes a relative error δ of the result.
+ *
+ * The reduction is the one of LogImpl::calc: x = 2ᵉ · m with m ∈ [√½, √2[. ln(m) is
+ * evaluated as 2·atanh(s) = 2s + ⅔s³ + s⁵·R(s²), with s = (m - 1) / (m + 1). The first two
+ * terms are carried as double-double, R is the Taylor series up to s²⁰ and small enough
+ * for plain arithmetic.
+ */
+template <class Abi>
+Vc_INTRINSIC Vector<double, Abi> log_dd(Vector<double, Abi> x, Vector<double, Abi> &lo)
+{
+    using V = Vector<double, Abi>;
+    typedef Detail::Const<double, Abi> C;
+
+    const auto denormal = x < C::min();
+    x(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());
+    V e = Detail::exponent(x.data());
+    e(denormal) -= V(54.);
+    x.setZero(C::exponentMask());
+    x = Detail::operator|(x, C::_1_2());  // x ∈ [½, 1[
+    const auto smallX = x < C::_1_sqrt2();
+    x(smallX) += x;  // x ∈ [√½, √2[
+    e(!smallX) += V::One();
+
+    const V f = x - V::One();  // exact
+    const V d = f + V(2.);
+    const V dlo = f - (d - V(2.));  // d + dlo == 2 + f
+    const V s = f / d;
+    V plo;
+    const V p = two_prod(s, d, plo);
+    // (f - s·(d + dlo)) / d is the remainder of the division; f - p is exact
+    const V slo = (((f - p) - plo) - s * dlo) / d;
+
+    // s² and s³ as double-double
+    V zlo;
+    const V z = two_prod(s, s, zlo);
+    zlo = madd(s + s, slo, zlo);
+    V s3lo;
+    const V s3 = two_prod(z, s, s3lo);
+    s3lo = madd(z, slo, madd(zlo, s, s3lo));
+
+    // ⅔ · s³, with ⅔ as double-double
+    V t1lo;
+    const V t1 = two_prod(s3, V(6.666666666666666296592e-01), t1lo);
+    t1lo = madd(s3, V(3.700743415417188e-17), madd(s3lo, V(6.666666666666666296592e-01), t1lo));
+
+    // R(z) = Σ 2 / (2k + 5) · zᵏ; |z| < 0.0295 makes the truncation error < 2⁻⁷⁰
+    const V r = Vc::polynomial(z, 2. / 25., 2. / 23., 2. / 21., 2. / 19., 2. / 17.,
+                               2. / 15., 2. / 13., 2. / 11., 2. / 9., 2. / 7., 2. / 5.);
+    const V t2 = (s3 * z) * r;
+
+    // e · ln(2) = e · ln2_hi + e · ln2_lo, where e · ln2_hi is exact
+    V err0, err1;
+    V hi = two_sum(e * V(6.93147180369123816490e-01), s + s, err0);
+    hi = two_sum(hi, t1, err1);
+    lo = (err0 + err1) + ((slo + slo) + madd(e, V(1.90821492927058770002e-10), t1lo + t2));
+    const V sum = hi + lo;
+    lo -= sum - hi;
+    return sum;
+}
+
+// pow_fixup {{{1
+/**\internal
+ * Applies the special cases of C99 Annex F to \p r, which holds |x|ʸ for finite non-zero
+ * x and finite y.
+ */
+template <class V> Vc_INTRINSIC V pow_fixup(V r, const V &x, const V &y)
+{
+    using T = typename V::EntryType;
+    const V inf = std::numeric_limits<T>::infinity();
+    const V ax = abs(x);
+    const V yhalf = y * V(T(0.5));
+    const auto integral = trunc(y) == y;
+    const auto odd = integral && trunc(yhalf) != yhalf;
+
+    const auto ax_below_1 = ax < V::One();
+    const auto y_negative = y < V::Zero();
+    r(ax == V::Zero()) = iif(y_negative, inf, V::Zero());
+    r(ax == inf) = iif(y_negative, V::Zero(), inf);
+    // |x| < 1 and y = -∞, or |x| > 1 and y = +∞ diverge; the reverse vanish
+    r(isinf(y)) = iif(ax_below_1 ^ y_negative, V::Zero(), inf);
+    // |x| = 1 also catches a non-finite y · ln|x| (Dekker's split overflows for huge y)
+    r(ax == V::One()) = V::One();
+
+    // an odd integral power keeps the sign of x (including -0 and -∞)
+    r(odd) = copysign(r, x);
+    r.setQnan((x < V::Zero() && !integral && isfinite(x)) || isnan(x) || isnan(y));
+    r(y == V::Zero() || x == V::One()) = V::One();
+    return r;
+}
+
+// cbrt_reduced {{{1
+/**\internal
+ * Returns an approximation of ∛m for m ∈ [½, 1[ with a relative error of 9.2 · 10⁻⁶
+ * (Cephes).
+ */
+template <class V> Vc_INTRINSIC V cbrt_reduced(const V &m)
+{
+    return Vc::polynomial(m, -1.3466110473359520655053e-1, 5.4664601366395524503440e-1,
+                          -9.5438224771509446525043e-1, 1.1399983354717293273738e0,
+                          4.0238979564544752126924e-1);
+}
+
+// HypotTraits {{{1
+/**\internal
+ * hypot scales |x| and |y| by a power of two if the larger one is outside
+ * [small(), large()], such that its square cannot overflow and the square of its
+ * scaled value cannot underflow.
+ */
+template <class T> struct HypotTraits;
+template <> struct HypotTraits<float> {
+    static constexpr float large() { return Vc::Detail::floatConstant<1, 0, 60>(); }
+    static constexpr float small() { return Vc::Detail::floatConstant<1, 0, -60>(); }
+    static constexpr float scale_down() { return Vc::Detail::floatConstant<1, 0, -70>(); }
+    static constexpr float scale_up() { return Vc::Detail::floatConstant<1, 0, 90>(); }
+};
+template <> struct HypotTraits<double> {
+    // doubleConstant recurses over the exponent, which is too deep for these
+    static constexpr double large() { return 3.273390607896142e+150; }       // 2⁵⁰⁰
+    static constexpr double small() { return 3.054936363499605e-151; }       // 2⁻⁵⁰⁰
+    static constexpr double scale_down() { return 2.409919865102884e-181; }  // 2⁻⁶⁰⁰
+    static constexpr double scale_up() { return 5.260135901548374e+210; }    // 2⁷⁰⁰
+};
+//}}}1
+}  // namespace Detail
+
+// pow {{{1
+/**\internal
+ * float: y · ln|x| in double precision is exact enough for any float result.
+ */
+template <typename Abi>
+inline Vector<float, Detail::math_abi<float, Abi>> pow(Vector<float, Abi> x,
+                                                         Vector<float, Abi> y)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    const D r = exp(simd_cast<D>(y) * log(simd_cast<D>(abs(x))));
+    return Detail::pow_fixup(simd_cast<V>(r), x, y);
+}
+
+/**\internal
+ * double: ln|x| and its product with y are computed as double-double, and the low part is
+ * added to the reduced argument of exp.
+ */
+template <typename Abi>
+inline Vector<double, Detail::math_abi<double, Abi>> pow(Vector<double, Abi> x,
+                                                           Vector<double, Abi> y)
+{
+    using V = Vector<double, Abi>;
+    using Traits = Detail::ExpTraits<double>;
+    V llo;
+    const V l = Detail::log_dd(abs(x), llo);
+    V plo;
+    const V p = Detail::two_prod(y, l, plo);
+    plo = Detail::madd(y, llo, plo);
+
+    SimdArray<int, V::Size> n;
+    const V r = Detail::exp_reduce(p, n) + plo;
+    V ret = Detail::exp_scale(V::One() + Detail::expm1_reduced(r), n);
+    ret(p > Traits::max_log()) = std::numeric_limits<double>::infinity();
+    ret.setZero(p < Traits::min_log());
+    return Detail::pow_fixup(ret, x, y);
+}
+
+// cbrt {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> cbrt(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    typedef Detail::Const<T, Abi> C;
+
+    // ∛(2⁵⁴ · x) = 2¹⁸ · ∛x
+    V ax = abs(x);
+    const auto denormal = ax < C::min();
+    ax(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());
+
+    // |x| = 2ᵉ · m, m ∈ [½, 1[ and e = 3q + rem: ∛|x| = 2^q · ∛(2^rem) · ∛m
+    const V e = Detail::exponent(ax.data()) + V::One();
+    V m = ax;
+    m.setZero(C::exponentMask());
+    m = Detail::operator|(m, C::_1_2());
+    const V q = floor((e + V(T(0.5))) * V(T(1) / T(3)));
+    const V rem = e - V(T(3)) * q;
+    V r = Detail::cbrt_reduced(m);
+    r(rem == V::One()) *= V(T(1.2599210498948731647672106));  // ∛2
+    r(rem == V(T(2))) *= V(T(1.5874010519681994747517056));  // ∛4
+    r = ldexp(r, simd_cast<SimdArray<int, V::Size>>(q));
+
+    // Newton iterations: each one doubles the 17 correct bits of cbrt_reduced
+    r -= (r - ax / (r * r)) * V(T(1) / T(3));
+    if (std::is_same<T, double>::value) {
+        r -= (r - ax / (r * r)) * V(T(1) / T(3));
+    }
+
+    r(denormal) *= V(Vc::Detail::doubleConstant<1, 0, -18>());
+    r = copysign(r, x);
+    r(x == V::Zero() || !isfinite(x)) = x;
+    return r;
+}
+
+// hypot {{{1
+template <typename T, typename Abi>
+inline Vector<T, Detail::math_abi<T, Abi>> hypot(Vector<T, Abi> x, Vector<T, Abi> y)
+{
+    using V = Vector<T, Abi>;
+    using Traits = Detail::HypotTraits<T>;
+    x = abs(x);
+    y = abs(y);
+    const V a = max(x, y);
+    V scale = V::One();
+    scale(a > Traits::large()) = Traits::scale_down();
+    scale(a < Traits::small()) = Traits::scale_up();
+    const V xs = x * scale;
+    const V ys = y * scale;
+    V r = sqrt(Detail::madd(xs, xs, ys * ys)) * (V::One() / scale);
+
+    r.setQnan(isnan(x) || isnan(y));
+    r(isinf(x) || isinf(y)) = std::numeric_limits<T>::infinity();
+    return r;
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -0,0 +1,72 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PRECISION_H_
+#define VC_COMMON_PRECISION_H_
+
+#include "../traits/type_traits.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Math
+ *
+ * Tags that select between the implementations of a math function. Pass them as the last
+ * argument, e.g. `Vc::sin(x, Vc::Precision::Fast)`. Without a tag the default
+ * implementation is used. The error bounds of each tier are listed with the function and
+ * checked by the unit tests.
+ *
+ * Functions without a dedicated fast implementation accept Precision::Fast and use the
+ * default one. Where Precision::Accurate has no dedicated implementation, float is
+ * evaluated in double and double uses the default implementation.
+ */
+namespace Precision
+{
+struct FastTag {};
+struct DefaultTag {};
+struct AccurateTag {};
+
+/// Shorter approximations and fewer special cases, with an error of a few ulp.
+constexpr FastTag Fast = {};
+/// The implementation that is used without a tag.
+constexpr DefaultTag Default = {};
+/// An error close to the last bit.
+constexpr AccurateTag Accurate = {};
+}  // namespace Precision
+
+namespace Traits
+{
+template <typename T> struct is_precision_tag : public std::false_type {};
+template <> struct is_precision_tag<Precision::FastTag> : public std::true_type {};
+template <> struct is_precision_tag<Precision::DefaultTag> : public std::true_type {};
+template <> struct is_precision_tag<Precision::AccurateTag> : public std::true_type {};
+}  // namespace Traits
+}  // namespace Vc
+
+#endif  // VC_COMMON_PRECISION_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,284 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SEARCHTREE_H_
+#define VC_COMMON_SEARCHTREE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include "make_unique.h"
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile searchtree.h <Vc/Vc>
+ *
+ * A static search index over a sorted sequence of keys, for read-mostly key sets.
+ *
+ * The keys are stored in an implicit search tree with \ref NodeSize keys per node and
+ * NodeSize + 1 children per node. A node fills one cacheline (at least one vector) and
+ * the nodes are allocated on a cacheline boundary, thus visiting a node costs at most one
+ * cache miss. The child to descend into is the number of keys in the node that are less
+ * than the search key, determined with a vector compare and Mask::count() per vector of
+ * the node. Compared to a binary search over the sorted keys this reduces the depth by a
+ * factor of log2(NodeSize + 1) and leaves no data-dependent branch to mispredict.
+ *
+ * All lookups return positions in the sorted sequence the tree was built from. The tree
+ * does not keep a copy of that sequence in sorted order.
+ *
+ * Example:
+ * \code
+ * std::vector<float> sorted = ...;
+ * Vc::SimdSearchTree<float> index(sorted.begin(), sorted.end());
+ * std::size_t pos = index.lower_bound(1.f);  // == std::lower_bound(...) - sorted.begin()
+ * \endcode
+ *
+ * \tparam T An arithmetic type that is vectorizable (see simdize).
+ */
+template <typename T> class SimdSearchTree
+{
+public:
+    typedef T value_type;
+    /// The vector type used to compare the keys of a node.
+    typedef simdize<T> vector_type;
+    static_assert(Traits::is_simd_vector<vector_type>::value,
+                  "SimdSearchTree requires an arithmetic value type that is "
+                  "vectorizable");
+
+private:
+    typedef vector_type V;
+    typedef typename V::IndexType IndexType;
+    static constexpr std::size_t CachelineSize = 64;
+
+public:
+    /// The number of keys stored in one node: one cacheline, but at least one vector.
+    static constexpr std::size_t NodeSize =
+        CachelineSize / sizeof(T) > V::Size ? CachelineSize / sizeof(T) : V::Size;
+
+    /// Constructs an empty tree.
+    SimdSearchTree()
+        : SimdSearchTree(static_cast<const T *>(nullptr), static_cast<const T *>(nullptr))
+    {
+    }
+
+    /**
+     * Builds the tree from the keys in [\p first, \p last), which must be sorted in
+     * ascending order and must have less than `INT_MAX` entries.
+     */
+    template <class ForwardIt>
+    SimdSearchTree(ForwardIt first, ForwardIt last)
+        : count(std::distance(first, last))
+        , nodes((count + NodeSize - 1) / NodeSize)
+        , fullLevels(0)
+        , keys(Vc::malloc<T, Vc::AlignOnCacheline>(
+              std::max<std::size_t>(1, nodes * NodeSize)))
+        , ranks(Vc::malloc<int, Vc::AlignOnCacheline>(nodes * NodeSize + 1))
+    {
+        Vc_ASSERT(count < std::size_t(std::numeric_limits<int>::max()));
+        // the levels above the last one are complete
+        for (std::size_t levelNodes = 1, total = 1; total <= nodes;
+             levelNodes *= NodeSize + 1, total += levelNodes) {
+            ++fullLevels;
+        }
+        std::size_t rank = 0;
+        fill(0, first, rank);
+        // the result if no key is greater or equal
+        ranks.get()[nodes * NodeSize] = int(count);
+    }
+
+    SimdSearchTree(SimdSearchTree &&) = default;
+    SimdSearchTree &operator=(SimdSearchTree &&) = default;
+
+    /// Returns the number of keys.
+    std::size_t size() const { return count; }
+
+    /**
+     * Returns the position of the first key that is not less than \p key, or size() if
+     * there is none (like `std::lower_bound`).
+     */
+    std::size_t lower_bound(T key) const
+    {
+        std::size_t best;
+        lookup<1>(&key, &best);
+        return ranks.get()[best];
+    }
+
+    /// Returns the position of \p key, or size() if the tree does not contain it.
+    std::size_t find(T key) const
+    {
+        std::size_t best;
+        lookup<1>(&key, &best);
+        return best < nodes * NodeSize && keys.get()[best] == key ? ranks.get()[best]
+                                                                  : count;
+    }
+
+    /// Returns whether the tree contains \p key.
+    bool contains(T key) const { return find(key) != count; }
+
+    /**
+     * Returns the positions [first, last) of the keys in the half-open interval
+     * [\p lo, \p hi).
+     */
+    std::pair<std::size_t, std::size_t> range(T lo, T hi) const
+    {
+        const T bounds[2] = {lo, hi};
+        std::size_t best[2];
+        lookup<2>(bounds, best);
+        const std::size_t first = ranks.get()[best[0]];
+        return {first, std::max<std::size_t>(first, ranks.get()[best[1]])};
+    }
+
+    /**
+     * Returns the lower bound of every entry of \p keys. The lanes descend the tree
+     * interleaved, so that their cache misses overlap.
+     */
+    IndexType lower_bound(const V &keys_v) const
+    {
+        T k[V::Size];
+        keys_v.store(k, Vc::Unaligned);
+        std::size_t best[V::Size];
+        lookup<V::Size>(k, best);
+        return IndexType([&](std::size_t j) { return ranks.get()[best[j]]; });
+    }
+
+    /**
+     * Writes the lower bound of every key in [\p first, \p last) to \p out.
+     *
+     * \return The end of the output range.
+     */
+    template <class InputIt, class OutputIt>
+    OutputIt lower_bound(InputIt first, InputIt last, OutputIt out) const
+    {
+        constexpr std::size_t Group = 16;
+        T k[Group];
+        std::size_t best[Group];
+        while (first != last) {
+            std::size_t n = 0;
+            for (; n < Group && first != last; ++n, ++first) {
+                k[n] = *first;
+            }
+            for (std::size_t j = n; j < Group; ++j) {
+                k[j] = k[0];
+            }
+            lookup<Group>(k, best);
+            for (std::size_t j = 0; j < n; ++j) {
+                *out++ = ranks.get()[best[j]];
+            }
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t child(std::size_t node, std::size_t i)
+    {
+        return node * (NodeSize + 1) + i + 1;
+    }
+
+    // stores the keys from it to the nodes in the subtree at node, in order
+    template <class ForwardIt>
+    void fill(std::size_t node, ForwardIt &it, std::size_t &rank)
+    {
+        if (node >= nodes) {
+            return;
+        }
+        for (std::size_t i = 0; i < NodeSize; ++i) {
+            fill(child(node, i), it, rank);
+            const std::size_t slot = node * NodeSize + i;
+            if (rank < count) {
+                keys.get()[slot] = *it;
+                ranks.get()[slot] = int(rank);
+                ++it;
+                ++rank;
+            } else {
+                // padding must keep the in-order sequence sorted
+                keys.get()[slot] = std::numeric_limits<T>::has_infinity
+                                       ? std::numeric_limits<T>::infinity()
+                                       : std::numeric_limits<T>::max();
+                ranks.get()[slot] = int(count);
+            }
+        }
+        fill(child(node, NodeSize), it, rank);
+    }
+
+    // visits node and returns the child to descend into; the first key in the node that
+    // is not less than key is a better candidate than any key visited before
+    Vc_ALWAYS_INLINE std::size_t step(std::size_t node, const V &key,
+                                      std::size_t &best) const
+    {
+        const T *mem = keys.get() + node * NodeSize;
+        std::size_t i = 0;
+        for (std::size_t v = 0; v < NodeSize; v += V::Size) {
+            i += (V(mem + v, Vc::Aligned) < key).count();
+        }
+        best = i < NodeSize ? node * NodeSize + i : best;
+        return child(node, i);
+    }
+
+    // descends the tree for G keys in lockstep and stores the slot of their lower bounds
+    // to best (nodes * NodeSize if there is none)
+    template <std::size_t G>
+    Vc_ALWAYS_INLINE void lookup(const T *k, std::size_t *best) const
+    {
+        V key[G];
+        std::size_t node[G];
+        for (std::size_t g = 0; g < G; ++g) {
+            key[g] = V(k[g]);
+            node[g] = 0;
+            best[g] = nodes * NodeSize;
+        }
+        for (std::size_t level = 0; level < fullLevels; ++level) {
+            for (std::size_t g = 0; g < G; ++g) {
+                node[g] = step(node[g], key[g], best[g]);
+            }
+        }
+        // the last level is incomplete
+        for (std::size_t g = 0; g < G; ++g) {
+            if (node[g] < nodes) {
+                step(node[g], key[g], best[g]);
+            }
+        }
+    }
+
+    std::size_t count;
+    std::size_t nodes;
+    std::size_t fullLevels;
+    std::unique_ptr<T, Common::Deleter<T>> keys;
+    std::unique_ptr<int, Common::Deleter<int>> ranks;
+};
+
+template <typename T> constexpr std::size_t SimdSearchTree<T>::NodeSize;
+}  // namespace Vc
+
+#endif  // VC_COMMON_SEARCHTREE_H_
+
+// vim: foldmethod=marker
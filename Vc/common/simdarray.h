@@ -119,9 +119,11 @@ class SimdArray<T, N, VectorType_, N>
                       std::is_same<T, int32_t>::value ||
                       std::is_same<T, uint32_t>::value ||
                       std::is_same<T, int16_t>::value ||
-                      std::is_same<T, uint16_t>::value,
+                      std::is_same<T, uint16_t>::value ||
+                      std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value ||
+                      std::is_same<T, llong>::value || std::is_same<T, ullong>::value,
                   "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, "
-                  "int16_t, uint16_t }");
+                  "int16_t, uint16_t, int8_t, uint8_t, llong, ullong }");
     static_assert(
         std::is_same<VectorType_,
                      typename Common::select_best_vector_type<T, N>::type>::value &&
@@ -291,7 +293,7 @@ public:
 
     // load ctor
     template <class U, class Flags = DefaultLoadTag,
-              class = enable_if<std::is_arithmetic<U>::value &&
+              class = enable_if<Traits::is_load_store_type<U, T>::value &&
                                 Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(const U *mem, Flags f = {}) : data(mem, f)
     {
@@ -620,7 +622,11 @@ template <typename T, size_t N, typename V, size_t Wt> class SimdArray
                   std::is_same<T,  int32_t>::value ||
                   std::is_same<T, uint32_t>::value ||
                   std::is_same<T,  int16_t>::value ||
-                  std::is_same<T, uint16_t>::value, "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, int16_t, uint16_t }");
+                  std::is_same<T, uint16_t>::value ||
+                  std::is_same<T,   int8_t>::value ||
+                  std::is_same<T,  uint8_t>::value ||
+                  std::is_same<T,    llong>::value ||
+                  std::is_same<T,   ullong>::value, "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, int16_t, uint16_t, int8_t, uint8_t, llong, ullong }");
     static_assert(
         std::is_same<V, typename Common::select_best_vector_type<T, N>::type>::value &&
             V::size() == Wt,
@@ -769,7 +775,7 @@ public:
 
     // load ctor
     template <typename U, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(const U *mem, Flags f = {})
         : data0(mem, f), data1(mem + storage_type0::size(), f)
@@ -785,7 +791,7 @@ public:
      * from C-arrays.
      */
     template <typename U, std::size_t Extent, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(CArray<U, Extent> &mem, Flags f = {})
         : data0(&mem[0], f), data1(&mem[storage_type0::size()], f)
@@ -795,7 +801,7 @@ public:
      * Const overload of the above.
      */
     template <typename U, std::size_t Extent, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(const CArray<U, Extent> &mem, Flags f = {})
         : data0(&mem[0], f), data1(&mem[storage_type0::size()], f)
@@ -1754,6 +1760,103 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
 ///@}
 #undef Vc_BINARY_OPERATORS_
 
+// ldexp and frexp {{{1
+namespace Detail
+{
+/**\internal
+ * The exponents for the first and second half of a composite SimdArray<T, N>. The int
+ * SimdArray is split at the same index, unless it is a single vector.
+ */
+template <std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC const fixed_size_simd<int, int(Common::left_size<N>())> &ldexp_exponent0(
+    const SimdArray<int, N, V, M> &e)
+{
+    return internal_data0(e);
+}
+template <std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC const fixed_size_simd<int, int(N - Common::left_size<N>())> &ldexp_exponent1(
+    const SimdArray<int, N, V, M> &e)
+{
+    return internal_data1(e);
+}
+template <std::size_t N, class V>
+Vc_INTRINSIC fixed_size_simd<int, int(Common::left_size<N>())> ldexp_exponent0(
+    const SimdArray<int, N, V, N> &e)
+{
+    return simd_cast<fixed_size_simd<int, int(Common::left_size<N>())>>(e);
+}
+template <std::size_t N, class V>
+Vc_INTRINSIC fixed_size_simd<int, int(N - Common::left_size<N>())> ldexp_exponent1(
+    const SimdArray<int, N, V, N> &e)
+{
+    static_assert(2 * Common::left_size<N>() == N, "");
+    return simd_cast<fixed_size_simd<int, int(N - Common::left_size<N>())>, 1>(e);
+}
+
+/**\internal
+ * Splits \p x down to native vectors and calls their ldexp overloads directly. The
+ * exponents are not always split like \p x (e.g. SimdArray<double, 8> is two AVX vectors,
+ * while SimdArray<int, 8> is one), thus fromOperation would have to find the matching
+ * conversion in its overload search, which picks the wrong overload for some sizes.
+ */
+template <class T, std::size_t N, class V>
+Vc_INTRINSIC fixed_size_simd<T, int(N)> ldexp(const SimdArray<T, N, V, N> &x,
+                                              const SimdArray<int, N> &e)
+{
+    return {private_init, ldexp(internal_data(x), e)};
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC fixed_size_simd<T, int(N)> ldexp(const SimdArray<T, N, V, M> &x,
+                                              const SimdArray<int, N> &e)
+{
+    return {Detail::ldexp(internal_data0(x), ldexp_exponent0(e)),
+            Detail::ldexp(internal_data1(x), ldexp_exponent1(e))};
+}
+
+/**\internal
+ * Stores the exponents of the two halves, the inverse of ldexp_exponent0/1.
+ */
+template <std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC void frexp_exponents(
+    SimdArray<int, N, V, M> *e, fixed_size_simd<int, int(Common::left_size<N>())> &&e0,
+    fixed_size_simd<int, int(N - Common::left_size<N>())> &&e1)
+{
+    internal_data0(*e) = std::move(e0);
+    internal_data1(*e) = std::move(e1);
+}
+template <std::size_t N, class V>
+Vc_INTRINSIC void frexp_exponents(
+    SimdArray<int, N, V, N> *e, fixed_size_simd<int, int(Common::left_size<N>())> &&e0,
+    fixed_size_simd<int, int(N - Common::left_size<N>())> &&e1)
+{
+    *e = simd_cast<SimdArray<int, N, V, N>>(e0, e1);
+}
+
+/**\internal
+ * The same for frexp. The exponents are written to the temporaries e0 and e1; passing
+ * pointers into \p e would make the native overloads store an int vector through a
+ * pointer to a different type, which ldexp and the caller cannot see with strict
+ * aliasing.
+ */
+template <class T, std::size_t N, class V>
+Vc_INTRINSIC fixed_size_simd<T, int(N)> frexp(const SimdArray<T, N, V, N> &x,
+                                              SimdArray<int, N> *e)
+{
+    return {private_init, frexp(internal_data(x), e)};
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC fixed_size_simd<T, int(N)> frexp(const SimdArray<T, N, V, M> &x,
+                                              SimdArray<int, N> *e)
+{
+    fixed_size_simd<int, int(Common::left_size<N>())> e0;
+    fixed_size_simd<int, int(N - Common::left_size<N>())> e1;
+    fixed_size_simd<T, int(N)> r = {Detail::frexp(internal_data0(x), &e0),
+                                    Detail::frexp(internal_data1(x), &e1)};
+    frexp_exponents(e, std::move(e0), std::move(e1));
+    return r;
+}
+}  // namespace Detail
+
 // math functions {{{1
 #define Vc_FORWARD_UNARY_OPERATOR(name_)                                                 \
     /*!\brief Applies the std::name_ function component-wise and concurrently. */        \
@@ -1798,19 +1901,58 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
     }                                                                                    \
     Vc_NOTHING_EXPECTING_SEMICOLON
 
+#define Vc_FORWARD_PRECISION_OPERATOR(name_)                                             \
+    Vc_FORWARD_UNARY_OPERATOR(name_);                                                    \
+    /*!\brief Applies name_ with the implementation selected by \p tag. */               \
+    template <typename T, std::size_t N, typename V, std::size_t M, typename Tag,        \
+              typename = enable_if<Traits::is_precision_tag<Tag>::value>>                \
+    inline fixed_size_simd<T, N> name_(const SimdArray<T, N, V, M> &x, Tag tag)          \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, tag);                              \
+    }                                                                                    \
+    template <class T, int N, typename Tag,                                              \
+              typename = enable_if<Traits::is_precision_tag<Tag>::value>>                \
+    fixed_size_simd<T, N> name_(const fixed_size_simd<T, N> &x, Tag tag)                 \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, tag);                              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+#define Vc_FORWARD_BINARY_PRECISION_OPERATOR(name_)                                      \
+    Vc_FORWARD_BINARY_OPERATOR(name_);                                                   \
+    /*!\brief Applies name_ with the implementation selected by \p tag. */               \
+    template <typename T, std::size_t N, typename V, std::size_t M, typename Tag,        \
+              typename = enable_if<Traits::is_precision_tag<Tag>::value>>                \
+    inline fixed_size_simd<T, N> name_(const SimdArray<T, N, V, M> &x,                   \
+                                       const SimdArray<T, N, V, M> &y, Tag tag)          \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, y, tag);                           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
 /**
  * \name Math functions
  * These functions evaluate the
  */
 ///@{
 Vc_FORWARD_UNARY_OPERATOR(abs);
-Vc_FORWARD_UNARY_OPERATOR(asin);
-Vc_FORWARD_UNARY_OPERATOR(atan);
-Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_BINARY_OPERATOR(add_sat);
+Vc_FORWARD_PRECISION_OPERATOR(asin);
+Vc_FORWARD_PRECISION_OPERATOR(atan);
+Vc_FORWARD_BINARY_PRECISION_OPERATOR(atan2);
+Vc_FORWARD_PRECISION_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
-Vc_FORWARD_UNARY_OPERATOR(cos);
-Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_PRECISION_OPERATOR(cos);
+Vc_FORWARD_PRECISION_OPERATOR(erf);
+Vc_FORWARD_PRECISION_OPERATOR(erfc);
+Vc_FORWARD_PRECISION_OPERATOR(exp);
+Vc_FORWARD_PRECISION_OPERATOR(exp10);
+Vc_FORWARD_PRECISION_OPERATOR(exp2);
+Vc_FORWARD_PRECISION_OPERATOR(expm1);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1828,28 +1970,42 @@ Vc_FORWARD_UNARY_BOOL_OPERATOR(isnegative);
 template <typename T, std::size_t N>
 inline SimdArray<T, N> frexp(const SimdArray<T, N> &x, SimdArray<int, N> *e)
 {
-    return SimdArray<T, N>::fromOperation(Common::Operations::Forward_frexp(), x, e);
+    return Detail::frexp(x, e);
 }
 /// Applies the std::ldexp function component-wise and concurrently.
 template <typename T, std::size_t N>
 inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &e)
 {
-    return SimdArray<T, N>::fromOperation(Common::Operations::Forward_ldexp(), x, e);
+    return Detail::ldexp(x, e);
 }
-Vc_FORWARD_UNARY_OPERATOR(log);
-Vc_FORWARD_UNARY_OPERATOR(log10);
-Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_BINARY_PRECISION_OPERATOR(hypot);
+Vc_FORWARD_PRECISION_OPERATOR(log);
+Vc_FORWARD_PRECISION_OPERATOR(log10);
+Vc_FORWARD_PRECISION_OPERATOR(log1p);
+Vc_FORWARD_PRECISION_OPERATOR(log2);
+Vc_FORWARD_BINARY_PRECISION_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
-Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_PRECISION_OPERATOR(sigmoid);
+Vc_FORWARD_PRECISION_OPERATOR(sin);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
 {
     SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
 }
+/// Determines sine and cosine with the implementation selected by \p tag.
+template <typename T, std::size_t N, typename Tag,
+          typename = enable_if<Traits::is_precision_tag<Tag>::value>>
+void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos, Tag tag)
+{
+    SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos,
+                                   tag);
+}
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_BINARY_OPERATOR(sub_sat);
+Vc_FORWARD_PRECISION_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
@@ -1857,6 +2013,8 @@ Vc_FORWARD_BINARY_OPERATOR(max);
 #undef Vc_FORWARD_UNARY_OPERATOR
 #undef Vc_FORWARD_UNARY_BOOL_OPERATOR
 #undef Vc_FORWARD_BINARY_OPERATOR
+#undef Vc_FORWARD_PRECISION_OPERATOR
+#undef Vc_FORWARD_BINARY_PRECISION_OPERATOR
 
 // simd_cast {{{1
 #ifdef Vc_MSVC
@@ -220,9 +220,11 @@ struct is_class_template<C<Ts...>> : public true_type
  */
 template <typename T> constexpr Category typeCategory()
 {
-    return (is_same<T, bool>::value || is_same<T, short>::value ||
+    return (is_same<T, bool>::value || is_same<T, signed char>::value ||
+            is_same<T, unsigned char>::value || is_same<T, short>::value ||
             is_same<T, unsigned short>::value || is_same<T, int>::value ||
-            is_same<T, unsigned int>::value || is_same<T, float>::value ||
+            is_same<T, unsigned int>::value || is_same<T, long long>::value ||
+            is_same<T, unsigned long long>::value || is_same<T, float>::value ||
             is_same<T, double>::value)
                ? Category::ArithmeticVectorizable
                : iteratorCategories<T>(int()) != Category::None
@@ -1267,7 +1269,8 @@ inline void load_interleaved(SimdizeDetail::Adapter<S, T, N> &a, const S *mem)
 }
 template <
     class V, class T,
-    class = enable_if<Traits::is_simd_vector<V>::value && std::is_arithmetic<T>::value>>
+    class = enable_if<Traits::is_simd_vector<V>::value &&
+                      Traits::is_load_store_type<T, typename V::EntryType>::value>>
 Vc_INTRINSIC void load_interleaved(V &a, const T *mem)
 {
     a.load(mem, Vc::Unaligned);
@@ -1288,7 +1291,8 @@ inline void store_interleaved(const SimdizeDetail::Adapter<S, T, N> &a, S *mem)
 }
 template <
     class V, class T,
-    class = enable_if<Traits::is_simd_vector<V>::value && std::is_arithmetic<T>::value>>
+    class = enable_if<Traits::is_simd_vector<V>::value &&
+                      Traits::is_load_store_type<T, typename V::EntryType>::value>>
 Vc_INTRINSIC void store_interleaved(const V &a, T *mem)
 {
     a.store(mem, Vc::Unaligned);
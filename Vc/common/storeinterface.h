@@ -38,7 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_load_store_type<U, EntryType>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 /**
@@ -58,7 +59,8 @@ Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_load_store_type<U, EntryType>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void Vc_VDECL store(U *mem, MaskType mask, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 //@{
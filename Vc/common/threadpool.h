@@ -0,0 +1,97 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile threadpool.h <Vc/Vc>
+ *
+ * A small work-stealing thread pool used by the parallel algorithms (e.g.
+ * parallel_simd_for_each).
+ *
+ * The work submitted via run() is a number of independent chunks, identified by their
+ * index. Every participating thread (the calling thread and the worker threads) starts
+ * with an equal share of consecutive chunk indexes and processes them in order. A thread
+ * that runs out of work steals the upper half of the remaining chunks of another thread.
+ * Thus, neighboring chunks are preferably processed by the same thread.
+ *
+ * Calls to run() from different threads are serialized. A call to run() from inside a
+ * running chunk (nested parallelism) executes all chunks on the calling thread.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * Starts \p nthreads - 1 worker threads. The thread calling run() is the remaining
+     * participant.
+     *
+     * \param nthreads The number of threads that process chunks concurrently. The default
+     *                 value 0 uses `std::thread::hardware_concurrency()`.
+     */
+    explicit ThreadPool(std::size_t nthreads = 0);
+    /// Stops and joins all worker threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// Returns the number of threads that participate in run().
+    std::size_t size() const;
+
+    /**
+     * Calls \p task with every index in the range [0, \p chunks) and returns after all
+     * calls have finished. The calls execute concurrently on the threads of the pool.
+     *
+     * If any call to \p task throws, the remaining chunks are still processed and the
+     * first exception is rethrown from run().
+     */
+    void run(std::size_t chunks, const std::function<void(std::size_t)> &task);
+
+    /**
+     * Returns the pool used by the parallel algorithms if no pool is passed explicitly.
+     * It is constructed on first use with the default number of threads.
+     */
+    static ThreadPool &global();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> d;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_THREADPOOL_H_
+
+// vim: foldmethod=marker
@@ -66,6 +66,10 @@ template<typename Impl> struct Trigonometric
     template<typename T> static T Vc_VDECL sin(const T &_x);
     template<typename T> static T Vc_VDECL cos(const T &_x);
     template<typename T> static void Vc_VDECL sincos(const T &_x, T *_sin, T *_cos);
+    template<typename T> static T Vc_VDECL sin(const T &_x, Precision::FastTag);
+    template<typename T> static T Vc_VDECL cos(const T &_x, Precision::FastTag);
+    template<typename T> static void Vc_VDECL sincos(const T &_x, T *_sin, T *_cos,
+                                                     Precision::FastTag);
     template<typename T> static T Vc_VDECL asin (const T &_x);
     template<typename T> static T Vc_VDECL atan (const T &_x);
     template<typename T> static T Vc_VDECL atan2(const T &y, const T &x);
@@ -81,6 +85,17 @@ using Trig = Common::Trigonometric<Detail::TrigonometricImplementation<
     (std::is_same<Abi, VectorAbi::Sse>::value
          ? SSE42Impl
          : std::is_same<Abi, VectorAbi::Avx>::value ? AVXImpl : ScalarImpl)>>;
+
+/**\internal
+ * Enables the math functions implemented in Vc/common for float and double with the SSE
+ * and AVX ABIs. Scalar and SimdArray have their own overloads.
+ */
+template <class T, class Abi>
+using math_abi =
+    enable_if<std::is_floating_point<T>::value &&
+                  (std::is_same<Abi, VectorAbi::Sse>::value ||
+                   std::is_same<Abi, VectorAbi::Avx>::value),
+              detail::not_fixed_size_abi<Abi>>;
 }  // namespace Detail
 
 #ifdef Vc_HAVE_LIBMVEC
@@ -133,7 +148,7 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi>
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> sin(const Vector<T, Abi> &x)
 {
-    return Detail::Trig<T, Abi>::sin(x);
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::sin(x.data()));
 }
 
 /**
@@ -150,7 +165,7 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> sin(const Vector<T, Abi>
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi> &x)
 {
-    return Detail::Trig<T, Abi>::cos(x);
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::cos(x.data()));
 }
 #endif
 
@@ -167,7 +182,7 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi>
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> asin(const Vector<T, Abi> &x)
 {
-    return Detail::Trig<T, Abi>::asin(x);
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::asin(x.data()));
 }
 
 /**
@@ -182,7 +197,7 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> asin(const Vector<T, Abi
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> atan(const Vector<T, Abi> &x)
 {
-    return Detail::Trig<T, Abi>::atan(x);
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::atan(x.data()));
 }
 
 /**
@@ -199,7 +214,7 @@ template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> atan2(const Vector<T, Abi> &y,
                                                               const Vector<T, Abi> &x)
 {
-    return Detail::Trig<T, Abi>::atan2(y, x);
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::atan2(y.data(), x.data()));
 }
 
 /**
@@ -218,7 +233,41 @@ Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
                          Vector<T, detail::not_fixed_size_abi<Abi>> *sin,
                          Vector<T, Abi> *cos)
 {
-    Detail::Trig<T, Abi>::sincos(x, sin, cos);
+    Detail::Trig<T, Abi>::sincos(x.data(), &sin->data(), &cos->data());
+}
+
+/**
+ * \ingroup Math
+ *
+ * sin, cos, and sincos with Vc::Precision::Fast use minimax polynomials of lower degree
+ * and fold the input into [-¼π, ¼π] without branches.
+ *
+ * \note The single-precision implementation has an error of max. 3 ulp for
+ * |x| < 39000, the double-precision implementation max. 2 ulp for |x| < 10⁵. The error
+ * grows for larger inputs.
+ *
+ * \note With Vc::Precision::Accurate the single-precision functions are evaluated in
+ * double precision (max. 1 ulp). Vc::Precision::Default selects the functions above.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Detail::math_abi<T, Abi>> sin(const Vector<T, Abi> &x,
+                                                     Precision::FastTag)
+{
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::sin(x.data(), Precision::Fast));
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Detail::math_abi<T, Abi>> cos(const Vector<T, Abi> &x,
+                                                     Precision::FastTag)
+{
+    return Vector<T, Abi>(Detail::Trig<T, Abi>::cos(x.data(), Precision::Fast));
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
+                         Vector<T, Detail::math_abi<T, Abi>> *sin, Vector<T, Abi> *cos,
+                         Precision::FastTag)
+{
+    Detail::Trig<T, Abi>::sincos(x.data(), &sin->data(), &cos->data(),
+                                 Precision::Fast);
 }
 #endif
 }  // namespace Vc_VERSIONED_NAMESPACE
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "vectortraits.h"
 #include "simdarrayfwd.h"
 #include "loadstoreflags.h"
+#include "precision.h"
 #include "writemaskedvector.h"
 #include "detail.h"
 
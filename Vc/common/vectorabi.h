@@ -52,8 +52,11 @@ struct DeduceBest {
             CurrentImplementation::is_between(SSE2Impl, SSE42Impl), Sse,
             typename std::conditional<
                 CurrentImplementation::is(AVXImpl), Avx1Abi<T>,
-                typename std::conditional<CurrentImplementation::is(AVX2Impl), Avx,
-                                          void>::type>::type>::type>::type;
+                typename std::conditional<
+                    CurrentImplementation::is(AVX2Impl) ||
+                        CurrentImplementation::is(AVX512Impl),
+                    Avx,
+                    void>::type>::type>::type>::type;
 };
 template <typename T> using Best = typename DeduceBest<T>::type;
 }  // namespace VectorAbi
@@ -49,8 +49,11 @@ namespace Common
 template <class T, std::size_t N> struct select_best_vector_type;
 }  // namespace Common
 
-template <class T, class Abi> class Mask;
-template <class T, class Abi> class Vector;
+// Vc_IMPL_ABI_TAG (see global.h) must be given on the first declaration
+template <class T, class Abi> class Vc_IMPL_ABI_TAG Mask;
+template <class T, class Abi> class Vc_IMPL_ABI_TAG Vector;
+class float16;
+class bfloat16;
 
 // === having SimdArray<T, N> in the Vc namespace leads to a ABI bug ===
 //
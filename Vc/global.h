@@ -29,7 +29,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_GLOBAL_H_
 
 #include <cstdint>
-#include "fwddecl.h"
 
 #ifdef DOXYGEN
 
@@ -178,6 +177,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SSE4_2 0x00700000
 #define AVX    0x00800000
 #define AVX2   0x00900000
+#define AVX512 0x00A00000
 
 #define XOP    0x00000001
 #define FMA4   0x00000002
@@ -226,6 +226,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef Vc_IMPL
 
 #  if defined(__AVX2__)
+#    if defined __AVX512F__ && defined __AVX512VL__ && defined __AVX512DQ__ &&          \
+        defined __AVX512BW__ && defined __AVX512CD__
+#      define Vc_IMPL_AVX512 1
+#    endif
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
 #  elif defined(__AVX__)
@@ -284,7 +288,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #else // Vc_IMPL
 
-#  if (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
+#  if (Vc_IMPL & IMPL_MASK) == AVX512 // AVX512 supersedes AVX2
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
+#  elif (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
 #  elif (Vc_IMPL & IMPL_MASK) == AVX // AVX supersedes SSE
@@ -387,6 +395,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #        if defined(Vc_IMPL_AVX2)
 #            undef Vc_IMPL_AVX2
 #        endif
+#        if defined(Vc_IMPL_AVX512)
+#            undef Vc_IMPL_AVX512
+#        endif
 #    endif
 #endif
 
@@ -405,6 +416,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef SSE4_2
 #undef AVX
 #undef AVX2
+#undef AVX512
 
 #undef XOP
 #undef FMA4
@@ -431,6 +443,72 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #endif // DOXYGEN
 
+// Vc_IMPL_ABI_TAG {{{
+// Vector and Mask carry the tags of CurrentImplementation in their mangled names. Thus the
+// instantiations of every (non-inlined) function template using them are distinct between
+// translation units compiled for different implementations and the linker cannot replace
+// e.g. the AVX2 copy of Detail::simd_sort_impl with the SSE2 copy (see Vc::Dispatcher).
+#if defined Vc_IMPL_Scalar
+#define Vc_IMPL_TAG_ "scalar"
+#elif defined Vc_IMPL_AVX512
+#define Vc_IMPL_TAG_ "avx512"
+#elif defined Vc_IMPL_AVX2
+#define Vc_IMPL_TAG_ "avx2"
+#elif defined Vc_IMPL_AVX
+#define Vc_IMPL_TAG_ "avx"
+#elif defined Vc_IMPL_SSE4_2
+#define Vc_IMPL_TAG_ "sse42"
+#elif defined Vc_IMPL_SSE4_1
+#define Vc_IMPL_TAG_ "sse41"
+#elif defined Vc_IMPL_SSSE3
+#define Vc_IMPL_TAG_ "ssse3"
+#elif defined Vc_IMPL_SSE3
+#define Vc_IMPL_TAG_ "sse3"
+#elif defined Vc_IMPL_SSE2
+#define Vc_IMPL_TAG_ "sse2"
+#endif
+#if defined Vc_IMPL_SSE4a && defined Vc_IMPL_XOP && defined Vc_IMPL_FMA4
+#define Vc_IMPL_SSE4a_TAG_ , "sse4a", "xop", "fma4"
+#elif defined Vc_IMPL_SSE4a && defined Vc_IMPL_XOP
+#define Vc_IMPL_SSE4a_TAG_ , "sse4a", "xop"
+#elif defined Vc_IMPL_SSE4a
+#define Vc_IMPL_SSE4a_TAG_ , "sse4a"
+#else
+#define Vc_IMPL_SSE4a_TAG_
+#endif
+#ifdef Vc_IMPL_POPCNT
+#define Vc_IMPL_POPCNT_TAG_ , "popcnt"
+#else
+#define Vc_IMPL_POPCNT_TAG_
+#endif
+#ifdef Vc_IMPL_FMA
+#define Vc_IMPL_FMA_TAG_ , "fma"
+#else
+#define Vc_IMPL_FMA_TAG_
+#endif
+#ifdef Vc_IMPL_BMI2
+#define Vc_IMPL_BMI2_TAG_ , "bmi2"
+#else
+#define Vc_IMPL_BMI2_TAG_
+#endif
+#ifdef Vc_USE_VEX_CODING
+#define Vc_IMPL_VEX_TAG_ , "vex"
+#else
+#define Vc_IMPL_VEX_TAG_
+#endif
+
+#if defined Vc_IMPL_TAG_ &&                                                              \
+    (defined Vc_GCC || (defined Vc_CLANG && Vc_CLANG >= 0x30900) || defined Vc_APPLECLANG)
+#define Vc_IMPL_ABI_TAG                                                                  \
+    __attribute__((abi_tag(Vc_IMPL_TAG_ Vc_IMPL_SSE4a_TAG_ Vc_IMPL_POPCNT_TAG_           \
+                           Vc_IMPL_FMA_TAG_ Vc_IMPL_BMI2_TAG_ Vc_IMPL_VEX_TAG_)))
+#else
+#define Vc_IMPL_ABI_TAG
+#endif
+// }}}
+
+#include "fwddecl.h"
+
 namespace Vc_VERSIONED_NAMESPACE
 {
 
@@ -498,6 +576,12 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
     AVX2Impl,
     /// Intel Xeon Phi
     MICImpl,
+    /**
+     * x86 AVX + AVX2 + AVX-512 F, CD, BW, DQ, and VL. The vectors are the 256-bit AVX2
+     * vectors; AVX-512 adds opmask stores, compress/expand, and scatters. There are no
+     * 512-bit vectors. (Listed after MICImpl, which keeps its value.)
+     */
+    AVX512Impl,
     ImplementationMask = 0xfff
 };
 
@@ -506,7 +590,7 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
  *
  * The list of available instructions is not easily described by a linear list of instruction sets.
  * On x86 the following instruction sets always include their predecessors:
- * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2
+ * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2, AVX512
  *
  * But there are additional instructions that are not necessarily required by this list. These are
  * covered in this enum.
@@ -581,6 +665,8 @@ template <unsigned int Features> struct ImplementationT {
 using CurrentImplementation = ImplementationT<
 #ifdef Vc_IMPL_Scalar
     ScalarImpl
+#elif defined(Vc_IMPL_AVX512)
+    AVX512Impl
 #elif defined(Vc_IMPL_AVX2)
     AVX2Impl
 #elif defined(Vc_IMPL_AVX)
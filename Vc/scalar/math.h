@@ -95,6 +95,11 @@ Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<short> abs(Scalar::Vector<short> x)
     return std::abs(static_cast<int>(x.data()));
 }
 
+Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<schar> abs(Scalar::Vector<schar> x)
+{
+    return std::abs(static_cast<int>(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE void sincos(const Scalar::Vector<T> &x, Scalar::Vector<T> *sin, Scalar::Vector<T> *cos)
 {
 #if defined(_WIN32) || defined(__APPLE__)
@@ -149,11 +154,79 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log2(const Scalar
     return Scalar::Vector<T>(std::log2(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp2 (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::exp2(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp10(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::pow(T(10), x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow(x.data(), y.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> hypot(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::hypot(x.data(), y.data()));
+}
+
+// The precision tags make no difference for the scalar implementation. The float overloads
+// are evaluated in double, which rounds correctly almost everywhere.
+template <typename T, typename Tag = Precision::AccurateTag>
+static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value, Scalar::Vector<T>>
+tanh(const Scalar::Vector<T> &x, Tag = Tag())
+{
+    return Scalar::Vector<T>(std::tanh(static_cast<double>(x.data())));
+}
+
+template <typename T, typename Tag = Precision::AccurateTag>
+static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value, Scalar::Vector<T>>
+sigmoid(const Scalar::Vector<T> &x, Tag = Tag())
+{
+    // e^-|x| cannot overflow
+    const double e = std::exp(-std::abs(static_cast<double>(x.data())));
+    const double r = 1. / (1. + e);
+    return Scalar::Vector<T>(x.data() < T(0) ? e * r : r);
+}
+
+template <typename T, typename Tag = Precision::AccurateTag>
+static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value, Scalar::Vector<T>>
+erf(const Scalar::Vector<T> &x, Tag = Tag())
+{
+    return Scalar::Vector<T>(std::erf(static_cast<double>(x.data())));
+}
+
+template <typename T, typename Tag = Precision::AccurateTag>
+static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value, Scalar::Vector<T>>
+erfc(const Scalar::Vector<T> &x, Tag = Tag())
+{
+    return Scalar::Vector<T>(std::erfc(static_cast<double>(x.data())));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -272,6 +345,62 @@ Vc_ALWAYS_INLINE Vector<T, VectorAbi::Scalar> fma(Vector<T, VectorAbi::Scalar> a
     }
 }
 
+// precision tiers {{{1
+// Precision::Fast and Precision::Default use the <cmath> function, Precision::Accurate
+// evaluates float in double.
+#define Vc_SCALAR_TIERS_(name_)                                                          \
+    template <typename T, typename Tag>                                                  \
+    static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value,              \
+                                      Scalar::Vector<T>>                                 \
+    name_(const Scalar::Vector<T> &x, Tag)                                               \
+    {                                                                                    \
+        return std::is_same<Tag, Precision::AccurateTag>::value                          \
+                   ? Scalar::Vector<T>(                                                  \
+                         T(name_(Scalar::Vector<double>(x.data())).data()))              \
+                   : name_(x);                                                           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_SCALAR_TIERS_(sin);
+Vc_SCALAR_TIERS_(cos);
+Vc_SCALAR_TIERS_(asin);
+Vc_SCALAR_TIERS_(atan);
+Vc_SCALAR_TIERS_(exp);
+Vc_SCALAR_TIERS_(exp2);
+Vc_SCALAR_TIERS_(exp10);
+Vc_SCALAR_TIERS_(expm1);
+Vc_SCALAR_TIERS_(log);
+Vc_SCALAR_TIERS_(log2);
+Vc_SCALAR_TIERS_(log10);
+Vc_SCALAR_TIERS_(log1p);
+Vc_SCALAR_TIERS_(cbrt);
+#undef Vc_SCALAR_TIERS_
+
+#define Vc_SCALAR_BINARY_TIERS_(name_)                                                   \
+    template <typename T, typename Tag>                                                  \
+    static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value,              \
+                                      Scalar::Vector<T>>                                 \
+    name_(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y, Tag)                   \
+    {                                                                                    \
+        return std::is_same<Tag, Precision::AccurateTag>::value                          \
+                   ? Scalar::Vector<T>(T(name_(Scalar::Vector<double>(x.data()),         \
+                                               Scalar::Vector<double>(y.data()))         \
+                                             .data()))                                   \
+                   : name_(x, y);                                                        \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_SCALAR_BINARY_TIERS_(atan2);
+Vc_SCALAR_BINARY_TIERS_(pow);
+Vc_SCALAR_BINARY_TIERS_(hypot);
+#undef Vc_SCALAR_BINARY_TIERS_
+
+template <typename T, typename Tag>
+static Vc_ALWAYS_INLINE enable_if<Traits::is_precision_tag<Tag>::value, void> sincos(
+    const Scalar::Vector<T> &x, Scalar::Vector<T> *sin, Scalar::Vector<T> *cos, Tag tag)
+{
+    *sin = Vc::sin(x, tag);
+    *cos = Vc::cos(x, tag);
+}
+
 // }}}1
 }  // namespace Vc
 
@@ -38,6 +38,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_UINT_V_SIZE 1
 #define Vc_SHORT_V_SIZE 1
 #define Vc_USHORT_V_SIZE 1
+#define Vc_SCHAR_V_SIZE 1
+#define Vc_UCHAR_V_SIZE 1
+#define Vc_LLONG_V_SIZE 1
+#define Vc_ULLONG_V_SIZE 1
 #endif
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -51,6 +55,10 @@ typedef Vector<int>               int_v;
 typedef Vector<unsigned int>     uint_v;
 typedef Vector<short>           short_v;
 typedef Vector<unsigned short> ushort_v;
+typedef Vector<signed char>     schar_v;
+typedef Vector<unsigned char>   uchar_v;
+typedef Vector<long long>       llong_v;
+typedef Vector<unsigned long long> ullong_v;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Scalar>;
 typedef Mask<double>         double_m;
@@ -59,6 +67,10 @@ typedef Mask<int>               int_m;
 typedef Mask<unsigned int>     uint_m;
 typedef Mask<short>           short_m;
 typedef Mask<unsigned short> ushort_m;
+typedef Mask<signed char>     schar_m;
+typedef Mask<unsigned char>   uchar_m;
+typedef Mask<long long>       llong_m;
+typedef Mask<unsigned long long> ullong_m;
 
 template <typename T> struct is_vector : public std::false_type {};
 template <typename T> struct is_vector<Vector<T>> : public std::true_type {};
@@ -150,6 +150,129 @@ Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ushort>) { return con
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , llong >) { return cvtepi32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , llong >) { return cvtepu32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ullong>) { return cvtepi32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , ullong>) { return cvtepu32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ullong>) { return v; }
+// 64 -> 32 bit conversions keep the low halves (modulo 2^32)
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uint  >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uint  >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, llong >) {
+    // there is no packed conversion to 64-bit integers before AVX-512DQ
+#ifdef __x86_64__
+    return _mm_set_epi64x(_mm_cvttsd_si64(_mm_unpackhi_pd(v, v)), _mm_cvttsd_si64(v));
+#else
+    return _mm_set_epi64x(static_cast<llong>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<llong>(_mm_cvtsd_f64(v)));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ullong>) {
+    // subtract 2^63 from inputs that do not fit into llong and put the bit back after
+    // the conversion
+    const __m128d big = _mm_cmpge_pd(v, _mm_set1_pd(9223372036854775808.));
+    const __m128i r = convert(_mm_sub_pd(v, _mm_and_pd(big, _mm_set1_pd(9223372036854775808.))),
+                              ConvertTag<double, llong>());
+    return _mm_xor_si128(r, _mm_slli_epi64(_mm_castpd_si128(big), 63));
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<llong , double>) {
+    // split into the high 16 and the low 48 bits and insert them into the mantissas of
+    // 3 * 2^67 and 2^52. Subtracting the magic numbers is exact, so the final
+    // addition is the only rounding step.
+    const __m128i hi = _mm_and_si128(_mm_srai_epi32(v, 16), _mm_set_epi32(-1, 0, -1, 0));
+    const __m128i lo = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0x0000ffffffffffffll)),
+                                    _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)));
+    const __m128d f = _mm_sub_pd(
+        _mm_castsi128_pd(_mm_add_epi64(hi, _mm_castpd_si128(_mm_set1_pd(442721857769029238784.)))),
+        _mm_set1_pd(442726361368656609280.));
+    return _mm_add_pd(f, _mm_castsi128_pd(lo));
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ullong, double>) {
+    // the same as above with the high and low 32 bits in the mantissas of 2^84 and 2^52
+    const __m128i hi = _mm_or_si128(_mm_srli_epi64(v, 32),
+                                    _mm_castpd_si128(_mm_set1_pd(19342813113834066795298816.)));
+    const __m128i lo = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0xffffffffll)),
+                                    _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)));
+    const __m128d f =
+        _mm_sub_pd(_mm_castsi128_pd(hi), _mm_set1_pd(19342813118337666422669312.));
+    return _mm_add_pd(f, _mm_castsi128_pd(lo));
+}
+
+// float16 {{{2
+// Without F16C these are the SSE2 versions of Detail::half_to_float and
+// Detail::float_to_half.
+// converts the 4 binary16 values in the low 64 bits of v
+Vc_INTRINSIC __m128 convert(__m128i v, ConvertTag<float16, float>) {
+#ifdef Vc_IMPL_F16C
+    return _mm_cvtph_ps(v);
+#else
+    const __m128i h = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+    const __m128i expmant = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)),
+                                     _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));  // 2^112
+    const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7bff)),
+                                         _mm_set1_epi32(0x7f800000));
+    const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expmant), 16);
+    return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infnan)));
+#endif
+}
+// returns the 4 binary16 values in the low 64 bits, rounded to nearest even
+Vc_INTRINSIC __m128i convert(__m128 v, ConvertTag<float, float16>) {
+#ifdef Vc_IMPL_F16C
+    return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+    const __m128i sign = _mm_and_si128(_mm_castps_si128(v), setmin_epi32());
+    const __m128i absf = _mm_xor_si128(_mm_castps_si128(v), sign);
+    // inputs >= 2^16 and NaNs become inf or a quiet NaN
+    const __m128i regular = _mm_cmpgt_epi32(_mm_set1_epi32(0x47800000), absf);
+    const __m128i infnan = _mm_or_si128(
+        _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(v, v)), _mm_set1_epi32(0x200)),
+        _mm_set1_epi32(0x7c00));
+    // inputs < 2^-14 become subnormal: let the FPU round in the addition with 0.5
+    const __m128i subnormal = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), absf);
+    const __m128i sub = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absf), _mm_set1_ps(0.5f))),
+        _mm_set1_epi32(0x3f000000));
+    // all others: rebias the exponent and round to nearest even
+    const __m128i odd = _mm_srai_epi32(_mm_slli_epi32(absf, 31 - 13), 31);
+    const __m128i normal = _mm_srli_epi32(
+        _mm_sub_epi32(_mm_add_epi32(absf, _mm_set1_epi32(static_cast<int>(0xc8000fffu))),
+                      odd),
+        13);
+    const __m128i finite = _mm_or_si128(_mm_and_si128(subnormal, sub),
+                                        _mm_andnot_si128(subnormal, normal));
+    const __m128i r = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(regular, finite), _mm_andnot_si128(regular, infnan)),
+        _mm_srai_epi32(sign, 16));
+    // the sign extension above makes the signed saturation a plain truncation
+    return _mm_packs_epi32(r, _mm_setzero_si128());
+#endif
+}
+
+// bfloat16 {{{2
+// These are the SSE2 versions of Detail::bfloat16_to_float and Detail::float_to_bfloat16.
+// converts the 4 bfloat16 values in the low 64 bits of v
+Vc_INTRINSIC __m128 convert(__m128i v, ConvertTag<bfloat16, float>) {
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), v));
+}
+// returns the 4 bfloat16 values in the low 64 bits, rounded to nearest even
+Vc_INTRINSIC __m128i convert(__m128 v, ConvertTag<float, bfloat16>) {
+    const __m128i f = _mm_castps_si128(v);
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(f, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(0x7fff)), odd);
+    // NaNs must not round into the sign bit or to infinity: quiet them instead
+    const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+    const __m128i r =
+        _mm_or_si128(_mm_andnot_si128(nan, rounded),
+                     _mm_and_si128(nan, _mm_or_si128(f, _mm_set1_epi32(0x400000))));
+    // the sign extension makes the signed saturation a plain truncation
+    return _mm_packs_epi32(_mm_srai_epi32(r, 16), _mm_setzero_si128());
+}
 
 // }}}1
 }  // namespace SSE
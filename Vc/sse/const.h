@@ -77,6 +77,9 @@ namespace SSE
         static Vc_ALWAYS_INLINE Vc_CONST V log10_e()      { return load(c_log<T>::d(19)); }
         static Vc_ALWAYS_INLINE Vc_CONST V log2_e()       { return load(c_log<T>::d(20)); }
 
+        static Vc_ALWAYS_INLINE Vc_CONST V tanhCoeff(int i) { return load(&c_tanh<T>::data[i * Stride]); }
+        static Vc_ALWAYS_INLINE Vc_CONST V erfCoeff(int i)  { return load(&c_erf<T>::data[i * Stride]); }
+
         static Vc_ALWAYS_INLINE_L Vc_CONST_L V highMask()         Vc_ALWAYS_INLINE_R Vc_CONST_R;
         static Vc_ALWAYS_INLINE_L Vc_CONST_L V highMask(int bits) Vc_ALWAYS_INLINE_R Vc_CONST_R;
     private:
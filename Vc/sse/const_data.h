@@ -67,6 +67,23 @@ template <> alignas(64) const float c_trig<float>::data[];
 template <> alignas(64) const double c_trig<double>::data[];
 #endif
 
+// coefficients of tanh and of erf/erfc, the layout is defined by Detail::TanhTraits<T> and
+// Detail::ErfTraits<T>
+template<typename T> struct c_tanh
+{
+    alignas(64) static const T data[];
+};
+template<typename T> struct c_erf
+{
+    alignas(64) static const T data[];
+};
+#ifndef Vc_MSVC
+template <> alignas(64) const float c_tanh<float>::data[];
+template <> alignas(64) const double c_tanh<double>::data[];
+template <> alignas(64) const float c_erf<float>::data[];
+template <> alignas(64) const double c_erf<double>::data[];
+#endif
+
 template<typename T> struct c_log
 {
     enum VectorSize { Size = 16 / sizeof(T) };
@@ -329,6 +329,18 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
 {
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const float16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::convert(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)),
+                        SSE::ConvertTag<float16, float>());
+}
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const bfloat16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::convert(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)),
+                        SSE::ConvertTag<bfloat16, float>());
+}
 
 // shifted{{{1
 template <int amount, typename T>
@@ -425,6 +437,12 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 8, __m128>(__m128i k)
     return SSE::sse_cast<__m128>(
         _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 16, __m128>(__m128i k)
+{
+    const auto tmp = _mm_packs_epi16(k, _mm_setzero_si128());
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(_mm_packs_epi16(tmp, _mm_setzero_si128()),
+                                                 _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 2, __m128>(__m128i k)
 {
@@ -434,6 +452,11 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 8, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 16, __m128>(__m128i k)
+{
+    const auto tmp = _mm_packs_epi16(k, _mm_setzero_si128());
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(tmp, _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 2, __m128>(__m128i k)
 {
@@ -444,6 +467,10 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 4, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi16(k, k));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<16, 8, __m128>(__m128i k)
 {
@@ -532,6 +559,8 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  llong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ullong) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +571,8 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  llong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ullong) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -567,7 +598,7 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  schar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
@@ -578,10 +609,12 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  llong) { return SSE::VectorHelper<llong>::mul(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<llong>::mul(a, b); }
 
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
@@ -606,6 +639,8 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::min(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::min(a, b); }
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -616,6 +651,8 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::max(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::max(a, b); }
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -648,6 +685,10 @@ Vc_INTRINSIC  schar add(__m128i a,  schar) {
     return _mm_cvtsi128_si32(a);  // & 0xff is implicit
 }
 Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+Vc_INTRINSIC  llong add(__m128i a,  llong) {
+    return SSE::cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong add(__m128i a, ullong) { return add(a, llong()); }
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -674,11 +715,15 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
 Vc_INTRINSIC  schar mul(__m128i a,  schar) {
     // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
+    const __m128i s0 = _mm_srai_epi16(_mm_unpacklo_epi8(a, a), 8);
+    const __m128i s1 = _mm_srai_epi16(_mm_unpackhi_epi8(a, a), 8);
     return mul(mul(s0, s1, short()), short());
 }
 Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+Vc_INTRINSIC  llong mul(__m128i a,  llong) {
+    return SSE::cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong mul(__m128i a, ullong) { return mul(a, llong()); }
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -719,11 +764,17 @@ Vc_INTRINSIC  schar min(__m128i a,  schar) {
     return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC  llong min(__m128i a,  llong) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong min(__m128i a, ullong) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -764,25 +815,38 @@ Vc_INTRINSIC  schar max(__m128i a,  schar) {
     return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC  llong max(__m128i a,  llong) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong max(__m128i a, ullong) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 
 // sorted{{{1
+// implemented in src/sse_sorthelper.cpp; the intrinsic types keep the Vc_IMPL_ABI_TAG of
+// Vector out of the signature, thus e.g. SSE4.2 translation units link to the SSE4.1 copy
 template <Vc::Implementation, typename T>
-Vc_CONST_L SSE::Vector<T> Vc_VDECL sorted(SSE::Vector<T> x) Vc_CONST_R;
+Vc_CONST_L typename SSE::VectorTraits<T>::VectorType Vc_VDECL
+    sorted(typename SSE::VectorTraits<T>::VectorType x) Vc_CONST_R;
 template <typename T> Vc_INTRINSIC Vc_CONST SSE::Vector<T> sorted(SSE::Vector<T> x)
 {
     static_assert(!CurrentImplementation::is(ScalarImpl),
                   "Detail::sorted can only be instantiated if a non-Scalar "
                   "implementation is selected.");
-    return sorted < CurrentImplementation::is_between(SSE2Impl, SSSE3Impl)
-               ? SSE2Impl
-               : CurrentImplementation::is_between(SSE41Impl, SSE42Impl)
-                     ? SSE41Impl
-                     : CurrentImplementation::current() > (x);
+    return SSE::Vector<T>(sorted<
+        CurrentImplementation::is_between(SSE2Impl, SSSE3Impl)
+            ? SSE2Impl
+            : CurrentImplementation::is_between(SSE41Impl, SSE42Impl)
+                  ? SSE41Impl
+                  : CurrentImplementation::is(AVX512Impl)
+                        ? AVX2Impl  // the AVX2 sorting networks are used for AVX512
+                        : CurrentImplementation::current(),
+        T>(x.data()));
 }
 
 // sanitize{{{1
@@ -817,6 +881,55 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 16), V> rotated(V v, int am
     return sse_cast<V>(_mm_setzero_si128());
 }
 
+// compress{{{1
+#ifdef Vc_IMPL_SSSE3
+// byte indexes (in the low 8 Bytes) of the entries selected by k, followed by the
+// remaining entries, see Common::CompressIndexes
+Vc_INTRINSIC __m128i compress_indexes(unsigned int k)
+{
+    const __m128i packed = _mm_cvtsi32_si128(Common::CompressIndexes[k]);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    return _mm_unpacklo_epi8(_mm_and_si128(packed, nibble),
+                             _mm_and_si128(_mm_srli_epi16(packed, 4), nibble));
+}
+// pshufb controls moving the selected 16-bit / 32-bit entries to the front
+Vc_INTRINSIC __m128i compress_shuffle(unsigned int k, std::integral_constant<std::size_t, 2>)
+{
+    const __m128i idx = compress_indexes(k);
+    const __m128i lo = _mm_add_epi8(idx, idx);
+    return _mm_unpacklo_epi8(lo, _mm_add_epi8(lo, _mm_set1_epi8(1)));
+}
+Vc_INTRINSIC __m128i compress_shuffle(unsigned int k, std::integral_constant<std::size_t, 4>)
+{
+    __m128i idx = compress_indexes(k);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_unpacklo_epi8(idx, idx);
+    idx = _mm_unpacklo_epi16(idx, idx);
+    return _mm_add_epi8(idx, _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3));
+}
+// the 16 entries of the 8-bit vectors exceed the 8-bit table, they use the generic
+// fallback
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 2 || sizeof(T) == 4), SSE::Vector<T>> compress(
+    SSE::Vector<T> v, const SSE::Mask<T> &k)
+{
+    using VectorType = typename SSE::Vector<T>::VectorType;
+    return SSE::sse_cast<VectorType>(_mm_shuffle_epi8(
+        SSE::sse_cast<__m128i>(v.data()),
+        compress_shuffle(k.toInt(), std::integral_constant<std::size_t, sizeof(T)>())));
+}
+#endif  // Vc_IMPL_SSSE3
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 8), SSE::Vector<T>> compress(SSE::Vector<T> v,
+                                                                  const SSE::Mask<T> &k)
+{
+    using VectorType = typename SSE::Vector<T>::VectorType;
+    const __m128d x = SSE::sse_cast<__m128d>(v.data());
+    return k.toInt() == 2 ? SSE::Vector<T>(SSE::sse_cast<VectorType>(_mm_unpackhi_pd(x, x)))
+                          : v;
+}
+
 //InterleaveImpl{{{1
 template<typename V, size_t Size, size_t VSize> struct InterleaveImpl;
 template<typename V> struct InterleaveImpl<V, 8, 16> {
@@ -94,6 +94,7 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi8 () { return _mm_set1_epi8(-0x80); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi16() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::minShort)); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi32() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskFloat)); }
+    static Vc_INTRINSIC __m128i Vc_CONST setmin_epi64() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskDouble)); }
 
 #if defined(Vc_IMPL_XOP)
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b) { return _mm_comgt_epu8(a, b); }
@@ -102,6 +103,8 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu32(__m128i a, __m128i b) { return _mm_comlt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b)
     {
@@ -152,6 +155,11 @@ namespace SseIntrinsics
         return _mm_or_si128(gt2, lo);
 #endif
     }
+    Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b)
+    {
+        return cmpgt_epi64(_mm_xor_si128(a, setmin_epi64()),
+                           _mm_xor_si128(b, setmin_epi64()));
+    }
 #endif
 }  // namespace SseIntrinsics
 }  // namespace Vc
@@ -337,6 +345,14 @@ Vc_INTRINSIC Vc_CONST __m128i cvtepi8_epi32(__m128i epi8)
 {
     return _mm_cvtepi8_epi32(epi8);
 }
+Vc_INTRINSIC Vc_CONST __m128i cvtepu32_epi64(__m128i epu32)
+{
+    return _mm_cvtepu32_epi64(epu32);
+}
+Vc_INTRINSIC Vc_CONST __m128i cvtepi32_epi64(__m128i epi32)
+{
+    return _mm_cvtepi32_epi64(epi32);
+}
 }  // namespace SseIntrinsics
 }  // namespace Vc
 #else
@@ -565,6 +581,12 @@ namespace SseIntrinsics
         const __m128i epi16 = _mm_unpacklo_epi8(epi8, neg);
         return _mm_unpacklo_epi16(epi16, _mm_unpacklo_epi8(neg, neg));
     }
+    Vc_INTRINSIC Vc_CONST __m128i cvtepu32_epi64(__m128i epu32) {
+        return _mm_unpacklo_epi32(epu32, _mm_setzero_si128());
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtepi32_epi64(__m128i epi32) {
+        return _mm_unpacklo_epi32(epi32, _mm_srai_epi32(epi32, 31));
+    }
 }  // namespace SseIntrinsics
 }  // namespace Vc
 #endif
@@ -617,6 +639,16 @@ namespace SseIntrinsics
     }
 #endif
 
+    Vc_INTRINSIC Vc_CONST long long cvtsi128_si64(__m128i a) {
+#ifdef __x86_64__
+        return _mm_cvtsi128_si64(a);
+#else
+        long long r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), a);
+        return r;
+#endif
+    }
+
 #ifdef Vc_IMPL_AVX2
 template <int Scale> __m128 gather(const float *addr, __m128i idx)
 {
@@ -655,6 +687,16 @@ __m128i gather(__m128i src, __m128i k, const unsigned *addr, __m128i idx)
 }
 #endif
 
+    // stores the bytes of x selected by mask; AVX-512BW/VL replaces the non-temporal
+    // maskmovdqu with an opmask store
+    static Vc_INTRINSIC void maskstore(__m128i x, __m128i mask, void *mem) {
+#ifdef Vc_IMPL_AVX512
+        _mm_mask_storeu_epi8(mem, _mm_movepi8_mask(mask), x);
+#else
+        _mm_maskmoveu_si128(x, mask, static_cast<char *>(mem));
+#endif
+    }
+
 }  // namespace SseIntrinsics
 }  // namespace Vc
 
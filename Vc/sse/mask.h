@@ -58,6 +58,10 @@ template <typename T> class Mask<T, VectorAbi::Sse>
     friend class Mask<uint32_t, abi>;
     friend class Mask< int16_t, abi>;
     friend class Mask<uint16_t, abi>;
+    friend class Mask<  int8_t, abi>;
+    friend class Mask< uint8_t, abi>;
+    friend class Mask< int64_t, abi>;
+    friend class Mask<uint64_t, abi>;
 
     /**
      * A helper type for aliasing the entries in the mask but behaving like a bool.
@@ -161,7 +165,8 @@ public:
 
         Vc_ALWAYS_INLINE Vc_PURE Mask operator!() const
         {
-#ifdef Vc_GCC
+            // see AVX::Mask::operator!
+#if defined Vc_GCC && !defined __AVX512BW__
             return ~dataI();
 #else
             return _mm_andnot_si128(dataI(), SSE::_mm_setallone_si128());
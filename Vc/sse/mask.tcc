@@ -251,6 +251,15 @@ Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 8>)
                           gen(4) ? 0xffffu : 0, gen(5) ? 0xffffu : 0,
                           gen(6) ? 0xffffu : 0, gen(7) ? 0xffffu : 0);
 }
+template <typename M, typename G>
+Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 16>)
+{
+    return _mm_setr_epi8(gen(0) ? -1 : 0, gen(1) ? -1 : 0, gen(2) ? -1 : 0, gen(3) ? -1 : 0,
+                         gen(4) ? -1 : 0, gen(5) ? -1 : 0, gen(6) ? -1 : 0, gen(7) ? -1 : 0,
+                         gen(8) ? -1 : 0, gen(9) ? -1 : 0, gen(10) ? -1 : 0,
+                         gen(11) ? -1 : 0, gen(12) ? -1 : 0, gen(13) ? -1 : 0,
+                         gen(14) ? -1 : 0, gen(15) ? -1 : 0);
+}
 template <typename T>
 template <typename G>
 Vc_INTRINSIC Mask<T, VectorAbi::Sse> Mask<T, VectorAbi::Sse>::generate(G &&gen)
@@ -33,6 +33,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Vc_VERSIONED_NAMESPACE
 {
+// add_sat & sub_sat {{{1
+Vc_INTRINSIC Vc_CONST SSE:: schar_v add_sat(SSE:: schar_v a, SSE:: schar_v b) { return _mm_adds_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE:: uchar_v add_sat(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_adds_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE:: short_v add_sat(SSE:: short_v a, SSE:: short_v b) { return _mm_adds_epi16(a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE::ushort_v add_sat(SSE::ushort_v a, SSE::ushort_v b) { return _mm_adds_epu16(a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE:: schar_v sub_sat(SSE:: schar_v a, SSE:: schar_v b) { return _mm_subs_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE:: uchar_v sub_sat(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_subs_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE:: short_v sub_sat(SSE:: short_v a, SSE:: short_v b) { return _mm_subs_epi16(a.data(), b.data()); }
+Vc_INTRINSIC Vc_CONST SSE::ushort_v sub_sat(SSE::ushort_v a, SSE::ushort_v b) { return _mm_subs_epu16(a.data(), b.data()); }
+
 // copysign {{{1
 Vc_INTRINSIC Vc_CONST SSE::float_v copysign(SSE::float_v mag, SSE::float_v sign)
 {
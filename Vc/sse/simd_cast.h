@@ -98,6 +98,38 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v,    int_v);
+Vc_SIMD_CAST_1( uchar_v,    int_v);
+Vc_SIMD_CAST_1( schar_v,   uint_v);
+Vc_SIMD_CAST_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_1( schar_v,  short_v);
+Vc_SIMD_CAST_1( uchar_v,  short_v);
+Vc_SIMD_CAST_1( schar_v, ushort_v);
+Vc_SIMD_CAST_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_1(   int_v,  schar_v);
+Vc_SIMD_CAST_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_1( short_v,  schar_v);
+Vc_SIMD_CAST_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_1( short_v,  uchar_v);
+Vc_SIMD_CAST_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_1(   int_v,  llong_v);
+Vc_SIMD_CAST_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_1(double_v,  llong_v);
+Vc_SIMD_CAST_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_1(   int_v, ullong_v);
+Vc_SIMD_CAST_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_1(double_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v,    int_v);
+Vc_SIMD_CAST_1(ullong_v,    int_v);
+Vc_SIMD_CAST_1( llong_v,   uint_v);
+Vc_SIMD_CAST_1(ullong_v,   uint_v);
+Vc_SIMD_CAST_1( llong_v, double_v);
+Vc_SIMD_CAST_1(ullong_v, double_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +143,18 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2(   int_v,  schar_v);
+Vc_SIMD_CAST_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_2( short_v,  schar_v);
+Vc_SIMD_CAST_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_2(  uint_v,  uchar_v);
+Vc_SIMD_CAST_2( short_v,  uchar_v);
+Vc_SIMD_CAST_2(ushort_v,  uchar_v);
+Vc_SIMD_CAST_2( llong_v,    int_v);
+Vc_SIMD_CAST_2(ullong_v,    int_v);
+Vc_SIMD_CAST_2( llong_v,   uint_v);
+Vc_SIMD_CAST_2(ullong_v,   uint_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -122,6 +166,10 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c);
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v);
 Vc_SIMD_CAST_4(double_v, ushort_v);
+Vc_SIMD_CAST_4(   int_v,  schar_v);
+Vc_SIMD_CAST_4(  uint_v,  schar_v);
+Vc_SIMD_CAST_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_4(  uint_v,  uchar_v);
 //}}}2
 }  // namespace SSE
 using SSE::simd_cast;
@@ -151,6 +199,14 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -177,6 +233,14 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::llong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -321,6 +385,19 @@ Vc_INTRINSIC __m128i convert_int32_to_int16(__m128i a, __m128i b)
     auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);  // 1 3 5 7 X X X X
     return _mm_unpacklo_epi16(tmp2, tmp3);       // 0 1 2 3 4 5 6 7
 }
+// truncates the 16-bit entries of a and b to their low bytes (modulo 2^8 as for int16 ->
+// int8 conversions)
+Vc_INTRINSIC __m128i convert_int16_to_int8(__m128i a, __m128i b)
+{
+    const __m128i lo = _mm_srli_epi16(_mm_setallone_si128(), 8);
+    return _mm_packus_epi16(_mm_and_si128(a, lo), _mm_and_si128(b, lo));
+}
+// keeps the low 32 bits of the 64-bit entries of a and b
+Vc_INTRINSIC __m128i convert_int64_to_int32(__m128i a, __m128i b)
+{
+    return _mm_castps_si128(
+        _mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+}
 
 // 1 SSE::Vector to 1 SSE::Vector {{{2
 // to int_v {{{3
@@ -372,6 +449,43 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+// from schar_v/uchar_v {{{3
+Vc_SIMD_CAST_1( schar_v,    int_v) { return SseIntrinsics::cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,    int_v) { return SseIntrinsics::cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1( schar_v,   uint_v) { return SseIntrinsics::cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,   uint_v) { return SseIntrinsics::cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  short_v) { return SseIntrinsics::cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  short_v) { return SseIntrinsics::cvtepu8_epi16(x.data()); }
+Vc_SIMD_CAST_1( schar_v, ushort_v) { return SseIntrinsics::cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ushort_v) { return SseIntrinsics::cvtepu8_epi16(x.data()); }
+// to schar_v {{{3
+Vc_SIMD_CAST_1(   int_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(  uint_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1( short_v,  schar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ushort_v,  schar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1( uchar_v,  schar_v) { return x.data(); }
+// to uchar_v {{{3
+Vc_SIMD_CAST_1(   int_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(  uint_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x.data(), _mm_setzero_si128()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1( short_v,  uchar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ushort_v,  uchar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1( schar_v,  uchar_v) { return x.data(); }
+// to llong_v/ullong_v {{{3
+Vc_SIMD_CAST_1(   int_v,  llong_v) { return convert<   int,  llong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  llong_v) { return convert<  uint,  llong>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  llong_v) { return convert<double,  llong>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  llong_v) { return x.data(); }
+Vc_SIMD_CAST_1(   int_v, ullong_v) { return convert<   int, ullong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v, ullong_v) { return convert<  uint, ullong>(x.data()); }
+Vc_SIMD_CAST_1(double_v, ullong_v) { return convert<double, ullong>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, ullong_v) { return x.data(); }
+// from llong_v/ullong_v {{{3
+Vc_SIMD_CAST_1( llong_v,    int_v) { return convert< llong,    int>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,    int_v) { return convert<ullong,    int>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,   uint_v) { return convert< llong,   uint>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,   uint_v) { return convert<ullong,   uint>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, double_v) { return convert< llong, double>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v, double_v) { return convert<ullong, double>(x.data()); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -405,6 +519,21 @@ Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
 
+Vc_SIMD_CAST_2(   int_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2(  uint_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2( short_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+
+Vc_SIMD_CAST_2(   int_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2(  uint_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2( short_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+
+Vc_SIMD_CAST_2( llong_v,    int_v) { return SSE::convert_int64_to_int32(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ullong_v,    int_v) { return SSE::convert_int64_to_int32(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2( llong_v,   uint_v) { return SSE::convert_int64_to_int32(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ullong_v,   uint_v) { return SSE::convert_int64_to_int32(x0.data(), x1.data()); }
+
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
 {
@@ -419,6 +548,10 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c)
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
 Vc_SIMD_CAST_4(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+Vc_SIMD_CAST_4(   int_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(  uint_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(   int_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(  uint_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
 }  // namespace SSE
 
 // 1 Scalar::Vector to 1 SSE::Vector {{{2
@@ -466,6 +599,20 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x.data(), 0, 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::llong_v>::value> )
+{
+    return _mm_set_epi64x(0, llong(x.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::ullong_v>::value> )
+{
+    return _mm_set_epi64x(0, ullong(x.data()));
+}
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -519,6 +666,22 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::llong_v>::value> )
+{
+    return _mm_set_epi64x(llong(x1.data()), llong(x0.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::ullong_v>::value> )
+{
+    return _mm_set_epi64x(ullong(x1.data()), ullong(x0.data()));
+}
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -45,6 +45,10 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator==(SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator==(SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +56,10 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: llong_m operator!=(SSE:: llong_v a, SSE:: llong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC SSE::ullong_m operator!=(SSE::ullong_v a, SSE::ullong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +79,10 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator> (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator> (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +102,10 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(b.data(), a.data()); }
+Vc_INTRINSIC SSE:: llong_m operator< (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(b.data(), a.data()); }
+Vc_INTRINSIC SSE::ullong_m operator< (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(b.data(), a.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +113,10 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: llong_m operator>=(SSE:: llong_v a, SSE:: llong_v b) { return !(a < b); }
+Vc_INTRINSIC SSE::ullong_m operator>=(SSE::ullong_v a, SSE::ullong_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +124,10 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: llong_m operator<=(SSE:: llong_v a, SSE:: llong_v b) { return !(a > b); }
+Vc_INTRINSIC SSE::ullong_m operator<=(SSE::ullong_v a, SSE::ullong_v b) { return !(a > b); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -145,7 +169,9 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
 }
 template <typename T>
 Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
+    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value ||
+                  std::is_same<llong, T>::value || std::is_same<ullong, T>::value,
+              SSE::Vector<T>>
     operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
@@ -163,6 +189,20 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // divide as 16-bit integers and pack the low bytes of the quotients
+    using HT = SSE::VectorHelper<T>;
+    using S = SSE::Vector<typename std::conditional<std::is_signed<T>::value, short,
+                                                    ushort>::type>;
+    const __m128i lo = (S(HT::expand0(a.data())) / S(HT::expand0(b.data()))).data();
+    const __m128i hi = (S(HT::expand1(a.data())) / S(HT::expand1(b.data()))).data();
+    const __m128i lowBytes = _mm_set1_epi16(0x00ff);
+    return _mm_packus_epi16(and_(lo, lowBytes), and_(hi, lowBytes));
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -207,6 +247,18 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+template <>
+Vc_INTRINSIC Vector<llong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(SSE::convert<int, llong>(SSE::int_v::IndexesFromZero().data()))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ullong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(SSE::convert<int, ullong>(SSE::int_v::IndexesFromZero().data()))
+{
+}
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -344,6 +396,20 @@ Vc_GATHER_IMPL(ushort_v)
     d.v() =
         Vc::set(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6), Vc_M(7));
 }
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12),
+                          Vc_M(13), Vc_M(14), Vc_M(15));
+}
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12),
+                          Vc_M(13), Vc_M(14), Vc_M(15));
+}
+Vc_GATHER_IMPL(llong_v)  { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+Vc_GATHER_IMPL(ullong_v) { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
 #undef Vc_M
 #undef Vc_GATHER_IMPL
 
@@ -534,6 +600,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  6: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case  7: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case  8: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case  9: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()),  9 * EntryTypeSizeof));
+    case 10: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case 11: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case 12: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case 13: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case 14: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case 15: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     case -1: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 1 * EntryTypeSizeof));
     case -2: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 2 * EntryTypeSizeof));
     case -3: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 3 * EntryTypeSizeof));
@@ -542,6 +615,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case -6: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case -7: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case -8: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case -9: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()),  9 * EntryTypeSizeof));
+    case-10: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case-11: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case-12: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case-13: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case-14: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case-15: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     }
     return Zero();
 }
@@ -608,6 +688,14 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  5: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<5 * EntryTypeSizeof>(v, v));
     case  6: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<6 * EntryTypeSizeof>(v, v));
     case  7: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<7 * EntryTypeSizeof>(v, v));
+    case  8: return SSE::sse_cast<VectorType>(SSE::alignr_epi8< 8 * EntryTypeSizeof>(v, v));
+    case  9: return SSE::sse_cast<VectorType>(SSE::alignr_epi8< 9 * EntryTypeSizeof>(v, v));
+    case 10: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<10 * EntryTypeSizeof>(v, v));
+    case 11: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<11 * EntryTypeSizeof>(v, v));
+    case 12: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<12 * EntryTypeSizeof>(v, v));
+    case 13: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<13 * EntryTypeSizeof>(v, v));
+    case 14: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<14 * EntryTypeSizeof>(v, v));
+    case 15: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<15 * EntryTypeSizeof>(v, v));
     }
     return Zero();
 }
@@ -640,6 +728,14 @@ template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveLow ( SSE::short
 template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveHigh( SSE::short_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveLow (SSE::ushort_v x) const { return _mm_unpacklo_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveHigh(SSE::ushort_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveLow ( SSE::schar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveHigh( SSE::schar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveLow ( SSE::uchar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveHigh( SSE::uchar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveLow ( SSE::llong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveHigh( SSE::llong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveLow (SSE::ullong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveHigh(SSE::ullong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
 // }}}1
 // generate {{{1
 template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::generate(G gen)
@@ -696,6 +792,60 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::llong_v SSE::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
@@ -726,6 +876,26 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+    // reverse the 16-bit lanes, then swap the two bytes in each lane
+    const __m128i x = SSE::short_v(d.v()).reversed().data();
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+    // reverse the 16-bit lanes, then swap the two bytes in each lane
+    const __m128i x = SSE::short_v(d.v()).reversed().data();
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::llong_v SSE::llong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ullong_v SSE::ullong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
 // }}}1
 // permutation via operator[] {{{1
 template <>
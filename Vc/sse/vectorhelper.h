@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_SSE_VECTORHELPER_H_
 
 #include "types.h"
+#include "casts.h"
 #include "../common/loadstoreflags.h"
 #include <limits>
 #include "const_data.h"
@@ -56,8 +57,14 @@ namespace SSE
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_ps(mem, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
-            // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
-            template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_castps_si128(m), reinterpret_cast<char *>(mem)); }
+            // before AVX there was only one maskstore (before AVX-512 it was non-temporal). load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { maskstore(_mm_castps_si128(x), _mm_castps_si128(m), mem); }
+
+            // four float16 or bfloat16 only fill 8 Bytes, thus there is no aligned or streaming 8-Byte store to choose
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, float16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VectorType x, VectorType m) { maskstore(convert(x, ConvertTag<float, float16>()), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), mem); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), convert(x, ConvertTag<float, bfloat16>())); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VectorType x, VectorType m) { maskstore(convert(x, ConvertTag<float, bfloat16>()), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), mem); }
 
             Vc_OP0(allone, _mm_setallone_ps())
             Vc_OP0(zero, _mm_setzero_ps())
@@ -78,8 +85,8 @@ namespace SSE
             template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_pd(mem, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(_mm_castpd_si128(x), _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
-            // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
-            template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castpd_si128(x), _mm_castpd_si128(m), reinterpret_cast<char *>(mem)); }
+            // before AVX there was only one maskstore (before AVX-512 it was non-temporal). load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(double *mem, VectorType x, VectorType m) { maskstore(_mm_castpd_si128(x), _mm_castpd_si128(m), mem); }
 
             Vc_OP0(allone, _mm_setallone_pd())
             Vc_OP0(zero, _mm_setzero_pd())
@@ -99,8 +106,8 @@ namespace SSE
             template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_si128(reinterpret_cast<VectorType *>(mem), x); }
             template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { _mm_maskmoveu_si128(x, _mm_setallone_si128(), reinterpret_cast<char *>(mem)); }
 
-            // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
-            template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(x, m, reinterpret_cast<char *>(mem)); }
+            // before AVX there was only one maskstore (before AVX-512 it was non-temporal). load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
+            template<typename Flags, typename T> static Vc_ALWAYS_INLINE void store(T *mem, VectorType x, VectorType m) { maskstore(x, m, mem); }
 
             Vc_OP0(allone, _mm_setallone_si128())
             Vc_OP0(zero, _mm_setzero_si128())
@@ -607,6 +614,242 @@ namespace SSE
                 return Vc_CAT2(_mm_set_, Vc_SUFFIX)(a, b, c, d, e, f, g, h);
             }
 
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+        template<> struct VectorHelper<signed char> {
+            typedef __m128i VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i concat(__m128i a, __m128i b) { return _mm_packs_epi16(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand0(__m128i x) { return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand1(__m128i x) { return _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(1); }
+
+            // there are no 8-bit shifts: shift 16-bit lanes and fix up the bits that
+            // crossed the byte boundary
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift),
+                                     _mm_set1_epi8(static_cast<char>(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return concat(_mm_srai_epi16(expand0(a), shift),
+                              _mm_srai_epi16(expand1(a), shift));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(
+                const EntryType a, const EntryType b, const EntryType c, const EntryType d,
+                const EntryType e, const EntryType f, const EntryType g, const EntryType h,
+                const EntryType i, const EntryType j, const EntryType k, const EntryType l,
+                const EntryType m, const EntryType n, const EntryType o, const EntryType p)
+            {
+                return Vc_CAT2(_mm_set_, Vc_SUFFIX)(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+
+            // multiply the even and odd bytes as 16-bit lanes and merge the low bytes
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                const __m128i even = _mm_mullo_epi16(a, b);
+                const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                return _mm_or_si128(_mm_slli_epi16(odd, 8),
+                                    _mm_and_si128(even, _mm_set1_epi16(0x00ff)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                // the low byte of the 16-bit product does not depend on the high bytes
+                a = _mm_mullo_epi16(expand0(a), expand1(a));
+                return VectorHelper<short>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // horizontal sum of absolute differences sums 8 bytes into 16 bits
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(a) + _mm_extract_epi16(a, 4); // & 0xff is implicit
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef __m128i VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i concat(__m128i a, __m128i b) { return _mm_packus_epi16(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand0(__m128i x) { return _mm_unpacklo_epi8(x, _mm_setzero_si128()); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand1(__m128i x) { return _mm_unpackhi_epi8(x, _mm_setzero_si128()); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi8(1); }
+
+            Vc_OP(min) Vc_OP(max)
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return VectorHelper<signed char>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return VectorHelper<signed char>::add(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                return VectorHelper<signed char>::mul(a, b);
+            }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return VectorHelper<signed char>::shiftLeft(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return _mm_and_si128(_mm_srli_epi16(a, shift),
+                                     _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(
+                const EntryType a, const EntryType b, const EntryType c, const EntryType d,
+                const EntryType e, const EntryType f, const EntryType g, const EntryType h,
+                const EntryType i, const EntryType j, const EntryType k, const EntryType l,
+                const EntryType m, const EntryType n, const EntryType o, const EntryType p)
+            {
+                return Vc_CAT2(_mm_set_, Vc_SUFFIX)(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<long long> {
+            typedef __m128i VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            // there is no 64-bit arithmetic shift: shift logically and fill the vacated
+            // bits with copies of the sign bit
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const __m128i sign = _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+                return _mm_or_si128(_mm_srli_epi64(a, shift), _mm_slli_epi64(sign, 64 - shift));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) {
+                const __m128i sign = _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+                return _mm_sub_epi64(_mm_xor_si128(a, sign), sign);
+            }
+
+            // there is no 64-bit multiplication: combine the 32x32->64 products of the
+            // low and high halves; the high x high product only affects bits >= 64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                const __m128i lolo = _mm_mul_epu32(a, b);
+                const __m128i lohi = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+                const __m128i hilo = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+                return _mm_add_epi64(lolo, _mm_slli_epi64(_mm_add_epi64(lohi, hilo), 32));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return blendv_epi8(a, b, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return blendv_epi8(b, a, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef __m128i VectorType;
+            typedef unsigned long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                return VectorHelper<long long>::mul(a, b);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return blendv_epi8(a, b, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return blendv_epi8(b, a, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return VectorHelper<long long>::mul(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+
             Vc_OP(add) Vc_OP(sub)
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
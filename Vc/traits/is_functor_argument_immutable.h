@@ -40,6 +40,12 @@ template <typename F, typename A> std::is_const<A> test(void (F::*)(A &));
 template <typename F, typename A> std::is_const<A> test(void (F::*)(A &) const);
 template <typename F, typename A> std::is_const<A> test(void (F::*)(A &&));
 template <typename F, typename A> std::is_const<A> test(void (F::*)(A &&) const);
+template <typename F, typename A, typename M> std::true_type   test(void (F::*)(A, M));
+template <typename F, typename A, typename M> std::true_type   test(void (F::*)(A, M) const);
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &, M));
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &, M) const);
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &&, M));
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &&, M) const);
 
 struct dummy {};
 
@@ -68,6 +74,27 @@ test2(float);
 template <typename A> std::true_type   test3(void(*)(A));
 template <typename A> std::is_const<A> test3(void(*)(A &));
 template <typename A> std::is_const<A> test3(void(*)(A &&));
+template <typename A, typename M> std::true_type   test3(void(*)(A, M));
+template <typename A, typename M> std::is_const<A> test3(void(*)(A &, M));
+template <typename A, typename M> std::is_const<A> test3(void(*)(A &&, M));
+
+// the same as test2 for functors that take the mask of a partial vector as second
+// argument
+template <
+    typename F, typename A, typename M,
+#ifdef Vc_MSVC
+#define Vc_TEMPLATE_
+#else
+#define Vc_TEMPLATE_ template
+#endif
+    typename MemberPtr = decltype(&F::Vc_TEMPLATE_ operator()<A, M>)>
+decltype(is_functor_argument_immutable_impl::test(std::declval<MemberPtr>())) test4(int);
+#undef Vc_TEMPLATE_
+
+// template operator() members with only the vector type as template parameter, e.g.
+// template <class V> void operator()(V &, typename V::mask_type)
+template <typename F, typename A, typename M>
+decltype(test2<F, A>(int())) test4(float);
 
 }  // namespace is_functor_argument_immutable_impl
 
@@ -83,6 +110,23 @@ struct is_functor_argument_immutable<F, A, true>
     : decltype(is_functor_argument_immutable_impl::test3(std::declval<F>())) {
 };
 
+/**\internal
+ * Like is_functor_argument_immutable, but for functors that are called with a second
+ * argument of type \p M (the mask of valid entries in \p A).
+ */
+template <typename F, typename A, typename M,
+          bool = std::is_function<typename std::remove_pointer<F>::type>::value>
+struct is_masked_functor_argument_immutable;
+template <typename F, typename A, typename M>
+struct is_masked_functor_argument_immutable<F, A, M, false>
+    : decltype(is_functor_argument_immutable_impl::test4<
+                      typename std::remove_reference<F>::type, A, M>(int())) {
+};
+template <typename F, typename A, typename M>
+struct is_masked_functor_argument_immutable<F, A, M, true>
+    : decltype(is_functor_argument_immutable_impl::test3(std::declval<F>())) {
+};
+
 }  // namespace Traits
 }  // namespace Vc
 
@@ -69,6 +69,10 @@ template <> struct is_valid_vector_argument<int>    : public std::true_type {};
 template <> struct is_valid_vector_argument<unsigned int>   : public std::true_type {};
 template <> struct is_valid_vector_argument<short>  : public std::true_type {};
 template <> struct is_valid_vector_argument<unsigned short> : public std::true_type {};
+template <> struct is_valid_vector_argument<signed char>    : public std::true_type {};
+template <> struct is_valid_vector_argument<unsigned char>  : public std::true_type {};
+template <> struct is_valid_vector_argument<long long>      : public std::true_type {};
+template <> struct is_valid_vector_argument<unsigned long long> : public std::true_type {};
 
 template<typename T> struct is_simd_mask_internal : public std::false_type {};
 template<typename T> struct is_simd_vector_internal : public std::false_type {};
@@ -147,6 +151,19 @@ struct isSimdMaskArray : public is_simd_mask_array_internal<decay<T>>
 /// \internal Identifies LoadStoreFlag types
 template <typename T> struct is_load_store_flag : public is_loadstoreflag_internal<decay<T>> {};
 
+/**\internal
+ * Identifies the memory types \p U that a vector with entries of type \p T can be loaded
+ * from and stored to: any arithmetic type, and the float16 and bfloat16 storage types for
+ * float vectors.
+ */
+template <typename U, typename T>
+struct is_load_store_type
+    : public std::integral_constant<bool, std::is_arithmetic<U>::value ||
+                                              ((std::is_same<U, float16>::value ||
+                                                std::is_same<U, bfloat16>::value) &&
+                                               std::is_same<T, float>::value)> {
+};
+
 /// \internal Identifies a SimdArray type with a single Vector member
 template <typename T> struct is_atomic_simdarray_internal : public std::false_type {};
 template <typename T> using isAtomicSimdArray = is_atomic_simdarray_internal<decay<T>>;
@@ -178,6 +178,10 @@ using  uchar_m = Mask< uchar>;
     static_assert(uint_v::Size   == Vc_UINT_V_SIZE  , "Vc_UINT_V_SIZE macro defined to an incorrect value  ");
     static_assert(short_v::Size  == Vc_SHORT_V_SIZE , "Vc_SHORT_V_SIZE macro defined to an incorrect value ");
     static_assert(ushort_v::Size == Vc_USHORT_V_SIZE, "Vc_USHORT_V_SIZE macro defined to an incorrect value");
+    static_assert(schar_v::Size  == Vc_SCHAR_V_SIZE , "Vc_SCHAR_V_SIZE macro defined to an incorrect value ");
+    static_assert(uchar_v::Size  == Vc_UCHAR_V_SIZE , "Vc_UCHAR_V_SIZE macro defined to an incorrect value ");
+    static_assert(llong_v::Size  == Vc_LLONG_V_SIZE , "Vc_LLONG_V_SIZE macro defined to an incorrect value ");
+    static_assert(ullong_v::Size == Vc_ULLONG_V_SIZE, "Vc_ULLONG_V_SIZE macro defined to an incorrect value");
   }
 }
 
@@ -254,20 +258,29 @@ namespace std
   using Vc::asin;
   using Vc::atan;
   using Vc::atan2;
+  using Vc::cbrt;
   using Vc::ceil;
   using Vc::cos;
+  using Vc::erf;
+  using Vc::erfc;
   using Vc::exp;
+  using Vc::exp2;
+  using Vc::expm1;
   using Vc::fma;
   using Vc::trunc;
   using Vc::floor;
   using Vc::frexp;
+  using Vc::hypot;
   using Vc::ldexp;
   using Vc::log;
   using Vc::log10;
+  using Vc::log1p;
   using Vc::log2;
+  using Vc::pow;
   using Vc::round;
   using Vc::sin;
   using Vc::sqrt;
+  using Vc::tanh;
 
   using Vc::isfinite;
   using Vc::isnan;
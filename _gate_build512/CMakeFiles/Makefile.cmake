@@ -0,0 +1,507 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/CTestCustom.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/AddCompilerFlag.cmake"
+  "/root/repo/cmake/AddTargetProperty.cmake"
+  "/root/repo/cmake/CheckCCompilerFlag.cmake"
+  "/root/repo/cmake/CheckCXXCompilerFlag.cmake"
+  "/root/repo/cmake/OptimizeForArchitecture.cmake"
+  "/root/repo/cmake/UserWarning.cmake"
+  "/root/repo/cmake/VcConfig.cmake.in"
+  "/root/repo/cmake/VcMacros.cmake"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/AddFileDependencies.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake/VcConfigVersion.cmake"
+  "cmake/VcConfig.cmake"
+  "DartConfiguration.tcl"
+  "CTestCustom.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/other.dir/DependInfo.cmake"
+  "CMakeFiles/Scalar.dir/DependInfo.cmake"
+  "CMakeFiles/SSE.dir/DependInfo.cmake"
+  "CMakeFiles/AVX.dir/DependInfo.cmake"
+  "CMakeFiles/AVX2.dir/DependInfo.cmake"
+  "CMakeFiles/AVX512.dir/DependInfo.cmake"
+  "CMakeFiles/Vc.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/build_tests.dir/DependInfo.cmake"
+  "CMakeFiles/cached_help.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_types_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subscript_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subscript_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subscript_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subscript_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subscript_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_subscript_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_traits_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_traits_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_traits_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_traits_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_traits_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_type_traits_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/stlcontainer_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/stlcontainer_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/stlcontainer_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/stlcontainer_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/stlcontainer_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_stlcontainer_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scalaraccess_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scalaraccess_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scalaraccess_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scalaraccess_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scalaraccess_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scalaraccess_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_memory_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arithmetics_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arithmetics_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arithmetics_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arithmetics_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arithmetics_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_arithmetics_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdize_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdize_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdize_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdize_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdize_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdize_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/implicit_type_conversion_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/implicit_type_conversion_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/implicit_type_conversion_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/implicit_type_conversion_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/implicit_type_conversion_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_implicit_type_conversion_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/iterators_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/iterators_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/iterators_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/iterators_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/iterators_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_iterators_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/load_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/load_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/load_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/load_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/load_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_load_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/store_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/store_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/store_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/store_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/store_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_store_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ulp_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ulp_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ulp_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ulp_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ulp_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_ulp_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/logarithm_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/logarithm_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/logarithm_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/logarithm_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/logarithm_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_logarithm_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/trigonometric_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/trigonometric_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/trigonometric_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/trigonometric_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/trigonometric_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_trigonometric_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/math_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/math_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/math_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/math_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/math_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_math_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gh200_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gh200_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gh200_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gh200_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gh200_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gh200_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/reductions_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/reductions_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/reductions_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/reductions_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/reductions_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_reductions_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mask_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mask_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mask_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mask_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mask_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_mask_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_utils_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sorted_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sorted_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sorted_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sorted_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sorted_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_sorted_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/random_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/random_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/random_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/random_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/random_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_random_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/deinterleave_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/deinterleave_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/deinterleave_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/deinterleave_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/deinterleave_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_deinterleave_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gatherinterleavedmemory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gatherinterleavedmemory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gatherinterleavedmemory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gatherinterleavedmemory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gatherinterleavedmemory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gatherinterleavedmemory_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/casts_Vc_DEFAULT_TYPES_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/casts_Vc_DEFAULT_TYPES_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/casts_Vc_DEFAULT_TYPES_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/casts_Vc_DEFAULT_TYPES_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/casts_Vc_DEFAULT_TYPES_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_casts_Vc_DEFAULT_TYPES_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_BSF_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_BSF_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_BSF_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_BSF_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_BSF_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_BSF_GATHERS_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_POPCNT_BSF_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_POPCNT_BSF_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_POPCNT_BSF_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_POPCNT_BSF_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_SET_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_SET_GATHERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_SET_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_SET_GATHERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_SET_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_SET_GATHERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gather_Vc_USE_SET_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_SET_GATHERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_gather_Vc_USE_SET_GATHERS_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_BSF_SCATTERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_BSF_SCATTERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_BSF_SCATTERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_BSF_SCATTERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_POPCNT_BSF_SCATTERS_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatter_Vc_USE_POPCNT_BSF_SCATTERS_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdarray_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_scalar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdarray_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_sse.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdarray_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_avx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdarray_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simdarray_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_avx512.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_simdarray_all.dir/DependInfo.cmake"
+  "tests/CMakeFiles/abi_SSE.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_abi_SSE.dir/DependInfo.cmake"
+  "tests/CMakeFiles/abi_SSE_AVX.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_abi_SSE_AVX.dir/DependInfo.cmake"
+  "tests/CMakeFiles/abi_AVX.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_abi_AVX.dir/DependInfo.cmake"
+  "tests/CMakeFiles/abi_AVX2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_abi_AVX2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sse2_blend.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sse4_blend.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dispatch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_dispatch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/alignmentinheritance.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_alignmentinheritance.dir/DependInfo.cmake"
+  "tests/CMakeFiles/alignedbase.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_alignedbase.dir/DependInfo.cmake"
+  "tests/CMakeFiles/linkTestLibDynamic1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/linkTestLibDynamic2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/linkTestLibStatic.dir/DependInfo.cmake"
+  "tests/CMakeFiles/linkTest.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build512/avx_sorthelper_AVX.cpp" "CMakeFiles/Vc.dir/avx_sorthelper_AVX.cpp.o" "gcc" "CMakeFiles/Vc.dir/avx_sorthelper_AVX.cpp.o.d"
+  "/root/repo/_gate_build512/avx_sorthelper_AVX2+FMA+BMI2.cpp" "CMakeFiles/Vc.dir/avx_sorthelper_AVX2+FMA+BMI2.cpp.o" "gcc" "CMakeFiles/Vc.dir/avx_sorthelper_AVX2+FMA+BMI2.cpp.o.d"
+  "/root/repo/src/const.cpp" "CMakeFiles/Vc.dir/src/const.cpp.o" "gcc" "CMakeFiles/Vc.dir/src/const.cpp.o.d"
+  "/root/repo/src/cpuid.cpp" "CMakeFiles/Vc.dir/src/cpuid.cpp.o" "gcc" "CMakeFiles/Vc.dir/src/cpuid.cpp.o.d"
+  "/root/repo/src/gatherimplementation.cpp" "CMakeFiles/Vc.dir/src/gatherimplementation.cpp.o" "gcc" "CMakeFiles/Vc.dir/src/gatherimplementation.cpp.o.d"
+  "/root/repo/src/support_x86.cpp" "CMakeFiles/Vc.dir/src/support_x86.cpp.o" "gcc" "CMakeFiles/Vc.dir/src/support_x86.cpp.o.d"
+  "/root/repo/src/threadpool.cpp" "CMakeFiles/Vc.dir/src/threadpool.cpp.o" "gcc" "CMakeFiles/Vc.dir/src/threadpool.cpp.o.d"
+  "/root/repo/_gate_build512/sse_sorthelper_AVX.cpp" "CMakeFiles/Vc.dir/sse_sorthelper_AVX.cpp.o" "gcc" "CMakeFiles/Vc.dir/sse_sorthelper_AVX.cpp.o.d"
+  "/root/repo/_gate_build512/sse_sorthelper_AVX2+FMA+BMI2.cpp" "CMakeFiles/Vc.dir/sse_sorthelper_AVX2+FMA+BMI2.cpp.o" "gcc" "CMakeFiles/Vc.dir/sse_sorthelper_AVX2+FMA+BMI2.cpp.o.d"
+  "/root/repo/_gate_build512/sse_sorthelper_SSE2.cpp" "CMakeFiles/Vc.dir/sse_sorthelper_SSE2.cpp.o" "gcc" "CMakeFiles/Vc.dir/sse_sorthelper_SSE2.cpp.o.d"
+  "/root/repo/_gate_build512/sse_sorthelper_SSE4_1.cpp" "CMakeFiles/Vc.dir/sse_sorthelper_SSE4_1.cpp.o" "gcc" "CMakeFiles/Vc.dir/sse_sorthelper_SSE4_1.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_AVX+FMA.cpp" "CMakeFiles/Vc.dir/trigonometric_AVX+FMA.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_AVX+FMA.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_AVX+XOP+FMA.cpp" "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_AVX+XOP+FMA4.cpp" "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA4.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA4.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_AVX.cpp" "CMakeFiles/Vc.dir/trigonometric_AVX.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_AVX.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_AVX2+FMA+BMI2.cpp" "CMakeFiles/Vc.dir/trigonometric_AVX2+FMA+BMI2.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_AVX2+FMA+BMI2.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_SSE+XOP+FMA4.cpp" "CMakeFiles/Vc.dir/trigonometric_SSE+XOP+FMA4.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_SSE+XOP+FMA4.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_SSE2.cpp" "CMakeFiles/Vc.dir/trigonometric_SSE2.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_SSE2.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_SSE3.cpp" "CMakeFiles/Vc.dir/trigonometric_SSE3.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_SSE3.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_SSE4_1.cpp" "CMakeFiles/Vc.dir/trigonometric_SSE4_1.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_SSE4_1.cpp.o.d"
+  "/root/repo/_gate_build512/trigonometric_SSSE3.cpp" "CMakeFiles/Vc.dir/trigonometric_SSSE3.cpp.o" "gcc" "CMakeFiles/Vc.dir/trigonometric_SSSE3.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Vc.dir/avx_sorthelper_AVX.cpp.o"
+  "CMakeFiles/Vc.dir/avx_sorthelper_AVX.cpp.o.d"
+  "CMakeFiles/Vc.dir/avx_sorthelper_AVX2+FMA+BMI2.cpp.o"
+  "CMakeFiles/Vc.dir/avx_sorthelper_AVX2+FMA+BMI2.cpp.o.d"
+  "CMakeFiles/Vc.dir/src/const.cpp.o"
+  "CMakeFiles/Vc.dir/src/const.cpp.o.d"
+  "CMakeFiles/Vc.dir/src/cpuid.cpp.o"
+  "CMakeFiles/Vc.dir/src/cpuid.cpp.o.d"
+  "CMakeFiles/Vc.dir/src/gatherimplementation.cpp.o"
+  "CMakeFiles/Vc.dir/src/gatherimplementation.cpp.o.d"
+  "CMakeFiles/Vc.dir/src/support_x86.cpp.o"
+  "CMakeFiles/Vc.dir/src/support_x86.cpp.o.d"
+  "CMakeFiles/Vc.dir/src/threadpool.cpp.o"
+  "CMakeFiles/Vc.dir/src/threadpool.cpp.o.d"
+  "CMakeFiles/Vc.dir/sse_sorthelper_AVX.cpp.o"
+  "CMakeFiles/Vc.dir/sse_sorthelper_AVX.cpp.o.d"
+  "CMakeFiles/Vc.dir/sse_sorthelper_AVX2+FMA+BMI2.cpp.o"
+  "CMakeFiles/Vc.dir/sse_sorthelper_AVX2+FMA+BMI2.cpp.o.d"
+  "CMakeFiles/Vc.dir/sse_sorthelper_SSE2.cpp.o"
+  "CMakeFiles/Vc.dir/sse_sorthelper_SSE2.cpp.o.d"
+  "CMakeFiles/Vc.dir/sse_sorthelper_SSE4_1.cpp.o"
+  "CMakeFiles/Vc.dir/sse_sorthelper_SSE4_1.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+FMA.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+FMA.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA4.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_AVX+XOP+FMA4.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_AVX.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_AVX.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_AVX2+FMA+BMI2.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_AVX2+FMA+BMI2.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_SSE+XOP+FMA4.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_SSE+XOP+FMA4.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_SSE2.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_SSE2.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_SSE3.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_SSE3.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_SSE4_1.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_SSE4_1.cpp.o.d"
+  "CMakeFiles/Vc.dir/trigonometric_SSSE3.cpp.o"
+  "CMakeFiles/Vc.dir/trigonometric_SSSE3.cpp.o.d"
+  "avx_sorthelper_AVX.cpp"
+  "avx_sorthelper_AVX2+FMA+BMI2.cpp"
+  "libVc.a"
+  "libVc.pdb"
+  "sse_sorthelper_AVX.cpp"
+  "sse_sorthelper_AVX2+FMA+BMI2.cpp"
+  "sse_sorthelper_SSE2.cpp"
+  "sse_sorthelper_SSE4_1.cpp"
+  "trigonometric_AVX+FMA.cpp"
+  "trigonometric_AVX+XOP+FMA.cpp"
+  "trigonometric_AVX+XOP+FMA4.cpp"
+  "trigonometric_AVX.cpp"
+  "trigonometric_AVX2+FMA+BMI2.cpp"
+  "trigonometric_SSE+XOP+FMA4.cpp"
+  "trigonometric_SSE2.cpp"
+  "trigonometric_SSE3.cpp"
+  "trigonometric_SSE4_1.cpp"
+  "trigonometric_SSSE3.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Vc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
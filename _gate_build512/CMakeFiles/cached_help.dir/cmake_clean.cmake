@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cached_help"
+  "help.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/cached_help.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
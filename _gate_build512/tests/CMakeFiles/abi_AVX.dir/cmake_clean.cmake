@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/abi_AVX"
+  "abi_AVX.i"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/abi_AVX.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alignedbase.dir/alignedbase.cpp.o"
+  "CMakeFiles/alignedbase.dir/alignedbase.cpp.o.d"
+  "alignedbase"
+  "alignedbase.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alignedbase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alignmentinheritance.dir/alignmentinheritance.cpp.o"
+  "CMakeFiles/alignmentinheritance.dir/alignmentinheritance.cpp.o.d"
+  "alignmentinheritance"
+  "alignmentinheritance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alignmentinheritance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
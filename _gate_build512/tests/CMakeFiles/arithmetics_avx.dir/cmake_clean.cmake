@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetics_avx.dir/arithmetics.cpp.o"
+  "CMakeFiles/arithmetics_avx.dir/arithmetics.cpp.o.d"
+  "arithmetics_avx"
+  "arithmetics_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetics_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
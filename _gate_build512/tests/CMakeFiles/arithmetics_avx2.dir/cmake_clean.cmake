@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetics_avx2.dir/arithmetics.cpp.o"
+  "CMakeFiles/arithmetics_avx2.dir/arithmetics.cpp.o.d"
+  "arithmetics_avx2"
+  "arithmetics_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetics_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetics_avx512.dir/arithmetics.cpp.o"
+  "CMakeFiles/arithmetics_avx512.dir/arithmetics.cpp.o.d"
+  "arithmetics_avx512"
+  "arithmetics_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetics_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
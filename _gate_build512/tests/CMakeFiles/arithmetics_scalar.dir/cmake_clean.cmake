@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetics_scalar.dir/arithmetics.cpp.o"
+  "CMakeFiles/arithmetics_scalar.dir/arithmetics.cpp.o.d"
+  "arithmetics_scalar"
+  "arithmetics_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetics_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetics_sse.dir/arithmetics.cpp.o"
+  "CMakeFiles/arithmetics_sse.dir/arithmetics.cpp.o.d"
+  "arithmetics_sse"
+  "arithmetics_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetics_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
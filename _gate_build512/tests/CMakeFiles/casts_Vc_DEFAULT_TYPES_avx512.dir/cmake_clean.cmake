@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/casts_Vc_DEFAULT_TYPES_avx512.dir/casts.cpp.o"
+  "CMakeFiles/casts_Vc_DEFAULT_TYPES_avx512.dir/casts.cpp.o.d"
+  "casts_Vc_DEFAULT_TYPES_avx512"
+  "casts_Vc_DEFAULT_TYPES_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/casts_Vc_DEFAULT_TYPES_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
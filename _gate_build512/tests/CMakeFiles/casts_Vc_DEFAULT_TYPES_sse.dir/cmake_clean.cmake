@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/casts_Vc_DEFAULT_TYPES_sse.dir/casts.cpp.o"
+  "CMakeFiles/casts_Vc_DEFAULT_TYPES_sse.dir/casts.cpp.o.d"
+  "casts_Vc_DEFAULT_TYPES_sse"
+  "casts_Vc_DEFAULT_TYPES_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/casts_Vc_DEFAULT_TYPES_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
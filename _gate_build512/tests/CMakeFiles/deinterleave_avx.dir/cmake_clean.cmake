@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/deinterleave_avx.dir/deinterleave.cpp.o"
+  "CMakeFiles/deinterleave_avx.dir/deinterleave.cpp.o.d"
+  "deinterleave_avx"
+  "deinterleave_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deinterleave_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/deinterleave_scalar.dir/deinterleave.cpp.o"
+  "CMakeFiles/deinterleave_scalar.dir/deinterleave.cpp.o.d"
+  "deinterleave_scalar"
+  "deinterleave_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deinterleave_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
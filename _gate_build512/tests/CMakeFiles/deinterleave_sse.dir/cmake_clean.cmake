@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/deinterleave_sse.dir/deinterleave.cpp.o"
+  "CMakeFiles/deinterleave_sse.dir/deinterleave.cpp.o.d"
+  "deinterleave_sse"
+  "deinterleave_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deinterleave_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/dispatch.cpp" "tests/CMakeFiles/dispatch.dir/dispatch.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatch.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_AVX.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_AVX2+FMA+BMI2.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX2+FMA+BMI2.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX2+FMA+BMI2.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_AVX512+FMA+BMI2.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX512+FMA+BMI2.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_AVX512+FMA+BMI2.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_SSE2.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_SSE2.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_SSE2.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_SSE4_2.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_SSE4_2.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_SSE4_2.cpp.o.d"
+  "/root/repo/_gate_build512/tests/dispatchkernels_Scalar.cpp" "tests/CMakeFiles/dispatch.dir/dispatchkernels_Scalar.cpp.o" "gcc" "tests/CMakeFiles/dispatch.dir/dispatchkernels_Scalar.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build512/CMakeFiles/Vc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
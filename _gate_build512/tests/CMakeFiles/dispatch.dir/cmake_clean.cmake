@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispatch.dir/dispatch.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatch.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX2+FMA+BMI2.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX2+FMA+BMI2.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX512+FMA+BMI2.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_AVX512+FMA+BMI2.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_SSE2.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_SSE2.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_SSE4_2.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_SSE4_2.cpp.o.d"
+  "CMakeFiles/dispatch.dir/dispatchkernels_Scalar.cpp.o"
+  "CMakeFiles/dispatch.dir/dispatchkernels_Scalar.cpp.o.d"
+  "dispatch"
+  "dispatch.pdb"
+  "dispatchkernels_AVX.cpp"
+  "dispatchkernels_AVX2+FMA+BMI2.cpp"
+  "dispatchkernels_AVX512+FMA+BMI2.cpp"
+  "dispatchkernels_SSE2.cpp"
+  "dispatchkernels_SSE4_2.cpp"
+  "dispatchkernels_Scalar.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
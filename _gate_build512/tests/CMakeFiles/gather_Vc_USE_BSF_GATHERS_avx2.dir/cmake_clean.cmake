@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx2.dir/gather.cpp.o"
+  "CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx2.dir/gather.cpp.o.d"
+  "gather_Vc_USE_BSF_GATHERS_avx2"
+  "gather_Vc_USE_BSF_GATHERS_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gather_Vc_USE_BSF_GATHERS_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for gather_Vc_USE_POPCNT_BSF_GATHERS_avx.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gather_Vc_USE_SET_GATHERS_avx.dir/gather.cpp.o"
+  "CMakeFiles/gather_Vc_USE_SET_GATHERS_avx.dir/gather.cpp.o.d"
+  "gather_Vc_USE_SET_GATHERS_avx"
+  "gather_Vc_USE_SET_GATHERS_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gather_Vc_USE_SET_GATHERS_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
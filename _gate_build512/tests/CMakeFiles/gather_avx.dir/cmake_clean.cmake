@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gather_avx.dir/gather.cpp.o"
+  "CMakeFiles/gather_avx.dir/gather.cpp.o.d"
+  "gather_avx"
+  "gather_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gather_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gather_scalar.dir/gather.cpp.o"
+  "CMakeFiles/gather_scalar.dir/gather.cpp.o.d"
+  "gather_scalar"
+  "gather_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gather_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gather_sse.dir/gather.cpp.o"
+  "CMakeFiles/gather_sse.dir/gather.cpp.o.d"
+  "gather_sse"
+  "gather_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gather_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gatherinterleavedmemory_avx2.dir/gatherinterleavedmemory.cpp.o"
+  "CMakeFiles/gatherinterleavedmemory_avx2.dir/gatherinterleavedmemory.cpp.o.d"
+  "gatherinterleavedmemory_avx2"
+  "gatherinterleavedmemory_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gatherinterleavedmemory_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gatherinterleavedmemory_avx512.dir/gatherinterleavedmemory.cpp.o"
+  "CMakeFiles/gatherinterleavedmemory_avx512.dir/gatherinterleavedmemory.cpp.o.d"
+  "gatherinterleavedmemory_avx512"
+  "gatherinterleavedmemory_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gatherinterleavedmemory_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gatherinterleavedmemory_scalar.dir/gatherinterleavedmemory.cpp.o"
+  "CMakeFiles/gatherinterleavedmemory_scalar.dir/gatherinterleavedmemory.cpp.o.d"
+  "gatherinterleavedmemory_scalar"
+  "gatherinterleavedmemory_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gatherinterleavedmemory_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
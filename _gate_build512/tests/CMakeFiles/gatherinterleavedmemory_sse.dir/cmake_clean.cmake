@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gatherinterleavedmemory_sse.dir/gatherinterleavedmemory.cpp.o"
+  "CMakeFiles/gatherinterleavedmemory_sse.dir/gatherinterleavedmemory.cpp.o.d"
+  "gatherinterleavedmemory_sse"
+  "gatherinterleavedmemory_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gatherinterleavedmemory_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gh200_avx2.dir/gh200.cpp.o"
+  "CMakeFiles/gh200_avx2.dir/gh200.cpp.o.d"
+  "gh200_avx2"
+  "gh200_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gh200_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gh200_scalar.dir/gh200.cpp.o"
+  "CMakeFiles/gh200_scalar.dir/gh200.cpp.o.d"
+  "gh200_scalar"
+  "gh200_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gh200_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gh200_sse.dir/gh200.cpp.o"
+  "CMakeFiles/gh200_sse.dir/gh200.cpp.o.d"
+  "gh200_sse"
+  "gh200_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gh200_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/implicit_type_conversion_avx.dir/implicit_type_conversion.cpp.o"
+  "CMakeFiles/implicit_type_conversion_avx.dir/implicit_type_conversion.cpp.o.d"
+  "implicit_type_conversion_avx"
+  "implicit_type_conversion_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/implicit_type_conversion_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
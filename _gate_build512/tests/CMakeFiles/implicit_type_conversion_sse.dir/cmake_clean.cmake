@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/implicit_type_conversion_sse.dir/implicit_type_conversion.cpp.o"
+  "CMakeFiles/implicit_type_conversion_sse.dir/implicit_type_conversion.cpp.o.d"
+  "implicit_type_conversion_sse"
+  "implicit_type_conversion_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/implicit_type_conversion_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterators_avx.dir/iterators.cpp.o"
+  "CMakeFiles/iterators_avx.dir/iterators.cpp.o.d"
+  "iterators_avx"
+  "iterators_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterators_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
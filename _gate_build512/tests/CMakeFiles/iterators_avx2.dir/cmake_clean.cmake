@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterators_avx2.dir/iterators.cpp.o"
+  "CMakeFiles/iterators_avx2.dir/iterators.cpp.o.d"
+  "iterators_avx2"
+  "iterators_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterators_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterators_avx512.dir/iterators.cpp.o"
+  "CMakeFiles/iterators_avx512.dir/iterators.cpp.o.d"
+  "iterators_avx512"
+  "iterators_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterators_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
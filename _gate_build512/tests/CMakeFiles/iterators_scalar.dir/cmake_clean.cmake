@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterators_scalar.dir/iterators.cpp.o"
+  "CMakeFiles/iterators_scalar.dir/iterators.cpp.o.d"
+  "iterators_scalar"
+  "iterators_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterators_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterators_sse.dir/iterators.cpp.o"
+  "CMakeFiles/iterators_sse.dir/iterators.cpp.o.d"
+  "iterators_sse"
+  "iterators_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterators_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
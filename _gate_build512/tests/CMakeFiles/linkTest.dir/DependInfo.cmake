@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/linkTest0.cpp" "tests/CMakeFiles/linkTest.dir/linkTest0.cpp.o" "gcc" "tests/CMakeFiles/linkTest.dir/linkTest0.cpp.o.d"
+  "/root/repo/tests/linkTest1.cpp" "tests/CMakeFiles/linkTest.dir/linkTest1.cpp.o" "gcc" "tests/CMakeFiles/linkTest.dir/linkTest1.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build512/CMakeFiles/Vc.dir/DependInfo.cmake"
+  "/root/repo/_gate_build512/tests/CMakeFiles/linkTestLibDynamic1.dir/DependInfo.cmake"
+  "/root/repo/_gate_build512/tests/CMakeFiles/linkTestLibDynamic2.dir/DependInfo.cmake"
+  "/root/repo/_gate_build512/tests/CMakeFiles/linkTestLibStatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linkTest.dir/linkTest0.cpp.o"
+  "CMakeFiles/linkTest.dir/linkTest0.cpp.o.d"
+  "CMakeFiles/linkTest.dir/linkTest1.cpp.o"
+  "CMakeFiles/linkTest.dir/linkTest1.cpp.o.d"
+  "linkTest"
+  "linkTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linkTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
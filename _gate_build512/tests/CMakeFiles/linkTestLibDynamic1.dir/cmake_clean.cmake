@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linkTestLibDynamic1.dir/linkTestLib0.cpp.o"
+  "CMakeFiles/linkTestLibDynamic1.dir/linkTestLib0.cpp.o.d"
+  "CMakeFiles/linkTestLibDynamic1.dir/linkTestLib1.cpp.o"
+  "CMakeFiles/linkTestLibDynamic1.dir/linkTestLib1.cpp.o.d"
+  "liblinkTestLibDynamic1.pdb"
+  "liblinkTestLibDynamic1.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linkTestLibDynamic1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
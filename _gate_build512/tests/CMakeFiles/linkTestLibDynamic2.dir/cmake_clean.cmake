@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linkTestLibDynamic2.dir/linkTestLib0.cpp.o"
+  "CMakeFiles/linkTestLibDynamic2.dir/linkTestLib0.cpp.o.d"
+  "CMakeFiles/linkTestLibDynamic2.dir/linkTestLib1.cpp.o"
+  "CMakeFiles/linkTestLibDynamic2.dir/linkTestLib1.cpp.o.d"
+  "liblinkTestLibDynamic2.pdb"
+  "liblinkTestLibDynamic2.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linkTestLibDynamic2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
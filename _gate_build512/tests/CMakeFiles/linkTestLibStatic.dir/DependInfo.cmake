@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/linkTestLib2.cpp" "tests/CMakeFiles/linkTestLibStatic.dir/linkTestLib2.cpp.o" "gcc" "tests/CMakeFiles/linkTestLibStatic.dir/linkTestLib2.cpp.o.d"
+  "/root/repo/tests/linkTestLib3.cpp" "tests/CMakeFiles/linkTestLibStatic.dir/linkTestLib3.cpp.o" "gcc" "tests/CMakeFiles/linkTestLibStatic.dir/linkTestLib3.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build512/CMakeFiles/Vc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linkTestLibStatic.dir/linkTestLib2.cpp.o"
+  "CMakeFiles/linkTestLibStatic.dir/linkTestLib2.cpp.o.d"
+  "CMakeFiles/linkTestLibStatic.dir/linkTestLib3.cpp.o"
+  "CMakeFiles/linkTestLibStatic.dir/linkTestLib3.cpp.o.d"
+  "liblinkTestLibStatic.a"
+  "liblinkTestLibStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linkTestLibStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load_avx.dir/load.cpp.o"
+  "CMakeFiles/load_avx.dir/load.cpp.o.d"
+  "load_avx"
+  "load_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load_avx512.dir/load.cpp.o"
+  "CMakeFiles/load_avx512.dir/load.cpp.o.d"
+  "load_avx512"
+  "load_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
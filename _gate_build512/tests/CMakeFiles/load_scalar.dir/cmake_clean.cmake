@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load_scalar.dir/load.cpp.o"
+  "CMakeFiles/load_scalar.dir/load.cpp.o.d"
+  "load_scalar"
+  "load_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load_sse.dir/load.cpp.o"
+  "CMakeFiles/load_sse.dir/load.cpp.o.d"
+  "load_sse"
+  "load_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
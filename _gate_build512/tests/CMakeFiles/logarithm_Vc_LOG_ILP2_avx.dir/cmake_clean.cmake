@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logarithm_Vc_LOG_ILP2_avx.dir/logarithm.cpp.o"
+  "CMakeFiles/logarithm_Vc_LOG_ILP2_avx.dir/logarithm.cpp.o.d"
+  "logarithm_Vc_LOG_ILP2_avx"
+  "logarithm_Vc_LOG_ILP2_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logarithm_Vc_LOG_ILP2_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logarithm_Vc_LOG_ILP_avx2.dir/logarithm.cpp.o"
+  "CMakeFiles/logarithm_Vc_LOG_ILP_avx2.dir/logarithm.cpp.o.d"
+  "logarithm_Vc_LOG_ILP_avx2"
+  "logarithm_Vc_LOG_ILP_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logarithm_Vc_LOG_ILP_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
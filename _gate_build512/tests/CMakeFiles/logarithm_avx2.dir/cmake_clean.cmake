@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logarithm_avx2.dir/logarithm.cpp.o"
+  "CMakeFiles/logarithm_avx2.dir/logarithm.cpp.o.d"
+  "logarithm_avx2"
+  "logarithm_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logarithm_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logarithm_scalar.dir/logarithm.cpp.o"
+  "CMakeFiles/logarithm_scalar.dir/logarithm.cpp.o.d"
+  "logarithm_scalar"
+  "logarithm_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logarithm_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logarithm_sse.dir/logarithm.cpp.o"
+  "CMakeFiles/logarithm_sse.dir/logarithm.cpp.o.d"
+  "logarithm_sse"
+  "logarithm_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logarithm_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_avx.dir/mask.cpp.o"
+  "CMakeFiles/mask_avx.dir/mask.cpp.o.d"
+  "mask_avx"
+  "mask_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
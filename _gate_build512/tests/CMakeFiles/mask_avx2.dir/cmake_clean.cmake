@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_avx2.dir/mask.cpp.o"
+  "CMakeFiles/mask_avx2.dir/mask.cpp.o.d"
+  "mask_avx2"
+  "mask_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_avx512.dir/mask.cpp.o"
+  "CMakeFiles/mask_avx512.dir/mask.cpp.o.d"
+  "mask_avx512"
+  "mask_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
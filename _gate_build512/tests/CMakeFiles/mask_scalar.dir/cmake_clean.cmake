@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_scalar.dir/mask.cpp.o"
+  "CMakeFiles/mask_scalar.dir/mask.cpp.o.d"
+  "mask_scalar"
+  "mask_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
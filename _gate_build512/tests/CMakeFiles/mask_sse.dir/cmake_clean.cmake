@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_sse.dir/mask.cpp.o"
+  "CMakeFiles/mask_sse.dir/mask.cpp.o.d"
+  "mask_sse"
+  "mask_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
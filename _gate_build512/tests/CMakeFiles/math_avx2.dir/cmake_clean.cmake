@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_avx2.dir/math.cpp.o"
+  "CMakeFiles/math_avx2.dir/math.cpp.o.d"
+  "math_avx2"
+  "math_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_avx512.dir/math.cpp.o"
+  "CMakeFiles/math_avx512.dir/math.cpp.o.d"
+  "math_avx512"
+  "math_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_scalar.dir/math.cpp.o"
+  "CMakeFiles/math_scalar.dir/math.cpp.o.d"
+  "math_scalar"
+  "math_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
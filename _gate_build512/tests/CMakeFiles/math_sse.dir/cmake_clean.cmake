@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_sse.dir/math.cpp.o"
+  "CMakeFiles/math_sse.dir/math.cpp.o.d"
+  "math_sse"
+  "math_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
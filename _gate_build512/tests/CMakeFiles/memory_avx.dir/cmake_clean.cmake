@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_avx.dir/memory.cpp.o"
+  "CMakeFiles/memory_avx.dir/memory.cpp.o.d"
+  "memory_avx"
+  "memory_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
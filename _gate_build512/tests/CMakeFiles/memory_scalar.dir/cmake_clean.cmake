@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_scalar.dir/memory.cpp.o"
+  "CMakeFiles/memory_scalar.dir/memory.cpp.o.d"
+  "memory_scalar"
+  "memory_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
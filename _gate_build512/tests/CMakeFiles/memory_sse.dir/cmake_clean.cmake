@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_sse.dir/memory.cpp.o"
+  "CMakeFiles/memory_sse.dir/memory.cpp.o.d"
+  "memory_sse"
+  "memory_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
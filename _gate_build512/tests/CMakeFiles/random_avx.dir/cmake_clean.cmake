@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_avx.dir/random.cpp.o"
+  "CMakeFiles/random_avx.dir/random.cpp.o.d"
+  "random_avx"
+  "random_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_avx2.dir/random.cpp.o"
+  "CMakeFiles/random_avx2.dir/random.cpp.o.d"
+  "random_avx2"
+  "random_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
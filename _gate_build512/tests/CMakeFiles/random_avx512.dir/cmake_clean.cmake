@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_avx512.dir/random.cpp.o"
+  "CMakeFiles/random_avx512.dir/random.cpp.o.d"
+  "random_avx512"
+  "random_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
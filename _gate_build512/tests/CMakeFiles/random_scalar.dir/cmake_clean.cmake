@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_scalar.dir/random.cpp.o"
+  "CMakeFiles/random_scalar.dir/random.cpp.o.d"
+  "random_scalar"
+  "random_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
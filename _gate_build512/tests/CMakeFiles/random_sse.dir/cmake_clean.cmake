@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_sse.dir/random.cpp.o"
+  "CMakeFiles/random_sse.dir/random.cpp.o.d"
+  "random_sse"
+  "random_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reductions_avx.dir/reductions.cpp.o"
+  "CMakeFiles/reductions_avx.dir/reductions.cpp.o.d"
+  "reductions_avx"
+  "reductions_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reductions_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reductions_avx2.dir/reductions.cpp.o"
+  "CMakeFiles/reductions_avx2.dir/reductions.cpp.o.d"
+  "reductions_avx2"
+  "reductions_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reductions_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reductions_avx512.dir/reductions.cpp.o"
+  "CMakeFiles/reductions_avx512.dir/reductions.cpp.o.d"
+  "reductions_avx512"
+  "reductions_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reductions_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reductions_scalar.dir/reductions.cpp.o"
+  "CMakeFiles/reductions_scalar.dir/reductions.cpp.o.d"
+  "reductions_scalar"
+  "reductions_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reductions_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
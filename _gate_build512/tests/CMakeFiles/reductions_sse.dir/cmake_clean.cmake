@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reductions_sse.dir/reductions.cpp.o"
+  "CMakeFiles/reductions_sse.dir/reductions.cpp.o.d"
+  "reductions_sse"
+  "reductions_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reductions_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
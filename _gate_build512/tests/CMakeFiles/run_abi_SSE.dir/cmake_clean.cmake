@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_abi_SSE"
+  "abi_SSE.i"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_abi_SSE.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_alignedbase"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_alignedbase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_casts_Vc_DEFAULT_TYPES_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_casts_Vc_DEFAULT_TYPES_sse"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_casts_Vc_DEFAULT_TYPES_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_deinterleave_avx"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_deinterleave_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
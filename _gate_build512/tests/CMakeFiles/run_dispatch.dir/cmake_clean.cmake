@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_dispatch"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_dispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
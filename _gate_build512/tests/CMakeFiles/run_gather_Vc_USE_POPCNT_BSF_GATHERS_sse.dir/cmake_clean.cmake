@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_sse"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_gather_Vc_USE_POPCNT_BSF_GATHERS_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
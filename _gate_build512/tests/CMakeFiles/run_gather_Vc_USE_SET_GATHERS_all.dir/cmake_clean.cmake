@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_gather_Vc_USE_SET_GATHERS_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_gather_Vc_USE_SET_GATHERS_avx512"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_gather_Vc_USE_SET_GATHERS_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_implicit_type_conversion_avx2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_implicit_type_conversion_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
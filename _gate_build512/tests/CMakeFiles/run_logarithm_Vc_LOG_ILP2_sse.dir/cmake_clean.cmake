@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_logarithm_Vc_LOG_ILP2_sse"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_logarithm_Vc_LOG_ILP2_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
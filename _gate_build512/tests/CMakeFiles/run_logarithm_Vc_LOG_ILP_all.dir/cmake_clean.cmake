@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_logarithm_Vc_LOG_ILP_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
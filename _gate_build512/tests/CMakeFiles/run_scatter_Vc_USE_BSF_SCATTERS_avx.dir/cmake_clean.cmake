@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_avx"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_scatter_Vc_USE_BSF_SCATTERS_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
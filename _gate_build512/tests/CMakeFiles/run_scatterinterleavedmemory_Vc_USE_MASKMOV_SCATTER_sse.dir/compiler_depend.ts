@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for custom commands dependencies management for run_scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.
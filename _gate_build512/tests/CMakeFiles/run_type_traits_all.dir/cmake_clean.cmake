@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_type_traits_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
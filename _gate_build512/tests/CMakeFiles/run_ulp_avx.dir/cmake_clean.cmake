@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_ulp_avx"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_ulp_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_ulp_scalar"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_ulp_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_utils_avx512"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_utils_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
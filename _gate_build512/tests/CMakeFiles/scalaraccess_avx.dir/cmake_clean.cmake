@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalaraccess_avx.dir/scalaraccess.cpp.o"
+  "CMakeFiles/scalaraccess_avx.dir/scalaraccess.cpp.o.d"
+  "scalaraccess_avx"
+  "scalaraccess_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalaraccess_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalaraccess_avx2.dir/scalaraccess.cpp.o"
+  "CMakeFiles/scalaraccess_avx2.dir/scalaraccess.cpp.o.d"
+  "scalaraccess_avx2"
+  "scalaraccess_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalaraccess_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalaraccess_avx512.dir/scalaraccess.cpp.o"
+  "CMakeFiles/scalaraccess_avx512.dir/scalaraccess.cpp.o.d"
+  "scalaraccess_avx512"
+  "scalaraccess_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalaraccess_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
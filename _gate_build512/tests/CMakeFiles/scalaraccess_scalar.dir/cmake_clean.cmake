@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalaraccess_scalar.dir/scalaraccess.cpp.o"
+  "CMakeFiles/scalaraccess_scalar.dir/scalaraccess.cpp.o.d"
+  "scalaraccess_scalar"
+  "scalaraccess_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalaraccess_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
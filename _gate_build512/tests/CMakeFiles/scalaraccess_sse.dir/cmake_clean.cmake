@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalaraccess_sse.dir/scalaraccess.cpp.o"
+  "CMakeFiles/scalaraccess_sse.dir/scalaraccess.cpp.o.d"
+  "scalaraccess_sse"
+  "scalaraccess_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalaraccess_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.dir/scatter.cpp.o"
+  "CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.dir/scatter.cpp.o.d"
+  "scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx"
+  "scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
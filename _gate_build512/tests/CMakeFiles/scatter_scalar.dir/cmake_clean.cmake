@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatter_scalar.dir/scatter.cpp.o"
+  "CMakeFiles/scatter_scalar.dir/scatter.cpp.o.d"
+  "scatter_scalar"
+  "scatter_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatter_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
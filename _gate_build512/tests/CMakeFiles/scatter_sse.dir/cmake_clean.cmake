@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatter_sse.dir/scatter.cpp.o"
+  "CMakeFiles/scatter_sse.dir/scatter.cpp.o.d"
+  "scatter_sse"
+  "scatter_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatter_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
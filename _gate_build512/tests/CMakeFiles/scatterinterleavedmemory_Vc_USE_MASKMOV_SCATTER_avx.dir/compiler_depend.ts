@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx.
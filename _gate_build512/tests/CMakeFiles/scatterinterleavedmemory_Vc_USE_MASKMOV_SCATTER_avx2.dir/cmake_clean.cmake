@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.dir/scatterinterleavedmemory.cpp.o"
+  "CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.dir/scatterinterleavedmemory.cpp.o.d"
+  "scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2"
+  "scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/scatterinterleavedmemory.cpp.o"
+  "CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/scatterinterleavedmemory.cpp.o.d"
+  "scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse"
+  "scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatterinterleavedmemory_avx2.dir/scatterinterleavedmemory.cpp.o"
+  "CMakeFiles/scatterinterleavedmemory_avx2.dir/scatterinterleavedmemory.cpp.o.d"
+  "scatterinterleavedmemory_avx2"
+  "scatterinterleavedmemory_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatterinterleavedmemory_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatterinterleavedmemory_scalar.dir/scatterinterleavedmemory.cpp.o"
+  "CMakeFiles/scatterinterleavedmemory_scalar.dir/scatterinterleavedmemory.cpp.o.d"
+  "scatterinterleavedmemory_scalar"
+  "scatterinterleavedmemory_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatterinterleavedmemory_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
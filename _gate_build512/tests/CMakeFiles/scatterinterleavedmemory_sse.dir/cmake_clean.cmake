@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scatterinterleavedmemory_sse.dir/scatterinterleavedmemory.cpp.o"
+  "CMakeFiles/scatterinterleavedmemory_sse.dir/scatterinterleavedmemory.cpp.o.d"
+  "scatterinterleavedmemory_sse"
+  "scatterinterleavedmemory_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scatterinterleavedmemory_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
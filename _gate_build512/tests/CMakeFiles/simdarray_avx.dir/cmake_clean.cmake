@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdarray_avx.dir/simdarray.cpp.o"
+  "CMakeFiles/simdarray_avx.dir/simdarray.cpp.o.d"
+  "simdarray_avx"
+  "simdarray_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdarray_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
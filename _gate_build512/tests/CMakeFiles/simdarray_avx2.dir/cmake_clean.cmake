@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdarray_avx2.dir/simdarray.cpp.o"
+  "CMakeFiles/simdarray_avx2.dir/simdarray.cpp.o.d"
+  "simdarray_avx2"
+  "simdarray_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdarray_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdarray_scalar.dir/simdarray.cpp.o"
+  "CMakeFiles/simdarray_scalar.dir/simdarray.cpp.o.d"
+  "simdarray_scalar"
+  "simdarray_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdarray_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
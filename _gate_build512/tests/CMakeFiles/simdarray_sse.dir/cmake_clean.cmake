@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdarray_sse.dir/simdarray.cpp.o"
+  "CMakeFiles/simdarray_sse.dir/simdarray.cpp.o.d"
+  "simdarray_sse"
+  "simdarray_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdarray_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdize_avx.dir/simdize.cpp.o"
+  "CMakeFiles/simdize_avx.dir/simdize.cpp.o.d"
+  "simdize_avx"
+  "simdize_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdize_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdize_avx512.dir/simdize.cpp.o"
+  "CMakeFiles/simdize_avx512.dir/simdize.cpp.o.d"
+  "simdize_avx512"
+  "simdize_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdize_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdize_scalar.dir/simdize.cpp.o"
+  "CMakeFiles/simdize_scalar.dir/simdize.cpp.o.d"
+  "simdize_scalar"
+  "simdize_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdize_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
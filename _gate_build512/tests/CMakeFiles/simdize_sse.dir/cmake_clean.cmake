@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simdize_sse.dir/simdize.cpp.o"
+  "CMakeFiles/simdize_sse.dir/simdize.cpp.o.d"
+  "simdize_sse"
+  "simdize_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simdize_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
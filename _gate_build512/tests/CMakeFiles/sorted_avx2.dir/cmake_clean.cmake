@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sorted_avx2.dir/sorted.cpp.o"
+  "CMakeFiles/sorted_avx2.dir/sorted.cpp.o.d"
+  "sorted_avx2"
+  "sorted_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sorted_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sorted_scalar.dir/sorted.cpp.o"
+  "CMakeFiles/sorted_scalar.dir/sorted.cpp.o.d"
+  "sorted_scalar"
+  "sorted_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sorted_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
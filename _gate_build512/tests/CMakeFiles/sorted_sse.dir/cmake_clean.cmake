@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sorted_sse.dir/sorted.cpp.o"
+  "CMakeFiles/sorted_sse.dir/sorted.cpp.o.d"
+  "sorted_sse"
+  "sorted_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sorted_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sse2_blend.dir/sse_blend.cpp.o"
+  "CMakeFiles/sse2_blend.dir/sse_blend.cpp.o.d"
+  "sse2_blend"
+  "sse2_blend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sse2_blend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
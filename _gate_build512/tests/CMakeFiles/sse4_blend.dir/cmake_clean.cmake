@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sse4_blend.dir/sse_blend.cpp.o"
+  "CMakeFiles/sse4_blend.dir/sse_blend.cpp.o.d"
+  "sse4_blend"
+  "sse4_blend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sse4_blend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
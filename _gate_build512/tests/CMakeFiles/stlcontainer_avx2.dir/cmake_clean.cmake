@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stlcontainer_avx2.dir/stlcontainer.cpp.o"
+  "CMakeFiles/stlcontainer_avx2.dir/stlcontainer.cpp.o.d"
+  "stlcontainer_avx2"
+  "stlcontainer_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stlcontainer_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
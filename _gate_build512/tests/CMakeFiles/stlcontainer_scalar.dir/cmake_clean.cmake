@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stlcontainer_scalar.dir/stlcontainer.cpp.o"
+  "CMakeFiles/stlcontainer_scalar.dir/stlcontainer.cpp.o.d"
+  "stlcontainer_scalar"
+  "stlcontainer_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stlcontainer_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
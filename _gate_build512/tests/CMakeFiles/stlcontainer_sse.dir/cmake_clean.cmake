@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stlcontainer_sse.dir/stlcontainer.cpp.o"
+  "CMakeFiles/stlcontainer_sse.dir/stlcontainer.cpp.o.d"
+  "stlcontainer_sse"
+  "stlcontainer_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stlcontainer_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/store_avx.dir/store.cpp.o"
+  "CMakeFiles/store_avx.dir/store.cpp.o.d"
+  "store_avx"
+  "store_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/store_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/store_avx2.dir/store.cpp.o"
+  "CMakeFiles/store_avx2.dir/store.cpp.o.d"
+  "store_avx2"
+  "store_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/store_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/store_scalar.dir/store.cpp.o"
+  "CMakeFiles/store_scalar.dir/store.cpp.o.d"
+  "store_scalar"
+  "store_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/store_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/store_sse.dir/store.cpp.o"
+  "CMakeFiles/store_sse.dir/store.cpp.o.d"
+  "store_sse"
+  "store_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/store_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscript_avx512.dir/subscript.cpp.o"
+  "CMakeFiles/subscript_avx512.dir/subscript.cpp.o.d"
+  "subscript_avx512"
+  "subscript_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscript_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscript_scalar.dir/subscript.cpp.o"
+  "CMakeFiles/subscript_scalar.dir/subscript.cpp.o.d"
+  "subscript_scalar"
+  "subscript_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscript_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscript_sse.dir/subscript.cpp.o"
+  "CMakeFiles/subscript_sse.dir/subscript.cpp.o.d"
+  "subscript_sse"
+  "subscript_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscript_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trigonometric_avx.dir/trigonometric.cpp.o"
+  "CMakeFiles/trigonometric_avx.dir/trigonometric.cpp.o.d"
+  "trigonometric_avx"
+  "trigonometric_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trigonometric_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trigonometric_avx512.dir/trigonometric.cpp.o"
+  "CMakeFiles/trigonometric_avx512.dir/trigonometric.cpp.o.d"
+  "trigonometric_avx512"
+  "trigonometric_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trigonometric_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trigonometric_scalar.dir/trigonometric.cpp.o"
+  "CMakeFiles/trigonometric_scalar.dir/trigonometric.cpp.o.d"
+  "trigonometric_scalar"
+  "trigonometric_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trigonometric_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
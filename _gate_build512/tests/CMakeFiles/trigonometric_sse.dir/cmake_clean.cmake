@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trigonometric_sse.dir/trigonometric.cpp.o"
+  "CMakeFiles/trigonometric_sse.dir/trigonometric.cpp.o.d"
+  "trigonometric_sse"
+  "trigonometric_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trigonometric_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
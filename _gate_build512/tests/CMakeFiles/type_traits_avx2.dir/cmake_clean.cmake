@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_traits_avx2.dir/type_traits.cpp.o"
+  "CMakeFiles/type_traits_avx2.dir/type_traits.cpp.o.d"
+  "type_traits_avx2"
+  "type_traits_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_traits_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
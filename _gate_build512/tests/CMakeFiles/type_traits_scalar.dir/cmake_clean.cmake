@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_traits_scalar.dir/type_traits.cpp.o"
+  "CMakeFiles/type_traits_scalar.dir/type_traits.cpp.o.d"
+  "type_traits_scalar"
+  "type_traits_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_traits_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
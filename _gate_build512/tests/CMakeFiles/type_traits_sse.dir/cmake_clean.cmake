@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_traits_sse.dir/type_traits.cpp.o"
+  "CMakeFiles/type_traits_sse.dir/type_traits.cpp.o.d"
+  "type_traits_sse"
+  "type_traits_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_traits_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_avx2.dir/types.cpp.o"
+  "CMakeFiles/types_avx2.dir/types.cpp.o.d"
+  "types_avx2"
+  "types_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
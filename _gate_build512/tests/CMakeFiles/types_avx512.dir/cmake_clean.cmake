@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_avx512.dir/types.cpp.o"
+  "CMakeFiles/types_avx512.dir/types.cpp.o.d"
+  "types_avx512"
+  "types_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
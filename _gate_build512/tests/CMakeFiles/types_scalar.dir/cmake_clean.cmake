@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_scalar.dir/types.cpp.o"
+  "CMakeFiles/types_scalar.dir/types.cpp.o.d"
+  "types_scalar"
+  "types_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_sse.dir/types.cpp.o"
+  "CMakeFiles/types_sse.dir/types.cpp.o.d"
+  "types_sse"
+  "types_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ulp_avx.dir/ulp.cpp.o"
+  "CMakeFiles/ulp_avx.dir/ulp.cpp.o.d"
+  "ulp_avx"
+  "ulp_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ulp_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
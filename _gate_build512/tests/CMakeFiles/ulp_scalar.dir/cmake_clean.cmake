@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ulp_scalar.dir/ulp.cpp.o"
+  "CMakeFiles/ulp_scalar.dir/ulp.cpp.o.d"
+  "ulp_scalar"
+  "ulp_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ulp_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ulp_sse.dir/ulp.cpp.o"
+  "CMakeFiles/ulp_sse.dir/ulp.cpp.o.d"
+  "ulp_sse"
+  "ulp_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ulp_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
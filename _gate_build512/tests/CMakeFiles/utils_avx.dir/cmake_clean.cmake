@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_avx.dir/utils.cpp.o"
+  "CMakeFiles/utils_avx.dir/utils.cpp.o.d"
+  "utils_avx"
+  "utils_avx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
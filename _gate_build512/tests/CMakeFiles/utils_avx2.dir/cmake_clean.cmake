@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_avx2.dir/utils.cpp.o"
+  "CMakeFiles/utils_avx2.dir/utils.cpp.o.d"
+  "utils_avx2"
+  "utils_avx2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
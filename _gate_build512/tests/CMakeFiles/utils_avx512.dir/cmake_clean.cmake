@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_avx512.dir/utils.cpp.o"
+  "CMakeFiles/utils_avx512.dir/utils.cpp.o.d"
+  "utils_avx512"
+  "utils_avx512.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_avx512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
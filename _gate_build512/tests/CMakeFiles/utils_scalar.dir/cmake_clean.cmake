@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_scalar.dir/utils.cpp.o"
+  "CMakeFiles/utils_scalar.dir/utils.cpp.o.d"
+  "utils_scalar"
+  "utils_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_sse.dir/utils.cpp.o"
+  "CMakeFiles/utils_sse.dir/utils.cpp.o.d"
+  "utils_sse"
+  "utils_sse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_sse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,360 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_build512/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(types_scalar "/root/repo/_gate_build512/tests/types_scalar")
+set_tests_properties(types_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;200;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_sse "/root/repo/_gate_build512/tests/types_sse")
+set_tests_properties(types_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;200;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_avx "/root/repo/_gate_build512/tests/types_avx")
+set_tests_properties(types_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;200;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_avx2 "/root/repo/_gate_build512/tests/types_avx2")
+set_tests_properties(types_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;200;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_avx512 "/root/repo/_gate_build512/tests/types_avx512")
+set_tests_properties(types_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;200;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscript_scalar "/root/repo/_gate_build512/tests/subscript_scalar")
+set_tests_properties(subscript_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;201;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscript_sse "/root/repo/_gate_build512/tests/subscript_sse")
+set_tests_properties(subscript_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;201;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscript_avx "/root/repo/_gate_build512/tests/subscript_avx")
+set_tests_properties(subscript_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;201;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscript_avx2 "/root/repo/_gate_build512/tests/subscript_avx2")
+set_tests_properties(subscript_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;201;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscript_avx512 "/root/repo/_gate_build512/tests/subscript_avx512")
+set_tests_properties(subscript_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;201;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_traits_scalar "/root/repo/_gate_build512/tests/type_traits_scalar")
+set_tests_properties(type_traits_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;202;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_traits_sse "/root/repo/_gate_build512/tests/type_traits_sse")
+set_tests_properties(type_traits_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;202;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_traits_avx "/root/repo/_gate_build512/tests/type_traits_avx")
+set_tests_properties(type_traits_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;202;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_traits_avx2 "/root/repo/_gate_build512/tests/type_traits_avx2")
+set_tests_properties(type_traits_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;202;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_traits_avx512 "/root/repo/_gate_build512/tests/type_traits_avx512")
+set_tests_properties(type_traits_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;202;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(stlcontainer_scalar "/root/repo/_gate_build512/tests/stlcontainer_scalar")
+set_tests_properties(stlcontainer_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;203;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(stlcontainer_sse "/root/repo/_gate_build512/tests/stlcontainer_sse")
+set_tests_properties(stlcontainer_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;203;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(stlcontainer_avx "/root/repo/_gate_build512/tests/stlcontainer_avx")
+set_tests_properties(stlcontainer_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;203;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(stlcontainer_avx2 "/root/repo/_gate_build512/tests/stlcontainer_avx2")
+set_tests_properties(stlcontainer_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;203;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(stlcontainer_avx512 "/root/repo/_gate_build512/tests/stlcontainer_avx512")
+set_tests_properties(stlcontainer_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;203;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scalaraccess_scalar "/root/repo/_gate_build512/tests/scalaraccess_scalar")
+set_tests_properties(scalaraccess_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;204;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scalaraccess_sse "/root/repo/_gate_build512/tests/scalaraccess_sse")
+set_tests_properties(scalaraccess_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;204;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scalaraccess_avx "/root/repo/_gate_build512/tests/scalaraccess_avx")
+set_tests_properties(scalaraccess_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;204;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scalaraccess_avx2 "/root/repo/_gate_build512/tests/scalaraccess_avx2")
+set_tests_properties(scalaraccess_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;204;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scalaraccess_avx512 "/root/repo/_gate_build512/tests/scalaraccess_avx512")
+set_tests_properties(scalaraccess_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;204;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(memory_scalar "/root/repo/_gate_build512/tests/memory_scalar")
+set_tests_properties(memory_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;205;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(memory_sse "/root/repo/_gate_build512/tests/memory_sse")
+set_tests_properties(memory_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;205;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(memory_avx "/root/repo/_gate_build512/tests/memory_avx")
+set_tests_properties(memory_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;205;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(memory_avx2 "/root/repo/_gate_build512/tests/memory_avx2")
+set_tests_properties(memory_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;205;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(memory_avx512 "/root/repo/_gate_build512/tests/memory_avx512")
+set_tests_properties(memory_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;205;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(arithmetics_scalar "/root/repo/_gate_build512/tests/arithmetics_scalar")
+set_tests_properties(arithmetics_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;206;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(arithmetics_sse "/root/repo/_gate_build512/tests/arithmetics_sse")
+set_tests_properties(arithmetics_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;206;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(arithmetics_avx "/root/repo/_gate_build512/tests/arithmetics_avx")
+set_tests_properties(arithmetics_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;206;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(arithmetics_avx2 "/root/repo/_gate_build512/tests/arithmetics_avx2")
+set_tests_properties(arithmetics_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;206;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(arithmetics_avx512 "/root/repo/_gate_build512/tests/arithmetics_avx512")
+set_tests_properties(arithmetics_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;206;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdize_scalar "/root/repo/_gate_build512/tests/simdize_scalar")
+set_tests_properties(simdize_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;207;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdize_sse "/root/repo/_gate_build512/tests/simdize_sse")
+set_tests_properties(simdize_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;207;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdize_avx "/root/repo/_gate_build512/tests/simdize_avx")
+set_tests_properties(simdize_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;207;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdize_avx2 "/root/repo/_gate_build512/tests/simdize_avx2")
+set_tests_properties(simdize_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;207;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdize_avx512 "/root/repo/_gate_build512/tests/simdize_avx512")
+set_tests_properties(simdize_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;207;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(implicit_type_conversion_scalar "/root/repo/_gate_build512/tests/implicit_type_conversion_scalar")
+set_tests_properties(implicit_type_conversion_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;208;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(implicit_type_conversion_sse "/root/repo/_gate_build512/tests/implicit_type_conversion_sse")
+set_tests_properties(implicit_type_conversion_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;208;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(implicit_type_conversion_avx "/root/repo/_gate_build512/tests/implicit_type_conversion_avx")
+set_tests_properties(implicit_type_conversion_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;208;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(implicit_type_conversion_avx2 "/root/repo/_gate_build512/tests/implicit_type_conversion_avx2")
+set_tests_properties(implicit_type_conversion_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;208;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(implicit_type_conversion_avx512 "/root/repo/_gate_build512/tests/implicit_type_conversion_avx512")
+set_tests_properties(implicit_type_conversion_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;208;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(iterators_scalar "/root/repo/_gate_build512/tests/iterators_scalar")
+set_tests_properties(iterators_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;209;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(iterators_sse "/root/repo/_gate_build512/tests/iterators_sse")
+set_tests_properties(iterators_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;209;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(iterators_avx "/root/repo/_gate_build512/tests/iterators_avx")
+set_tests_properties(iterators_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;209;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(iterators_avx2 "/root/repo/_gate_build512/tests/iterators_avx2")
+set_tests_properties(iterators_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;209;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(iterators_avx512 "/root/repo/_gate_build512/tests/iterators_avx512")
+set_tests_properties(iterators_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;209;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(load_scalar "/root/repo/_gate_build512/tests/load_scalar")
+set_tests_properties(load_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;210;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(load_sse "/root/repo/_gate_build512/tests/load_sse")
+set_tests_properties(load_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;210;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(load_avx "/root/repo/_gate_build512/tests/load_avx")
+set_tests_properties(load_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;210;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(load_avx2 "/root/repo/_gate_build512/tests/load_avx2")
+set_tests_properties(load_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;210;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(load_avx512 "/root/repo/_gate_build512/tests/load_avx512")
+set_tests_properties(load_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;210;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(store_scalar "/root/repo/_gate_build512/tests/store_scalar")
+set_tests_properties(store_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;211;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(store_sse "/root/repo/_gate_build512/tests/store_sse")
+set_tests_properties(store_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;211;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(store_avx "/root/repo/_gate_build512/tests/store_avx")
+set_tests_properties(store_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;211;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(store_avx2 "/root/repo/_gate_build512/tests/store_avx2")
+set_tests_properties(store_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;211;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(store_avx512 "/root/repo/_gate_build512/tests/store_avx512")
+set_tests_properties(store_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;211;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_scalar "/root/repo/_gate_build512/tests/gather_scalar")
+set_tests_properties(gather_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;212;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_sse "/root/repo/_gate_build512/tests/gather_sse")
+set_tests_properties(gather_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;212;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_avx "/root/repo/_gate_build512/tests/gather_avx")
+set_tests_properties(gather_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;212;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_avx2 "/root/repo/_gate_build512/tests/gather_avx2")
+set_tests_properties(gather_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;212;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_avx512 "/root/repo/_gate_build512/tests/gather_avx512")
+set_tests_properties(gather_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;212;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_scalar "/root/repo/_gate_build512/tests/scatter_scalar")
+set_tests_properties(scatter_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;213;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_sse "/root/repo/_gate_build512/tests/scatter_sse")
+set_tests_properties(scatter_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;213;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_avx "/root/repo/_gate_build512/tests/scatter_avx")
+set_tests_properties(scatter_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;213;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_avx2 "/root/repo/_gate_build512/tests/scatter_avx2")
+set_tests_properties(scatter_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;213;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_avx512 "/root/repo/_gate_build512/tests/scatter_avx512")
+set_tests_properties(scatter_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;213;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ulp_scalar "/root/repo/_gate_build512/tests/ulp_scalar")
+set_tests_properties(ulp_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;214;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ulp_sse "/root/repo/_gate_build512/tests/ulp_sse")
+set_tests_properties(ulp_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;214;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ulp_avx "/root/repo/_gate_build512/tests/ulp_avx")
+set_tests_properties(ulp_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;214;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ulp_avx2 "/root/repo/_gate_build512/tests/ulp_avx2")
+set_tests_properties(ulp_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;214;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ulp_avx512 "/root/repo/_gate_build512/tests/ulp_avx512")
+set_tests_properties(ulp_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;214;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logarithm_scalar "/root/repo/_gate_build512/tests/logarithm_scalar")
+set_tests_properties(logarithm_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;215;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logarithm_sse "/root/repo/_gate_build512/tests/logarithm_sse")
+set_tests_properties(logarithm_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;215;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logarithm_avx "/root/repo/_gate_build512/tests/logarithm_avx")
+set_tests_properties(logarithm_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;215;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logarithm_avx2 "/root/repo/_gate_build512/tests/logarithm_avx2")
+set_tests_properties(logarithm_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;215;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logarithm_avx512 "/root/repo/_gate_build512/tests/logarithm_avx512")
+set_tests_properties(logarithm_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;215;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(trigonometric_scalar "/root/repo/_gate_build512/tests/trigonometric_scalar")
+set_tests_properties(trigonometric_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;216;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(trigonometric_sse "/root/repo/_gate_build512/tests/trigonometric_sse")
+set_tests_properties(trigonometric_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;216;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(trigonometric_avx "/root/repo/_gate_build512/tests/trigonometric_avx")
+set_tests_properties(trigonometric_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;216;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(trigonometric_avx2 "/root/repo/_gate_build512/tests/trigonometric_avx2")
+set_tests_properties(trigonometric_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;216;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(trigonometric_avx512 "/root/repo/_gate_build512/tests/trigonometric_avx512")
+set_tests_properties(trigonometric_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;216;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(math_scalar "/root/repo/_gate_build512/tests/math_scalar")
+set_tests_properties(math_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;217;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(math_sse "/root/repo/_gate_build512/tests/math_sse")
+set_tests_properties(math_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;217;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(math_avx "/root/repo/_gate_build512/tests/math_avx")
+set_tests_properties(math_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;217;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(math_avx2 "/root/repo/_gate_build512/tests/math_avx2")
+set_tests_properties(math_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;217;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(math_avx512 "/root/repo/_gate_build512/tests/math_avx512")
+set_tests_properties(math_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;217;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gh200_scalar "/root/repo/_gate_build512/tests/gh200_scalar")
+set_tests_properties(gh200_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;218;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gh200_sse "/root/repo/_gate_build512/tests/gh200_sse")
+set_tests_properties(gh200_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;218;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gh200_avx "/root/repo/_gate_build512/tests/gh200_avx")
+set_tests_properties(gh200_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;218;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gh200_avx2 "/root/repo/_gate_build512/tests/gh200_avx2")
+set_tests_properties(gh200_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;218;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gh200_avx512 "/root/repo/_gate_build512/tests/gh200_avx512")
+set_tests_properties(gh200_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;218;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reductions_scalar "/root/repo/_gate_build512/tests/reductions_scalar")
+set_tests_properties(reductions_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;219;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reductions_sse "/root/repo/_gate_build512/tests/reductions_sse")
+set_tests_properties(reductions_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;219;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reductions_avx "/root/repo/_gate_build512/tests/reductions_avx")
+set_tests_properties(reductions_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;219;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reductions_avx2 "/root/repo/_gate_build512/tests/reductions_avx2")
+set_tests_properties(reductions_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;219;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reductions_avx512 "/root/repo/_gate_build512/tests/reductions_avx512")
+set_tests_properties(reductions_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;219;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mask_scalar "/root/repo/_gate_build512/tests/mask_scalar")
+set_tests_properties(mask_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;220;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mask_sse "/root/repo/_gate_build512/tests/mask_sse")
+set_tests_properties(mask_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;220;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mask_avx "/root/repo/_gate_build512/tests/mask_avx")
+set_tests_properties(mask_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;220;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mask_avx2 "/root/repo/_gate_build512/tests/mask_avx2")
+set_tests_properties(mask_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;220;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mask_avx512 "/root/repo/_gate_build512/tests/mask_avx512")
+set_tests_properties(mask_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;220;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils_scalar "/root/repo/_gate_build512/tests/utils_scalar")
+set_tests_properties(utils_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;221;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils_sse "/root/repo/_gate_build512/tests/utils_sse")
+set_tests_properties(utils_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;221;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils_avx "/root/repo/_gate_build512/tests/utils_avx")
+set_tests_properties(utils_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;221;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils_avx2 "/root/repo/_gate_build512/tests/utils_avx2")
+set_tests_properties(utils_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;221;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils_avx512 "/root/repo/_gate_build512/tests/utils_avx512")
+set_tests_properties(utils_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;221;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sorted_scalar "/root/repo/_gate_build512/tests/sorted_scalar")
+set_tests_properties(sorted_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;222;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sorted_sse "/root/repo/_gate_build512/tests/sorted_sse")
+set_tests_properties(sorted_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;222;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sorted_avx "/root/repo/_gate_build512/tests/sorted_avx")
+set_tests_properties(sorted_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;222;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sorted_avx2 "/root/repo/_gate_build512/tests/sorted_avx2")
+set_tests_properties(sorted_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;222;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sorted_avx512 "/root/repo/_gate_build512/tests/sorted_avx512")
+set_tests_properties(sorted_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;222;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_scalar "/root/repo/_gate_build512/tests/random_scalar")
+set_tests_properties(random_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;223;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_sse "/root/repo/_gate_build512/tests/random_sse")
+set_tests_properties(random_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;223;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_avx "/root/repo/_gate_build512/tests/random_avx")
+set_tests_properties(random_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;223;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_avx2 "/root/repo/_gate_build512/tests/random_avx2")
+set_tests_properties(random_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;223;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_avx512 "/root/repo/_gate_build512/tests/random_avx512")
+set_tests_properties(random_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;223;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(deinterleave_scalar "/root/repo/_gate_build512/tests/deinterleave_scalar")
+set_tests_properties(deinterleave_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;224;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(deinterleave_sse "/root/repo/_gate_build512/tests/deinterleave_sse")
+set_tests_properties(deinterleave_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;224;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(deinterleave_avx "/root/repo/_gate_build512/tests/deinterleave_avx")
+set_tests_properties(deinterleave_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;224;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(deinterleave_avx2 "/root/repo/_gate_build512/tests/deinterleave_avx2")
+set_tests_properties(deinterleave_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;224;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(deinterleave_avx512 "/root/repo/_gate_build512/tests/deinterleave_avx512")
+set_tests_properties(deinterleave_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;224;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gatherinterleavedmemory_scalar "/root/repo/_gate_build512/tests/gatherinterleavedmemory_scalar")
+set_tests_properties(gatherinterleavedmemory_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;225;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gatherinterleavedmemory_sse "/root/repo/_gate_build512/tests/gatherinterleavedmemory_sse")
+set_tests_properties(gatherinterleavedmemory_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;225;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gatherinterleavedmemory_avx "/root/repo/_gate_build512/tests/gatherinterleavedmemory_avx")
+set_tests_properties(gatherinterleavedmemory_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;225;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gatherinterleavedmemory_avx2 "/root/repo/_gate_build512/tests/gatherinterleavedmemory_avx2")
+set_tests_properties(gatherinterleavedmemory_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;225;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gatherinterleavedmemory_avx512 "/root/repo/_gate_build512/tests/gatherinterleavedmemory_avx512")
+set_tests_properties(gatherinterleavedmemory_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;225;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_scalar "/root/repo/_gate_build512/tests/scatterinterleavedmemory_scalar")
+set_tests_properties(scatterinterleavedmemory_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;226;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_sse "/root/repo/_gate_build512/tests/scatterinterleavedmemory_sse")
+set_tests_properties(scatterinterleavedmemory_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;226;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_avx "/root/repo/_gate_build512/tests/scatterinterleavedmemory_avx")
+set_tests_properties(scatterinterleavedmemory_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;226;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_avx2 "/root/repo/_gate_build512/tests/scatterinterleavedmemory_avx2")
+set_tests_properties(scatterinterleavedmemory_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;226;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_avx512 "/root/repo/_gate_build512/tests/scatterinterleavedmemory_avx512")
+set_tests_properties(scatterinterleavedmemory_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;226;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(casts_Vc_DEFAULT_TYPES_scalar "/root/repo/_gate_build512/tests/casts_Vc_DEFAULT_TYPES_scalar")
+set_tests_properties(casts_Vc_DEFAULT_TYPES_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;227;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(casts_Vc_DEFAULT_TYPES_sse "/root/repo/_gate_build512/tests/casts_Vc_DEFAULT_TYPES_sse")
+set_tests_properties(casts_Vc_DEFAULT_TYPES_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;227;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(casts_Vc_DEFAULT_TYPES_avx "/root/repo/_gate_build512/tests/casts_Vc_DEFAULT_TYPES_avx")
+set_tests_properties(casts_Vc_DEFAULT_TYPES_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;227;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(casts_Vc_DEFAULT_TYPES_avx2 "/root/repo/_gate_build512/tests/casts_Vc_DEFAULT_TYPES_avx2")
+set_tests_properties(casts_Vc_DEFAULT_TYPES_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;227;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(casts_Vc_DEFAULT_TYPES_avx512 "/root/repo/_gate_build512/tests/casts_Vc_DEFAULT_TYPES_avx512")
+set_tests_properties(casts_Vc_DEFAULT_TYPES_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;227;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_BSF_GATHERS_sse "/root/repo/_gate_build512/tests/gather_Vc_USE_BSF_GATHERS_sse")
+set_tests_properties(gather_Vc_USE_BSF_GATHERS_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;229;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_BSF_GATHERS_avx "/root/repo/_gate_build512/tests/gather_Vc_USE_BSF_GATHERS_avx")
+set_tests_properties(gather_Vc_USE_BSF_GATHERS_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;229;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_BSF_GATHERS_avx2 "/root/repo/_gate_build512/tests/gather_Vc_USE_BSF_GATHERS_avx2")
+set_tests_properties(gather_Vc_USE_BSF_GATHERS_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;229;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_BSF_GATHERS_avx512 "/root/repo/_gate_build512/tests/gather_Vc_USE_BSF_GATHERS_avx512")
+set_tests_properties(gather_Vc_USE_BSF_GATHERS_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;229;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_POPCNT_BSF_GATHERS_sse "/root/repo/_gate_build512/tests/gather_Vc_USE_POPCNT_BSF_GATHERS_sse")
+set_tests_properties(gather_Vc_USE_POPCNT_BSF_GATHERS_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;230;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_POPCNT_BSF_GATHERS_avx "/root/repo/_gate_build512/tests/gather_Vc_USE_POPCNT_BSF_GATHERS_avx")
+set_tests_properties(gather_Vc_USE_POPCNT_BSF_GATHERS_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;230;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_POPCNT_BSF_GATHERS_avx2 "/root/repo/_gate_build512/tests/gather_Vc_USE_POPCNT_BSF_GATHERS_avx2")
+set_tests_properties(gather_Vc_USE_POPCNT_BSF_GATHERS_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;230;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_POPCNT_BSF_GATHERS_avx512 "/root/repo/_gate_build512/tests/gather_Vc_USE_POPCNT_BSF_GATHERS_avx512")
+set_tests_properties(gather_Vc_USE_POPCNT_BSF_GATHERS_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;230;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_SET_GATHERS_sse "/root/repo/_gate_build512/tests/gather_Vc_USE_SET_GATHERS_sse")
+set_tests_properties(gather_Vc_USE_SET_GATHERS_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;231;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_SET_GATHERS_avx "/root/repo/_gate_build512/tests/gather_Vc_USE_SET_GATHERS_avx")
+set_tests_properties(gather_Vc_USE_SET_GATHERS_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;231;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_SET_GATHERS_avx2 "/root/repo/_gate_build512/tests/gather_Vc_USE_SET_GATHERS_avx2")
+set_tests_properties(gather_Vc_USE_SET_GATHERS_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;231;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(gather_Vc_USE_SET_GATHERS_avx512 "/root/repo/_gate_build512/tests/gather_Vc_USE_SET_GATHERS_avx512")
+set_tests_properties(gather_Vc_USE_SET_GATHERS_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;231;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_BSF_SCATTERS_sse "/root/repo/_gate_build512/tests/scatter_Vc_USE_BSF_SCATTERS_sse")
+set_tests_properties(scatter_Vc_USE_BSF_SCATTERS_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;232;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_BSF_SCATTERS_avx "/root/repo/_gate_build512/tests/scatter_Vc_USE_BSF_SCATTERS_avx")
+set_tests_properties(scatter_Vc_USE_BSF_SCATTERS_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;232;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_BSF_SCATTERS_avx2 "/root/repo/_gate_build512/tests/scatter_Vc_USE_BSF_SCATTERS_avx2")
+set_tests_properties(scatter_Vc_USE_BSF_SCATTERS_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;232;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_BSF_SCATTERS_avx512 "/root/repo/_gate_build512/tests/scatter_Vc_USE_BSF_SCATTERS_avx512")
+set_tests_properties(scatter_Vc_USE_BSF_SCATTERS_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;232;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_POPCNT_BSF_SCATTERS_sse "/root/repo/_gate_build512/tests/scatter_Vc_USE_POPCNT_BSF_SCATTERS_sse")
+set_tests_properties(scatter_Vc_USE_POPCNT_BSF_SCATTERS_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;233;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx "/root/repo/_gate_build512/tests/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx")
+set_tests_properties(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;233;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx2 "/root/repo/_gate_build512/tests/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx2")
+set_tests_properties(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;233;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx512 "/root/repo/_gate_build512/tests/scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx512")
+set_tests_properties(scatter_Vc_USE_POPCNT_BSF_SCATTERS_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;233;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse "/root/repo/_gate_build512/tests/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse")
+set_tests_properties(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;234;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx "/root/repo/_gate_build512/tests/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx")
+set_tests_properties(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;234;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2 "/root/repo/_gate_build512/tests/scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2")
+set_tests_properties(scatterinterleavedmemory_Vc_USE_MASKMOV_SCATTER_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;234;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdarray_scalar "/root/repo/_gate_build512/tests/simdarray_scalar")
+set_tests_properties(simdarray_scalar PROPERTIES  LABELS "Scalar" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;142;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;247;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdarray_sse "/root/repo/_gate_build512/tests/simdarray_sse")
+set_tests_properties(simdarray_sse PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;152;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;247;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdarray_avx "/root/repo/_gate_build512/tests/simdarray_avx")
+set_tests_properties(simdarray_avx PROPERTIES  LABELS "AVX" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;163;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;247;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdarray_avx2 "/root/repo/_gate_build512/tests/simdarray_avx2")
+set_tests_properties(simdarray_avx2 PROPERTIES  LABELS "AVX2" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;174;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;247;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(simdarray_avx512 "/root/repo/_gate_build512/tests/simdarray_avx512")
+set_tests_properties(simdarray_avx512 PROPERTIES  LABELS "AVX512" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;101;add_test;/root/repo/tests/CMakeLists.txt;186;vc_set_test_target_properties;/root/repo/tests/CMakeLists.txt;247;vc_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_abi_SSE "/usr/bin/cmake" "-DASM=abi_SSE.i" "-DIMPL=SSE" "-DCOMPILER_IS_CLANG=false" "-DSYSTEM_NAME=Linux" "-P" "/root/repo/tests/abi.cmake")
+set_tests_properties(test_abi_SSE PROPERTIES  LABELS "SSE" WORKING_DIRECTORY "/root/repo/_gate_build512/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;290;add_test;/root/repo/tests/CMakeLists.txt;309;test_abi;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_abi_SSE_AVX "/usr/bin/cmake" "-DASM=abi_SSE_AVX.i" "-DIMPL=SSE" "-DCOMPILER_IS_CLANG=false" "-DSYSTEM_NAME=Linux" "-P" "/root/repo/tests/abi.cmake")
+set_tests_properties(test_abi_SSE_AVX PROPERTIES  LABELS "SSE" WORKING_DIRECTORY "/root/repo/_gate_build512/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;290;add_test;/root/repo/tests/CMakeLists.txt;310;test_abi;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_abi_AVX "/usr/bin/cmake" "-DASM=abi_AVX.i" "-DIMPL=AVX" "-DCOMPILER_IS_CLANG=false" "-DSYSTEM_NAME=Linux" "-P" "/root/repo/tests/abi.cmake")
+set_tests_properties(test_abi_AVX PROPERTIES  LABELS "AVX" WORKING_DIRECTORY "/root/repo/_gate_build512/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;290;add_test;/root/repo/tests/CMakeLists.txt;312;test_abi;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_abi_AVX2 "/usr/bin/cmake" "-DASM=abi_AVX2.i" "-DIMPL=AVX2" "-DCOMPILER_IS_CLANG=false" "-DSYSTEM_NAME=Linux" "-P" "/root/repo/tests/abi.cmake")
+set_tests_properties(test_abi_AVX2 PROPERTIES  LABELS "AVX2" WORKING_DIRECTORY "/root/repo/_gate_build512/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;290;add_test;/root/repo/tests/CMakeLists.txt;313;test_abi;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sse2_blend "/root/repo/_gate_build512/tests/sse2_blend")
+set_tests_properties(sse2_blend PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;327;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sse4_blend "/root/repo/_gate_build512/tests/sse4_blend")
+set_tests_properties(sse4_blend PROPERTIES  LABELS "SSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;338;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(dispatch "/root/repo/_gate_build512/tests/dispatch")
+set_tests_properties(dispatch PROPERTIES  LABELS "other" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;372;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(alignmentinheritance "/root/repo/_gate_build512/tests/alignmentinheritance")
+set_tests_properties(alignmentinheritance PROPERTIES  LABELS "other" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;352;add_test;/root/repo/tests/CMakeLists.txt;376;vc_add_general_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(alignedbase "/root/repo/_gate_build512/tests/alignedbase")
+set_tests_properties(alignedbase PROPERTIES  LABELS "other" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;352;add_test;/root/repo/tests/CMakeLists.txt;377;vc_add_general_test;/root/repo/tests/CMakeLists.txt;0;")
@@ -0,0 +1,59 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/Vc>
+#include "dispatchkernels.h"
+
+namespace
+{
+unsigned int features()
+{
+    return Vc::Detail::implementation_features(Vc::CurrentImplementation());
+}
+
+void saxpy(float a, const float *x, float *y, std::size_t n)
+{
+    using V = Vc::float_v;
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        V yv(y + i, Vc::Unaligned);
+        yv += a * V(x + i, Vc::Unaligned);
+        yv.store(y + i, Vc::Unaligned);
+    }
+    for (; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+// Vc::simd_sort calls function templates that are not inlined, and each variant has to
+// call its own copy of them
+void sort(float *x, std::size_t n) { Vc::simd_sort(x, x + n); }
+}  // unnamed namespace
+
+Vc_DISPATCH_VARIANT(dispatchkernels::features, features);
+Vc_DISPATCH_VARIANT(dispatchkernels::saxpy, saxpy);
+Vc_DISPATCH_VARIANT(dispatchkernels::sort, sort);
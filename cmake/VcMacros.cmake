@@ -387,7 +387,7 @@ macro(_vc_compile_one_implementation _srcs _impl)
       endif()
       list(REMOVE_AT _disabled_targets ${_disabled_index})
       # skip the rest and return
-   elseif(NOT _only_targets OR ${_only_index} GREATER -1)
+   elseif(NOT _vc_compile_only OR ${_only_index} GREATER -1)
       if(${_only_index} GREATER -1)
          list(REMOVE_AT _only_targets ${_only_index})
       endif()
@@ -444,6 +444,8 @@ endmacro()
 # Example:
 #   vc_compile_for_all_implementations(_objs src/trigonometric.cpp FLAGS -DCOMPILE_BLAH EXCLUDE Scalar)
 #   add_executable(executable main.cpp ${_objs})
+# Together with Vc::Dispatcher (Vc/dispatch) this builds kernels for runtime ISA dispatch:
+#   vc_compile_for_all_implementations(_objs kernels.cpp ONLY SSE2 SSE4_2 AVX AVX2+FMA+BMI2)
 macro(vc_compile_for_all_implementations _srcs _src)
    set(_flags)
    unset(_disabled_targets)
@@ -468,6 +470,8 @@ macro(vc_compile_for_all_implementations _srcs _src)
    endforeach()
 
    set(_vc_compile_src "${_src}")
+   # found entries are removed from _only_targets, so remember whether there was a list
+   list(LENGTH _only_targets _vc_compile_only)
 
    _vc_compile_one_implementation(${_srcs} Scalar NO_FLAG)
    if(NOT Vc_SSE_INTRINSICS_BROKEN)
@@ -497,6 +501,8 @@ macro(vc_compile_for_all_implementations _srcs _src)
       #_vc_compile_one_implementation(${_srcs} AVX2+BMI2 "-mavx2 -mbmi2")
       _vc_compile_one_implementation(${_srcs} AVX2+FMA+BMI2 "-xCORE-AVX2" "-mavx2 -mfma -mbmi2" "/arch:AVX2")
       #_vc_compile_one_implementation(${_srcs} AVX2+FMA "-mavx2 -mfma")
+      _vc_compile_one_implementation(${_srcs} AVX512+FMA+BMI2 "-xCORE-AVX512"
+         "-mavx2 -mfma -mbmi2 -mavx512f -mavx512vl -mavx512dq -mavx512bw -mavx512cd")
    endif()
    list(LENGTH _only_targets _len)
    if(_len GREATER 0)
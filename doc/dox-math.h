@@ -69,8 +69,9 @@ VECTOR_TYPE round(const VECTOR_TYPE &v);
  *
  * \note The single-precision implementation has an error of max. 1 ulp (mean 0.020 ulp) in the range ]0, 1000] (including denormals).
  * \note The double-precision implementation has an error of max. 1 ulp (mean 0.020 ulp) in the range ]0, 1000] (including denormals).
+ * \note Vc::Precision::Fast uses a shorter polynomial for float (max. 1.2 ulp) and returns -inf for denormals.
  */
-VECTOR_TYPE log(const VECTOR_TYPE &v);
+VECTOR_TYPE log(const VECTOR_TYPE &v, Tag tag = Precision::Default);
 
 /**
  * \ingroup Math
@@ -80,8 +81,9 @@ VECTOR_TYPE log(const VECTOR_TYPE &v);
  *
  * \note The single-precision implementation has an error of max. 1 ulp (mean 0.016 ulp) in the range ]0, 1000] (including denormals).
  * \note The double-precision implementation has an error of max. 1 ulp (mean 0.016 ulp) in the range ]0, 1000] (including denormals).
+ * \note Vc::Precision::Fast uses a shorter polynomial for float (max. 2.1 ulp) and returns -inf for denormals.
  */
-VECTOR_TYPE log2(const VECTOR_TYPE &v);
+VECTOR_TYPE log2(const VECTOR_TYPE &v, Tag tag = Precision::Default);
 
 /**
  * \ingroup Math
@@ -91,16 +93,146 @@ VECTOR_TYPE log2(const VECTOR_TYPE &v);
  *
  * \note The single-precision implementation has an error of max. 2 ulp (mean 0.31 ulp) in the range ]0, 1000] (including denormals).
  * \note The double-precision implementation has an error of max. 2 ulp (mean 0.26 ulp) in the range ]0, 1000] (including denormals).
+ * \note Vc::Precision::Fast uses a shorter polynomial for float (max. 2.5 ulp) and returns -inf for denormals.
  */
-VECTOR_TYPE log10(const VECTOR_TYPE &v);
+VECTOR_TYPE log10(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the function on.
+ * \returns \f$\ln(1 + v)\f$, without the cancellation of `log(1 + v)` for \p v close to 0.
+ *
+ * \note The single-precision implementation has an error of max. 1.4 ulp (mean 0.28 ulp), the double-precision implementation max. 1.3 ulp (mean 0.28 ulp).
+ */
+VECTOR_TYPE log1p(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param x The base.
+ * \param y The exponent.
+ * \returns \p x to the power of \p y, including the special cases of C99 Annex F.
+ *
+ * \note The single-precision implementation is evaluated in double precision and rounds correctly in almost all cases (max. 0.5 ulp measured). The double-precision implementation computes \f$y\cdot\ln|x|\f$ with a double-double logarithm and has an error of max. 1.2 ulp (mean 0.27 ulp), also for results far from 1.
+ */
+VECTOR_TYPE pow(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the cube root on.
+ * \returns the real cube root of \p v, which is negative for negative \p v.
+ *
+ * \note The implementation has an error of max. 0.73 ulp (mean 0.26 ulp) over the whole range, including denormals.
+ */
+VECTOR_TYPE cbrt(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \returns \f$\sqrt{x^2 + y^2}\f$ without intermediate overflow or underflow. If either
+ * argument is infinite, the result is +inf, even if the other one is NaN.
+ *
+ * \note The implementation has an error of max. 1.2 ulp (mean 0.29 ulp).
+ */
+VECTOR_TYPE hypot(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the hyperbolic tangent on.
+ * \param tag Vc::Precision::Fast, Vc::Precision::Default, or Vc::Precision::Accurate. The
+ * default implementation is the accurate one.
+ * \returns \f$\tanh(v)\f$.
+ *
+ * \note Fast: max. 5.3 ulp (mean 0.50 ulp) for float, which uses a single rational approximation, and max. 2.6 ulp (mean 0.28 ulp) for double.
+ * Accurate: the single-precision implementation is evaluated in double precision and rounds correctly in almost all cases, the double-precision implementation has an error of max. 1.3 ulp (mean 0.20 ulp).
+ */
+VECTOR_TYPE tanh(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the logistic function on.
+ * \param tag Vc::Precision::Fast, Vc::Precision::Default, or Vc::Precision::Accurate. The
+ * default implementation is the accurate one.
+ * \returns \f$\frac{1}{1 + e^{-v}}\f$.
+ *
+ * \note Fast: max. 2.3 ulp, but results below the normal range are flushed to 0.
+ * Accurate: float rounds correctly in almost all cases, double has an error of max. 2.3 ulp (mean 0.21 ulp), down to the denormals.
+ */
+VECTOR_TYPE sigmoid(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the error function on.
+ * \param tag Vc::Precision::Fast, Vc::Precision::Default, or Vc::Precision::Accurate. The
+ * default implementation is the accurate one.
+ * \returns \f$\mathrm{erf}(v) = \frac{2}{\sqrt\pi}\int_0^v e^{-t^2}dt\f$.
+ *
+ * \note Fast: max. 5.9 ulp (mean 0.65 ulp) for float, which uses a single rational approximation, and max. 1.5 ulp (mean 0.25 ulp) for double.
+ * Accurate: float rounds correctly in almost all cases, double has an error of max. 1.5 ulp (mean 0.25 ulp).
+ */
+VECTOR_TYPE erf(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the complementary error function on.
+ * \param tag Vc::Precision::Fast, Vc::Precision::Default, or Vc::Precision::Accurate. The
+ * default implementation is the accurate one.
+ * \returns \f$\mathrm{erfc}(v) = 1 - \mathrm{erf}(v)\f$, without the cancellation for large \p v.
+ *
+ * \note Fast: max. 5.8 ulp (mean 0.58 ulp) for float and max. 6.6 ulp (mean 0.61 ulp) for double.
+ * Accurate: float rounds correctly in almost all cases, double has an error of max. 3.0 ulp (mean 0.42 ulp).
+ * The bounds hold for normal results.
+ */
+VECTOR_TYPE erfc(const VECTOR_TYPE &v, Tag tag = Precision::Default);
 
 /**
  * \ingroup Math
  *
  * \param v The values to apply the exponential function on.
  * \returns the exponential of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.27 ulp) over the whole range, the double-precision implementation max. 1.1 ulp (mean 0.27 ulp). Results that are subnormal are rounded correctly within 1 ulp.
+ * \note Vc::Precision::Fast uses shorter polynomials and has an error of max. 2.3 ulp for float and max. 3.1 ulp for double. Results below 2⁻¹²⁵ (float) and 2⁻¹⁰²¹ (double) are flushed to 0.
+ */
+VECTOR_TYPE exp(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the base-2 exponential function on.
+ * \returns 2 to the power of \p v. Integral \p v yield exact results.
+ *
+ * \note The single-precision implementation has an error of max. 1.2 ulp (mean 0.27 ulp), the double-precision implementation max. 1.5 ulp (mean 0.28 ulp).
+ * \note Vc::Precision::Fast uses the polynomials of the fast exp: max. 2.3 ulp for float and max. 3.1 ulp for double, with the same range.
+ */
+VECTOR_TYPE exp2(const VECTOR_TYPE &v, Tag tag = Precision::Default);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the function on.
+ * \returns \f$e^v - 1\f$, without the cancellation of `exp(v) - 1` for \p v close to 0.
+ *
+ * \note The single-precision implementation has an error of max. 1.6 ulp (mean 0.27 ulp), the double-precision implementation max. 2 ulp (mean 0.29 ulp).
+ */
+VECTOR_TYPE expm1(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the base-10 exponential function on.
+ * \returns 10 to the power of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.3 ulp (mean 0.27 ulp), the double-precision implementation max. 1.7 ulp (mean 0.29 ulp).
+ * \note Vc::Precision::Fast uses the polynomials of the fast exp: max. 2.4 ulp for float and max. 3.2 ulp for double, with the same range.
  */
-VECTOR_TYPE exp(const VECTOR_TYPE &v);
+VECTOR_TYPE exp10(const VECTOR_TYPE &v, Tag tag = Precision::Default);
 
 /**
  * \ingroup Math
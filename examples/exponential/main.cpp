@@ -0,0 +1,204 @@
+/*{{{
+    Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+// Throughput of Vc::exp, exp2, expm1 and exp10 in cycles per element, compared to a
+// scalar loop over the <cmath> functions and, when available, to the vector variants of
+// glibc's libmvec for the same register width.
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+using Vc::float_v;
+using Vc::double_v;
+
+// libmvec {{{1
+#ifdef HAVE_LIBMVEC_EXP
+#if defined Vc_IMPL_AVX2
+#define Vc_MVEC_ISA d
+#elif defined Vc_IMPL_AVX
+#define Vc_MVEC_ISA c
+#elif defined Vc_IMPL_SSE2
+#define Vc_MVEC_ISA b
+#endif
+#endif
+
+#ifdef Vc_MVEC_ISA
+#define Vc_MVEC_NAME_(isa_, n_, fun_) _ZGV##isa_##N##n_##v_##fun_
+#define Vc_MVEC_NAME(isa_, n_, fun_) Vc_MVEC_NAME_(isa_, n_, fun_)
+#define Vc_MVEC(fun_, float_size_, double_size_)                                         \
+    extern "C" float_v::VectorType Vc_MVEC_NAME(Vc_MVEC_ISA, float_size_, fun_##f)(     \
+        float_v::VectorType);                                                            \
+    extern "C" double_v::VectorType Vc_MVEC_NAME(Vc_MVEC_ISA, double_size_, fun_)(      \
+        double_v::VectorType);                                                           \
+    struct mvec_##fun_ {                                                                 \
+        float_v operator()(float_v x) const                                              \
+        {                                                                                \
+            return Vc_MVEC_NAME(Vc_MVEC_ISA, float_size_, fun_##f)(x.data());            \
+        }                                                                                \
+        double_v operator()(double_v x) const                                            \
+        {                                                                                \
+            return Vc_MVEC_NAME(Vc_MVEC_ISA, double_size_, fun_)(x.data());              \
+        }                                                                                \
+    }
+#if defined Vc_IMPL_AVX
+Vc_MVEC(exp, 8, 4);
+Vc_MVEC(exp2, 8, 4);
+Vc_MVEC(expm1, 8, 4);
+Vc_MVEC(exp10, 8, 4);
+#else
+Vc_MVEC(exp, 4, 2);
+Vc_MVEC(exp2, 4, 2);
+Vc_MVEC(expm1, 4, 2);
+Vc_MVEC(exp10, 4, 2);
+#endif
+#undef Vc_MVEC
+#else   // Vc_MVEC_ISA
+struct mvec_exp {};
+struct mvec_exp2 {};
+struct mvec_expm1 {};
+struct mvec_exp10 {};
+#endif  // Vc_MVEC_ISA
+
+// the functions {{{1
+struct Exp {
+    static const char *name() { return "exp"; }
+    template <class T> static T range() { return std::is_same<T, float>::value ? 80 : 700; }
+    template <class V> V operator()(V x) const { return Vc::exp(x); }
+    float operator()(float x) const { return std::exp(x); }
+    double operator()(double x) const { return std::exp(x); }
+    using mvec = mvec_exp;
+};
+struct Exp2 {
+    static const char *name() { return "exp2"; }
+    template <class T> static T range() { return std::is_same<T, float>::value ? 120 : 1000; }
+    template <class V> V operator()(V x) const { return Vc::exp2(x); }
+    float operator()(float x) const { return std::exp2(x); }
+    double operator()(double x) const { return std::exp2(x); }
+    using mvec = mvec_exp2;
+};
+struct Expm1 {
+    static const char *name() { return "expm1"; }
+    template <class T> static T range() { return std::is_same<T, float>::value ? 15 : 35; }
+    template <class V> V operator()(V x) const { return Vc::expm1(x); }
+    float operator()(float x) const { return std::expm1(x); }
+    double operator()(double x) const { return std::expm1(x); }
+    using mvec = mvec_expm1;
+};
+struct Exp10 {
+    static const char *name() { return "exp10"; }
+    template <class T> static T range() { return std::is_same<T, float>::value ? 35 : 300; }
+    template <class V> V operator()(V x) const { return Vc::exp10(x); }
+    float operator()(float x) const { return std::pow(10.f, x); }
+    double operator()(double x) const { return std::pow(10., x); }
+    using mvec = mvec_exp10;
+};
+
+// benchmark {{{1
+constexpr std::size_t N = 4096;
+constexpr int Repetitions = 1000;
+
+template <class T> using Array = std::vector<T, Vc::Allocator<T>>;
+
+// returns the minimum over all repetitions, which filters interrupts and frequency ramps
+template <class F> double cyclesPerElement(F &&f)
+{
+    TimeStampCounter tsc;
+    unsigned long long best = ~0ull;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        f();
+        tsc.stop();
+        best = std::min(best, tsc.cycles());
+    }
+    return double(best) / N;
+}
+
+template <class V, class F> void benchmarkVector(const F &fun, const Array<typename V::EntryType> &in, Array<typename V::EntryType> &out)
+{
+    std::cout << std::setw(10) << cyclesPerElement([&]() {
+        for (std::size_t i = 0; i < N; i += V::Size) {
+            fun(V(&in[i], Vc::Aligned)).store(&out[i], Vc::Aligned);
+        }
+        asm volatile("" ::"m"(out[0]));
+    });
+}
+
+template <class V, class Fun>
+void benchmarkMvec(const Array<typename V::EntryType> &in, Array<typename V::EntryType> &out,
+                   decltype(std::declval<typename Fun::mvec>()(V())) * = nullptr)
+{
+    benchmarkVector<V>(typename Fun::mvec(), in, out);
+}
+template <class V, class Fun>
+void benchmarkMvec(const Array<typename V::EntryType> &, Array<typename V::EntryType> &, ...)
+{
+    std::cout << std::setw(10) << "-";
+}
+
+template <class V, class Fun> void benchmark()
+{
+    using T = typename V::EntryType;
+    Array<T> in(N), out(N);
+    std::default_random_engine rne;
+    std::uniform_real_distribution<T> dist(-Fun::template range<T>(), Fun::template range<T>());
+    for (T &x : in) {
+        x = dist(rne);
+    }
+
+    const Fun fun{};
+    std::cout << std::setw(8) << Fun::name() << std::setw(8)
+              << (std::is_same<T, float>::value ? "float" : "double");
+    std::cout << std::setw(10) << cyclesPerElement([&]() {
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = fun(in[i]);
+        }
+        asm volatile("" ::"m"(out[0]));
+    });
+    benchmarkVector<V>(fun, in, out);
+    benchmarkMvec<V, Fun>(in, out, nullptr);
+    std::cout << '\n';
+}
+
+int Vc_CDECL main()  //{{{1
+{
+    std::cout << "cycles per element, float_v::size() = " << float_v::size() << ":\n";
+    std::cout << std::setw(8) << "function" << std::setw(8) << "type" << std::setw(10)
+              << "std" << std::setw(10) << "Vc" << std::setw(10) << "libmvec" << '\n';
+    std::cout << std::setprecision(3);
+    benchmark<float_v, Exp>();
+    benchmark<double_v, Exp>();
+    benchmark<float_v, Exp2>();
+    benchmark<double_v, Exp2>();
+    benchmark<float_v, Expm1>();
+    benchmark<double_v, Expm1>();
+    benchmark<float_v, Exp10>();
+    benchmark<double_v, Exp10>();
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,147 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <Vc/Vc>
+#include "../tsc.h"
+
+using Vc::float_v;
+
+/*
+ * This example shows how Vc::parallel_simd_for_each scales with the number of threads,
+ * depending on working-set size and FLOPs per load/store. It is the multi-threaded
+ * counterpart of the scaling example: memory-bound workloads (few FLOPs per element,
+ * large working sets) stop scaling once the memory bandwidth is saturated, while
+ * compute-bound workloads scale with the number of cores.
+ */
+
+/*
+ * The Flops helper struct generates code that executes FLOPs many floating-point SIMD
+ * instructions (add, sub, and mul). It is the same as in the scaling example.
+ */
+template <int FLOPs> struct Flops
+{
+    inline float_v operator()(float_v a, float_v b, float_v c)
+    {
+        typedef Flops<(FLOPs - 5) / 2> F1;
+        typedef Flops<(FLOPs - 4) / 2> F2;
+        return F1()(a + b, a * b, c) + F2()(a * c, b + c, a);
+    }
+};
+
+template <> inline float_v Flops<2>::operator()(float_v a, float_v b, float_v c)
+{
+    return a * b + c;
+}
+template <> inline float_v Flops<3>::operator()(float_v a, float_v b, float_v c)
+{
+    return a * b + (c - a);
+}
+template <> inline float_v Flops<4>::operator()(float_v a, float_v b, float_v c)
+{
+    return (a * b + c) + a * c;
+}
+template <> inline float_v Flops<5>::operator()(float_v a, float_v b, float_v c)
+{
+    return a * b + (a + c) + a * c;
+}
+template <> inline float_v Flops<6>::operator()(float_v a, float_v b, float_v c)
+{
+    return (a * b + (a + c)) + (a * c - b);
+}
+template <> inline float_v Flops<7>::operator()(float_v a, float_v b, float_v c)
+{
+    return (a * b + (a + c)) + (a * c - (b + c));
+}
+template <> inline float_v Flops<8>::operator()(float_v a, float_v b, float_v c)
+{
+    return (a * b + (a + c) + b) + (a * c - (b + c));
+}
+
+template <int FLOPs> struct Kernel
+{
+    // AlignedMasked calls the kernel with full float_v objects only; the mask is ignored
+    // since inactive entries are never stored.
+    void operator()(float_v &x, float_v::mask_type) const
+    {
+        x = Flops<FLOPs>()(x, x + 1.f, x * 0.5f);
+    }
+};
+
+/*
+ * Runs the kernel over N floats with every thread count from 1 to the number of hardware
+ * threads and prints the throughput and the speedup relative to one thread.
+ */
+template <int FLOPs> void scaleThreads(std::size_t bytes)
+{
+    const std::size_t N = bytes / sizeof(float);
+    std::vector<float, Vc::Allocator<float>> data(N, 1.f);
+    const std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    double singleThreaded = 0.;
+    for (std::size_t threads = 1; threads <= maxThreads; ++threads) {
+        Vc::ThreadPool pool(threads);
+        TimeStampCounter tsc;
+        double throughput = 0.;
+        const int repetitions = std::max<int>(3, (64 << 20) / bytes);
+        for (int i = 0; i < repetitions; ++i) {
+            std::fill(data.begin(), data.end(), 1.f);
+            tsc.start();
+            // ------------- start of the benchmarked code ---------------
+            Vc::parallel_simd_for_each(pool, Vc::AlignedMasked, data.begin(), data.end(),
+                                       Kernel<FLOPs>());
+            // -------------- end of the benchmarked code ----------------
+            tsc.stop();
+            throughput =
+                std::max(throughput, (N * FLOPs) / static_cast<double>(tsc.cycles()));
+        }
+        if (threads == 1) {
+            singleThreaded = throughput;
+        }
+        printf("%11lu Byte | %4d FLOP/element | %3lu threads | %6.2f FLOP/cycle | "
+               "%5.2fx\n",
+               static_cast<unsigned long>(bytes), FLOPs,
+               static_cast<unsigned long>(threads), throughput,
+               throughput / singleThreaded);
+    }
+}
+
+int Vc_CDECL main()
+{
+    printf("%16s | %17s | %11s | %17s | %s\n", "Working-Set Size", "FLOPs per element",
+           "Threads", "Throughput", "Speedup");
+    for (std::size_t bytes = 256 * 1024; bytes <= 256 * 1024 * 1024; bytes *= 4) {
+        scaleThreads<2>(bytes);
+        scaleThreads<19>(bytes);
+        scaleThreads<94>(bytes);
+    }
+    return 0;
+}
@@ -35,7 +35,8 @@ namespace Detail
 {
 #ifdef Vc_IMPL_AVX2
 template <>
-Vc_CONST AVX2::short_v sorted<CurrentImplementation::current()>(AVX2::short_v x_)
+Vc_CONST AVX2::short_v::VectorType sorted<CurrentImplementation::current(), short>(
+    AVX2::short_v::VectorType x_)
 {
     // ab cd ef gh ij kl mn op
     // ↓↑ ↓↑ ↓↑ ↓↑ ↓↑ ↓↑ ↓↑ ↓↑
@@ -69,8 +70,8 @@ Vc_CONST AVX2::short_v sorted<CurrentImplementation::current()>(AVX2::short_v x_
     // 01 23 01 23 01 23 01 23
 
     // sort pairs (one min/max)
-    auto x = AVX::lo128(x_.data());
-    auto y = AVX::hi128(x_.data());
+    auto x = AVX::lo128(x_);
+    auto y = AVX::hi128(x_);
     Vc_DEBUG << "xy: " << AVX::addType<short>(x) << AVX::addType<short>(y);
     auto l = _mm_min_epi16(x, y);
     auto h = _mm_max_epi16(x, y);
@@ -142,11 +143,12 @@ Vc_CONST AVX2::short_v sorted<CurrentImplementation::current()>(AVX2::short_v x_
 }
 
 template <>
-Vc_CONST AVX2::ushort_v sorted<CurrentImplementation::current()>(AVX2::ushort_v x_)
+Vc_CONST AVX2::ushort_v::VectorType sorted<CurrentImplementation::current(), ushort>(
+    AVX2::ushort_v::VectorType x_)
 {
     // sort pairs (one min/max)
-    auto x = AVX::lo128(x_.data());
-    auto y = AVX::hi128(x_.data());
+    auto x = AVX::lo128(x_);
+    auto y = AVX::hi128(x_);
     Vc_DEBUG << "xy: " << AVX::addType<short>(x) << AVX::addType<short>(y);
     auto l = _mm_min_epu16(x, y);
     auto h = _mm_max_epu16(x, y);
@@ -217,10 +219,12 @@ Vc_CONST AVX2::ushort_v sorted<CurrentImplementation::current()>(AVX2::ushort_v
     return AVX::concat(x, y);
 }
 
-template <> Vc_CONST AVX2::int_v sorted<CurrentImplementation::current()>(AVX2::int_v x_)
+template <>
+Vc_CONST AVX2::int_v::VectorType sorted<CurrentImplementation::current(), int>(
+    AVX2::int_v::VectorType x_)
 {
     using namespace AVX;
-    const __m256i hgfedcba = x_.data();
+    const __m256i hgfedcba = x_;
     const __m128i hgfe = hi128(hgfedcba);
     const __m128i dcba = lo128(hgfedcba);
     __m128i l = _mm_min_epi32(hgfe, dcba); // ↓hd ↓gc ↓fb ↓ea
@@ -263,10 +267,11 @@ template <> Vc_CONST AVX2::int_v sorted<CurrentImplementation::current()>(AVX2::
 }
 
 template <>
-Vc_CONST AVX2::uint_v sorted<CurrentImplementation::current()>(AVX2::uint_v x_)
+Vc_CONST AVX2::uint_v::VectorType sorted<CurrentImplementation::current(), uint>(
+    AVX2::uint_v::VectorType x_)
 {
     using namespace AVX;
-    const __m256i hgfedcba = x_.data();
+    const __m256i hgfedcba = x_;
     const __m128i hgfe = hi128(hgfedcba);
     const __m128i dcba = lo128(hgfedcba);
     __m128i l = _mm_min_epu32(hgfe, dcba); // ↓hd ↓gc ↓fb ↓ea
@@ -309,9 +314,10 @@ Vc_CONST AVX2::uint_v sorted<CurrentImplementation::current()>(AVX2::uint_v x_)
 #endif  // AVX2
 
 template <>
-Vc_CONST AVX2::float_v sorted<CurrentImplementation::current()>(AVX2::float_v x_)
+Vc_CONST AVX2::float_v::VectorType sorted<CurrentImplementation::current(), float>(
+    AVX2::float_v::VectorType x_)
 {
-    __m256 hgfedcba = x_.data();
+    __m256 hgfedcba = x_;
     const __m128 hgfe = AVX::hi128(hgfedcba);
     const __m128 dcba = AVX::lo128(hgfedcba);
     __m128 l = _mm_min_ps(hgfe, dcba); // ↓hd ↓gc ↓fb ↓ea
@@ -384,9 +390,10 @@ template<> void SortHelper<double>::sort(__m256d &Vc_RESTRICT x, __m256d &Vc_RES
 }
 #endif
 template <>
-Vc_CONST AVX2::double_v sorted<CurrentImplementation::current()>(AVX2::double_v x_)
+Vc_CONST AVX2::double_v::VectorType sorted<CurrentImplementation::current(), double>(
+    AVX2::double_v::VectorType x_)
 {
-    __m256d dcba = x_.data();
+    __m256d dcba = x_;
     /*
      * to find the second largest number find
      * max(min(max(ab),max(cd)), min(max(ad),max(bc)))
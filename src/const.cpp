@@ -229,6 +229,121 @@ namespace AVX
       , 0x3ede5bd9u // log10(e)
       , 0x3fb8aa3bu // log2(e)
     };
+
+    template <>
+    alignas(64) const float c_tanh<float>::data[] = {
+        1.342163181e-08f, // tanh P
+        2.066251909e-05f, // tanh P
+        3.499055048e-03f, // tanh P
+        1.338401884e-01f, // tanh P
+        1.f, // tanh P
+        7.805477935e-07f, // tanh Q
+        3.291150497e-04f, // tanh Q
+        2.589039877e-02f, // tanh Q
+        4.671733975e-01f, // tanh Q
+        1.f, // tanh Q
+    };
+
+    template <>
+    alignas(64) const double c_tanh<double>::data[] = {
+        -1.60715616512387374e-05, // tanh R, |x| < 0.625
+        7.71421070317254975e-05, // tanh R, |x| < 0.625
+        -2.28562020017644522e-04, // tanh R, |x| < 0.625
+        5.86315337612386953e-04, // tanh R, |x| < 0.625
+        -1.45495846743391374e-03, // tanh R, |x| < 0.625
+        3.59198908370588063e-03, // tanh R, |x| < 0.625
+        -8.86322098993501048e-03, // tanh R, |x| < 0.625
+        2.18694875749835746e-02, // tanh R, |x| < 0.625
+        -5.39682539312116433e-02, // tanh R, |x| < 0.625
+        1.33333333332619514e-01, // tanh R, |x| < 0.625
+        -3.33333333333328541e-01, // tanh R, |x| < 0.625
+    };
+
+    template <>
+    alignas(64) const float c_erf<float>::data[] = {
+        1.995788125e-06f, // erf P
+        2.828003780e-04f, // erf P
+        3.811376402e-03f, // erf P
+        5.286781490e-02f, // erf P
+        1.918899864e-01f, // erf P
+        1.128379107e+00f, // erf P
+        3.742477929e-05f, // erf Q
+        1.168090501e-03f, // erf Q
+        1.505904552e-02f, // erf Q
+        1.146533936e-01f, // erf Q
+        5.033905506e-01f, // erf Q
+        1.f, // erf Q
+        3.256925941e-02f, // erfc P
+        2.281940877e-01f, // erfc P
+        7.295156121e-01f, // erfc P
+        1.236485481e+00f, // erfc P
+        1.f, // erfc P
+        5.772679299e-02f, // erfc Q
+        4.044905007e-01f, // erfc Q
+        1.321457148e+00f, // erfc Q
+        2.397972107e+00f, // erfc Q
+        2.364865065e+00f, // erfc Q
+        1.f, // erfc Q
+    };
+
+    template <>
+    alignas(64) const double c_erf<double>::data[] = {
+        1.46991407896798643e-06, // erf P, |x| < 0.5
+        -1.48429805784309260e-05, // erf P, |x| < 0.5
+        1.20532083445031352e-04, // erf P, |x| < 0.5
+        -8.54829478177198451e-04, // erf P, |x| < 0.5
+        5.22397733337594261e-03, // erf P, |x| < 0.5
+        -2.68661706298921506e-02, // erf P, |x| < 0.5
+        1.12837916709133804e-01, // erf P, |x| < 0.5
+        -3.76126389031832598e-01, // erf P, |x| < 0.5
+        1.12837916709551256e+00, // erf P, |x| < 0.5
+        6.22652842528885486e-05, // erfc P (fast)
+        1.18524098126750860e-03, // erfc P (fast)
+        1.10441653942548890e-02, // erfc P (fast)
+        6.51750353599273441e-02, // erfc P (fast)
+        2.66422377671230282e-01, // erfc P (fast)
+        7.79684420696332703e-01, // erfc P (fast)
+        1.63373451724458252e+00, // erfc P (fast)
+        2.37326717535960841e+00, // erfc P (fast)
+        2.19026643310190927e+00, // erfc P (fast)
+        1., // erfc P (fast)
+        1.10362342852103720e-04, // erfc Q (fast)
+        2.10078494144841236e-03, // erfc Q (fast)
+        1.96304546578094929e-02, // erfc Q (fast)
+        1.16570134746955240e-01, // erfc Q (fast)
+        4.81953828334055090e-01, // erfc Q (fast)
+        1.43866406489213872e+00, // erfc Q (fast)
+        3.12218103278125891e+00, // erfc Q (fast)
+        4.84233857976644622e+00, // erfc Q (fast)
+        5.11795773359605377e+00, // erfc Q (fast)
+        3.31864560019741273e+00, // erfc Q (fast)
+        1., // erfc Q (fast)
+        4.99893760551679899e-06, // erfc P, x ≥ 0.5
+        1.16237484976143858e-04, // erfc P, x ≥ 0.5
+        1.35159038701821756e-03, // erfc P, x ≥ 0.5
+        1.01987939839740544e-02, // erfc P, x ≥ 0.5
+        5.49651893356032858e-02, // erfc P, x ≥ 0.5
+        2.20884388901126300e-01, // erfc P, x ≥ 0.5
+        6.73268996179187229e-01, // erfc P, x ≥ 0.5
+        1.55499138593499175e+00, // erfc P, x ≥ 0.5
+        2.67011349609090232e+00, // erfc P, x ≥ 0.5
+        3.25900412081216873e+00, // erfc P, x ≥ 0.5
+        2.56441805509644949e+00, // erfc P, x ≥ 0.5
+        9.99999999999896638e-01, // erfc P, x ≥ 0.5
+        8.86038620933466966e-06, // erfc Q, x ≥ 0.5
+        2.06025577865534266e-04, // erfc Q, x ≥ 0.5
+        2.40006177942234415e-03, // erfc Q, x ≥ 0.5
+        1.81799044603994688e-02, // erfc Q, x ≥ 0.5
+        9.86166471044753606e-02, // erfc Q, x ≥ 0.5
+        4.00442818737078821e-01, // erfc Q, x ≥ 0.5
+        1.24086311591330256e+00, // erfc Q, x ≥ 0.5
+        2.94312324030206751e+00, // erfc Q, x ≥ 0.5
+        5.28356411699105966e+00, // erfc Q, x ≥ 0.5
+        6.98039769418387124e+00, // erfc Q, x ≥ 0.5
+        6.42587957465563520e+00, // erfc Q, x ≥ 0.5
+        3.69279722219009487e+00, // erfc Q, x ≥ 0.5
+        1., // erfc Q, x ≥ 0.5
+    };
 }
 }
 
@@ -247,6 +362,75 @@ namespace Common
         0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU
     };
 
+    // entry k lists the indexes of the bits set in k, followed by the indexes of the bits not
+    // set in k, one index per nibble starting at the least significant nibble
+    alignas(64) const unsigned int CompressIndexes[256] = {
+        0x76543210u, 0x76543210u, 0x76543201u, 0x76543210u,
+        0x76543102u, 0x76543120u, 0x76543021u, 0x76543210u,
+        0x76542103u, 0x76542130u, 0x76542031u, 0x76542310u,
+        0x76541032u, 0x76541320u, 0x76540321u, 0x76543210u,
+        0x76532104u, 0x76532140u, 0x76532041u, 0x76532410u,
+        0x76531042u, 0x76531420u, 0x76530421u, 0x76534210u,
+        0x76521043u, 0x76521430u, 0x76520431u, 0x76524310u,
+        0x76510432u, 0x76514320u, 0x76504321u, 0x76543210u,
+        0x76432105u, 0x76432150u, 0x76432051u, 0x76432510u,
+        0x76431052u, 0x76431520u, 0x76430521u, 0x76435210u,
+        0x76421053u, 0x76421530u, 0x76420531u, 0x76425310u,
+        0x76410532u, 0x76415320u, 0x76405321u, 0x76453210u,
+        0x76321054u, 0x76321540u, 0x76320541u, 0x76325410u,
+        0x76310542u, 0x76315420u, 0x76305421u, 0x76354210u,
+        0x76210543u, 0x76215430u, 0x76205431u, 0x76254310u,
+        0x76105432u, 0x76154320u, 0x76054321u, 0x76543210u,
+        0x75432106u, 0x75432160u, 0x75432061u, 0x75432610u,
+        0x75431062u, 0x75431620u, 0x75430621u, 0x75436210u,
+        0x75421063u, 0x75421630u, 0x75420631u, 0x75426310u,
+        0x75410632u, 0x75416320u, 0x75406321u, 0x75463210u,
+        0x75321064u, 0x75321640u, 0x75320641u, 0x75326410u,
+        0x75310642u, 0x75316420u, 0x75306421u, 0x75364210u,
+        0x75210643u, 0x75216430u, 0x75206431u, 0x75264310u,
+        0x75106432u, 0x75164320u, 0x75064321u, 0x75643210u,
+        0x74321065u, 0x74321650u, 0x74320651u, 0x74326510u,
+        0x74310652u, 0x74316520u, 0x74306521u, 0x74365210u,
+        0x74210653u, 0x74216530u, 0x74206531u, 0x74265310u,
+        0x74106532u, 0x74165320u, 0x74065321u, 0x74653210u,
+        0x73210654u, 0x73216540u, 0x73206541u, 0x73265410u,
+        0x73106542u, 0x73165420u, 0x73065421u, 0x73654210u,
+        0x72106543u, 0x72165430u, 0x72065431u, 0x72654310u,
+        0x71065432u, 0x71654320u, 0x70654321u, 0x76543210u,
+        0x65432107u, 0x65432170u, 0x65432071u, 0x65432710u,
+        0x65431072u, 0x65431720u, 0x65430721u, 0x65437210u,
+        0x65421073u, 0x65421730u, 0x65420731u, 0x65427310u,
+        0x65410732u, 0x65417320u, 0x65407321u, 0x65473210u,
+        0x65321074u, 0x65321740u, 0x65320741u, 0x65327410u,
+        0x65310742u, 0x65317420u, 0x65307421u, 0x65374210u,
+        0x65210743u, 0x65217430u, 0x65207431u, 0x65274310u,
+        0x65107432u, 0x65174320u, 0x65074321u, 0x65743210u,
+        0x64321075u, 0x64321750u, 0x64320751u, 0x64327510u,
+        0x64310752u, 0x64317520u, 0x64307521u, 0x64375210u,
+        0x64210753u, 0x64217530u, 0x64207531u, 0x64275310u,
+        0x64107532u, 0x64175320u, 0x64075321u, 0x64753210u,
+        0x63210754u, 0x63217540u, 0x63207541u, 0x63275410u,
+        0x63107542u, 0x63175420u, 0x63075421u, 0x63754210u,
+        0x62107543u, 0x62175430u, 0x62075431u, 0x62754310u,
+        0x61075432u, 0x61754320u, 0x60754321u, 0x67543210u,
+        0x54321076u, 0x54321760u, 0x54320761u, 0x54327610u,
+        0x54310762u, 0x54317620u, 0x54307621u, 0x54376210u,
+        0x54210763u, 0x54217630u, 0x54207631u, 0x54276310u,
+        0x54107632u, 0x54176320u, 0x54076321u, 0x54763210u,
+        0x53210764u, 0x53217640u, 0x53207641u, 0x53276410u,
+        0x53107642u, 0x53176420u, 0x53076421u, 0x53764210u,
+        0x52107643u, 0x52176430u, 0x52076431u, 0x52764310u,
+        0x51076432u, 0x51764320u, 0x50764321u, 0x57643210u,
+        0x43210765u, 0x43217650u, 0x43207651u, 0x43276510u,
+        0x43107652u, 0x43176520u, 0x43076521u, 0x43765210u,
+        0x42107653u, 0x42176530u, 0x42076531u, 0x42765310u,
+        0x41076532u, 0x41765320u, 0x40765321u, 0x47653210u,
+        0x32107654u, 0x32176540u, 0x32076541u, 0x32765410u,
+        0x31076542u, 0x31765420u, 0x30765421u, 0x37654210u,
+        0x21076543u, 0x21765430u, 0x20765431u, 0x27654310u,
+        0x10765432u, 0x17654320u, 0x07654321u, 0x76543210u
+    };
+
     const char LIBRARY_VERSION[] = Vc_VERSION_STRING;
     const unsigned int LIBRARY_VERSION_NUMBER = Vc_VERSION_NUMBER;
     const unsigned int LIBRARY_ABI_VERSION = Vc_LIBRARY_ABI_VERSION;
@@ -486,5 +670,126 @@ namespace SSE
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
     };
+
+#define Vc_4(x) x, x, x, x
+#define Vc_2(x) x, x
+
+    template <>
+    alignas(64) const float c_tanh<float>::data[] = {
+        Vc_4(1.342163181e-08f), // tanh P
+        Vc_4(2.066251909e-05f), // tanh P
+        Vc_4(3.499055048e-03f), // tanh P
+        Vc_4(1.338401884e-01f), // tanh P
+        Vc_4(1.f), // tanh P
+        Vc_4(7.805477935e-07f), // tanh Q
+        Vc_4(3.291150497e-04f), // tanh Q
+        Vc_4(2.589039877e-02f), // tanh Q
+        Vc_4(4.671733975e-01f), // tanh Q
+        Vc_4(1.f), // tanh Q
+    };
+
+    template <>
+    alignas(64) const double c_tanh<double>::data[] = {
+        Vc_2(-1.60715616512387374e-05), // tanh R, |x| < 0.625
+        Vc_2(7.71421070317254975e-05), // tanh R, |x| < 0.625
+        Vc_2(-2.28562020017644522e-04), // tanh R, |x| < 0.625
+        Vc_2(5.86315337612386953e-04), // tanh R, |x| < 0.625
+        Vc_2(-1.45495846743391374e-03), // tanh R, |x| < 0.625
+        Vc_2(3.59198908370588063e-03), // tanh R, |x| < 0.625
+        Vc_2(-8.86322098993501048e-03), // tanh R, |x| < 0.625
+        Vc_2(2.18694875749835746e-02), // tanh R, |x| < 0.625
+        Vc_2(-5.39682539312116433e-02), // tanh R, |x| < 0.625
+        Vc_2(1.33333333332619514e-01), // tanh R, |x| < 0.625
+        Vc_2(-3.33333333333328541e-01), // tanh R, |x| < 0.625
+    };
+
+    template <>
+    alignas(64) const float c_erf<float>::data[] = {
+        Vc_4(1.995788125e-06f), // erf P
+        Vc_4(2.828003780e-04f), // erf P
+        Vc_4(3.811376402e-03f), // erf P
+        Vc_4(5.286781490e-02f), // erf P
+        Vc_4(1.918899864e-01f), // erf P
+        Vc_4(1.128379107e+00f), // erf P
+        Vc_4(3.742477929e-05f), // erf Q
+        Vc_4(1.168090501e-03f), // erf Q
+        Vc_4(1.505904552e-02f), // erf Q
+        Vc_4(1.146533936e-01f), // erf Q
+        Vc_4(5.033905506e-01f), // erf Q
+        Vc_4(1.f), // erf Q
+        Vc_4(3.256925941e-02f), // erfc P
+        Vc_4(2.281940877e-01f), // erfc P
+        Vc_4(7.295156121e-01f), // erfc P
+        Vc_4(1.236485481e+00f), // erfc P
+        Vc_4(1.f), // erfc P
+        Vc_4(5.772679299e-02f), // erfc Q
+        Vc_4(4.044905007e-01f), // erfc Q
+        Vc_4(1.321457148e+00f), // erfc Q
+        Vc_4(2.397972107e+00f), // erfc Q
+        Vc_4(2.364865065e+00f), // erfc Q
+        Vc_4(1.f), // erfc Q
+    };
+
+    template <>
+    alignas(64) const double c_erf<double>::data[] = {
+        Vc_2(1.46991407896798643e-06), // erf P, |x| < 0.5
+        Vc_2(-1.48429805784309260e-05), // erf P, |x| < 0.5
+        Vc_2(1.20532083445031352e-04), // erf P, |x| < 0.5
+        Vc_2(-8.54829478177198451e-04), // erf P, |x| < 0.5
+        Vc_2(5.22397733337594261e-03), // erf P, |x| < 0.5
+        Vc_2(-2.68661706298921506e-02), // erf P, |x| < 0.5
+        Vc_2(1.12837916709133804e-01), // erf P, |x| < 0.5
+        Vc_2(-3.76126389031832598e-01), // erf P, |x| < 0.5
+        Vc_2(1.12837916709551256e+00), // erf P, |x| < 0.5
+        Vc_2(6.22652842528885486e-05), // erfc P (fast)
+        Vc_2(1.18524098126750860e-03), // erfc P (fast)
+        Vc_2(1.10441653942548890e-02), // erfc P (fast)
+        Vc_2(6.51750353599273441e-02), // erfc P (fast)
+        Vc_2(2.66422377671230282e-01), // erfc P (fast)
+        Vc_2(7.79684420696332703e-01), // erfc P (fast)
+        Vc_2(1.63373451724458252e+00), // erfc P (fast)
+        Vc_2(2.37326717535960841e+00), // erfc P (fast)
+        Vc_2(2.19026643310190927e+00), // erfc P (fast)
+        Vc_2(1.), // erfc P (fast)
+        Vc_2(1.10362342852103720e-04), // erfc Q (fast)
+        Vc_2(2.10078494144841236e-03), // erfc Q (fast)
+        Vc_2(1.96304546578094929e-02), // erfc Q (fast)
+        Vc_2(1.16570134746955240e-01), // erfc Q (fast)
+        Vc_2(4.81953828334055090e-01), // erfc Q (fast)
+        Vc_2(1.43866406489213872e+00), // erfc Q (fast)
+        Vc_2(3.12218103278125891e+00), // erfc Q (fast)
+        Vc_2(4.84233857976644622e+00), // erfc Q (fast)
+        Vc_2(5.11795773359605377e+00), // erfc Q (fast)
+        Vc_2(3.31864560019741273e+00), // erfc Q (fast)
+        Vc_2(1.), // erfc Q (fast)
+        Vc_2(4.99893760551679899e-06), // erfc P, x ≥ 0.5
+        Vc_2(1.16237484976143858e-04), // erfc P, x ≥ 0.5
+        Vc_2(1.35159038701821756e-03), // erfc P, x ≥ 0.5
+        Vc_2(1.01987939839740544e-02), // erfc P, x ≥ 0.5
+        Vc_2(5.49651893356032858e-02), // erfc P, x ≥ 0.5
+        Vc_2(2.20884388901126300e-01), // erfc P, x ≥ 0.5
+        Vc_2(6.73268996179187229e-01), // erfc P, x ≥ 0.5
+        Vc_2(1.55499138593499175e+00), // erfc P, x ≥ 0.5
+        Vc_2(2.67011349609090232e+00), // erfc P, x ≥ 0.5
+        Vc_2(3.25900412081216873e+00), // erfc P, x ≥ 0.5
+        Vc_2(2.56441805509644949e+00), // erfc P, x ≥ 0.5
+        Vc_2(9.99999999999896638e-01), // erfc P, x ≥ 0.5
+        Vc_2(8.86038620933466966e-06), // erfc Q, x ≥ 0.5
+        Vc_2(2.06025577865534266e-04), // erfc Q, x ≥ 0.5
+        Vc_2(2.40006177942234415e-03), // erfc Q, x ≥ 0.5
+        Vc_2(1.81799044603994688e-02), // erfc Q, x ≥ 0.5
+        Vc_2(9.86166471044753606e-02), // erfc Q, x ≥ 0.5
+        Vc_2(4.00442818737078821e-01), // erfc Q, x ≥ 0.5
+        Vc_2(1.24086311591330256e+00), // erfc Q, x ≥ 0.5
+        Vc_2(2.94312324030206751e+00), // erfc Q, x ≥ 0.5
+        Vc_2(5.28356411699105966e+00), // erfc Q, x ≥ 0.5
+        Vc_2(6.98039769418387124e+00), // erfc Q, x ≥ 0.5
+        Vc_2(6.42587957465563520e+00), // erfc Q, x ≥ 0.5
+        Vc_2(3.69279722219009487e+00), // erfc Q, x ≥ 0.5
+        Vc_2(1.), // erfc Q, x ≥ 0.5
+    };
+
+#undef Vc_4
+#undef Vc_2
 }
 }
@@ -0,0 +1,132 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <Vc/cpuid.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+namespace
+{
+using Impl = GatherScatterImplementation;
+
+bool gatherImplementationFromEnvironment(Impl &impl)
+{
+    const char *env = std::getenv("VC_GATHER_STRATEGY");
+    if (!env) {
+        return false;
+    }
+    struct {
+        const char *name;
+        Impl impl;
+    } const names[] = {{"simple", Impl::SimpleLoop},
+                       {"bsf", Impl::BitScanLoop},
+                       {"popcnt", Impl::PopcntSwitch},
+                       {"hardware", Impl::Hardware}};
+    for (const auto &n : names) {
+        if (std::strcmp(env, n.name) == 0) {
+            impl = n.impl;
+            return true;
+        }
+    }
+    return false;  // unknown names fall through to the automatic selection
+}
+
+// Processors where vpgather is known to beat the emulations. Haswell through Tiger Lake
+// are not listed: their gather throughput depends on the microcode (the GDS mitigation
+// slows vpgather down severely), so they are calibrated.
+bool gatherImplementationFromProcessor(Impl &impl)
+{
+    CpuId::init();
+    const unsigned family = CpuId::processorFamily();
+    const unsigned model = CpuId::processorModel();
+    if (CpuId::isIntel() && family == 6) {
+        switch (model) {
+        case 0x8f:  // Sapphire Rapids
+        case 0xcf:  // Emerald Rapids
+        case 0xad:  // Granite Rapids
+        case 0x97:  // Alder Lake
+        case 0x9a:  // Alder Lake
+        case 0xb7:  // Raptor Lake
+        case 0xba:  // Raptor Lake
+        case 0xbf:  // Raptor Lake
+        case 0xaa:  // Meteor Lake
+        case 0xc5:  // Arrow Lake
+        case 0xc6:  // Arrow Lake
+            impl = Impl::Hardware;
+            return true;
+        }
+    } else if (CpuId::isAmd() && family >= 0x19) {  // Zen 3 and later
+        impl = Impl::Hardware;
+        return true;
+    }
+    return false;
+}
+
+Impl calibrateGatherImplementation(float (*run)(Impl))
+{
+    const Impl candidates[] = {Impl::Hardware, Impl::PopcntSwitch, Impl::BitScanLoop,
+                               Impl::SimpleLoop};
+    volatile float sink = 0;
+    Impl best = Impl::Hardware;
+    auto bestTime = std::chrono::steady_clock::duration::max();
+    for (Impl impl : candidates) {
+        sink = sink + run(impl);  // warm up caches and branch predictors
+        auto fastest = std::chrono::steady_clock::duration::max();
+        for (int repeat = 0; repeat < 5; ++repeat) {
+            const auto start = std::chrono::steady_clock::now();
+            sink = sink + run(impl);
+            fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+        }
+        if (fastest < bestTime) {
+            bestTime = fastest;
+            best = impl;
+        }
+    }
+    return best;
+}
+}  // unnamed namespace
+
+GatherScatterImplementation Vc_VDECL
+selectGatherImplementation(float (*run)(GatherScatterImplementation))
+{
+    Impl impl = Impl::Hardware;
+    if (gatherImplementationFromEnvironment(impl) ||
+        gatherImplementationFromProcessor(impl)) {
+        return impl;
+    }
+    return calibrateGatherImplementation(run);
+}
+}  // namespace Common
+}  // namespace Vc
+
+// vim: sw=4 sts=4 et tw=100
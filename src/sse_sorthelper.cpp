@@ -33,9 +33,10 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace Detail
 {
 template <>
-Vc_CONST SSE::short_v sorted<CurrentImplementation::current()>(SSE::short_v x_)
+Vc_CONST SSE::short_v::VectorType sorted<CurrentImplementation::current(), short>(
+    SSE::short_v::VectorType x_)
 {
-    __m128i lo, hi, y, x = x_.data();
+    __m128i lo, hi, y, x = x_;
     // sort pairs
     y = Mem::permute<X1, X0, X3, X2, X5, X4, X7, X6>(x);
     lo = _mm_min_epi16(x, y);
@@ -72,9 +73,10 @@ Vc_CONST SSE::short_v sorted<CurrentImplementation::current()>(SSE::short_v x_)
 }
 
 template <>
-Vc_CONST SSE::ushort_v sorted<CurrentImplementation::current()>(SSE::ushort_v x_)
+Vc_CONST SSE::ushort_v::VectorType sorted<CurrentImplementation::current(), ushort>(
+    SSE::ushort_v::VectorType x_)
 {
-    __m128i lo, hi, y, x = x_.data();
+    __m128i lo, hi, y, x = x_;
     // sort pairs
     y = Mem::permute<X1, X0, X3, X2, X5, X4, X7, X6>(x);
     lo = SSE::min_epu16(x, y);
@@ -110,9 +112,11 @@ Vc_CONST SSE::ushort_v sorted<CurrentImplementation::current()>(SSE::ushort_v x_
     return _mm_unpacklo_epi16(lo, hi);
 }
 
-template <> Vc_CONST SSE::int_v sorted<CurrentImplementation::current()>(SSE::int_v x_)
+template <>
+Vc_CONST SSE::int_v::VectorType sorted<CurrentImplementation::current(), int>(
+    SSE::int_v::VectorType x_)
 {
-    __m128i x = x_.data();
+    __m128i x = x_;
     /*
     // in 16,67% of the cases the merge can be replaced by an append
 
@@ -145,9 +149,11 @@ template <> Vc_CONST SSE::int_v sorted<CurrentImplementation::current()>(SSE::in
     return _mm_unpacklo_epi32(l, h);
 }
 
-template <> Vc_CONST SSE::uint_v sorted<CurrentImplementation::current()>(SSE::uint_v x_)
+template <>
+Vc_CONST SSE::uint_v::VectorType sorted<CurrentImplementation::current(), uint>(
+    SSE::uint_v::VectorType x_)
 {
-    __m128i x = x_.data();
+    __m128i x = x_;
     __m128i y = _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
     __m128i l = SSE::min_epu32(x, y);
     __m128i h = SSE::max_epu32(x, y);
@@ -166,9 +172,10 @@ template <> Vc_CONST SSE::uint_v sorted<CurrentImplementation::current()>(SSE::u
 }
 
 template <>
-Vc_CONST SSE::float_v sorted<CurrentImplementation::current()>(SSE::float_v x_)
+Vc_CONST SSE::float_v::VectorType sorted<CurrentImplementation::current(), float>(
+    SSE::float_v::VectorType x_)
 {
-    __m128 x = x_.data();
+    __m128 x = x_;
     __m128 y = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
     __m128 l = _mm_min_ps(x, y);
     __m128 h = _mm_max_ps(x, y);
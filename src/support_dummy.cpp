@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <Vc/global.h>
 #include <Vc/support.h>
+#include <Vc/dispatch>
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -35,6 +36,11 @@ bool isImplementationSupported(Implementation impl) { return impl == ScalarImpl;
 Vc::Implementation bestImplementationSupported() { return Vc::ScalarImpl; }
 
 unsigned int extraInstructionsSupported() { return 0; }
+
+namespace Detail
+{
+int dispatchRank(unsigned int features) { return features == ScalarImpl ? 0 : -1; }
+}  // namespace Detail
 }
 
 #undef Vc_TARGET_NO_SIMD
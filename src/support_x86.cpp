@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Vc/global.h>
 #include <Vc/cpuid.h>
 #include <Vc/support.h>
+#include <Vc/dispatch>
 
 #ifdef Vc_MSVC
 #include <intrin.h>
@@ -58,6 +59,14 @@ static inline bool xgetbvCheck(unsigned int bits)
 #endif
 }
 
+// the AVX-512 subsets Vc_IMPL_AVX512 requires (Skylake-SP and later)
+Vc_TARGET_NO_SIMD
+static inline bool hasAvx512()
+{
+    return CpuId::hasAvx512f() && CpuId::hasAvx512vl() && CpuId::hasAvx512dq() &&
+           CpuId::hasAvx512bw() && CpuId::hasAvx512cd();
+}
+
 Vc_TARGET_NO_SIMD
 bool isImplementationSupported(Implementation impl)
 {
@@ -80,6 +89,8 @@ bool isImplementationSupported(Implementation impl)
         return CpuId::hasOsxsave() && CpuId::hasAvx() && xgetbvCheck(0x6);
     case AVX2Impl:
         return CpuId::hasOsxsave() && CpuId::hasAvx2() && xgetbvCheck(0x6);
+    case AVX512Impl:
+        return CpuId::hasOsxsave() && CpuId::hasAvx2() && hasAvx512() && xgetbvCheck(0xe6);
     case MICImpl:
         return CpuId::processorFamily() == 0xB && CpuId::processorModel() == 0x1
             && CpuId::isIntel();
@@ -105,7 +116,8 @@ Vc::Implementation bestImplementationSupported()
     if (!CpuId::hasSse42()) return Vc::SSE41Impl;
     if (CpuId::hasAvx() && CpuId::hasOsxsave() && xgetbvCheck(0x6)) {
         if (!CpuId::hasAvx2()) return Vc::AVXImpl;
-        return Vc::AVX2Impl;
+        if (!hasAvx512() || !xgetbvCheck(0xe6)) return Vc::AVX2Impl;
+        return Vc::AVX512Impl;
     }
     return Vc::SSE42Impl;
 }
@@ -128,6 +140,26 @@ unsigned int extraInstructionsSupported()
     return flags;
 }
 
+namespace Detail
+{
+Vc_TARGET_NO_SIMD
+int dispatchRank(unsigned int features)
+{
+    const unsigned int impl = features & ImplementationMask;
+    const unsigned int extra = features & ExtraInstructionsMask;
+    // not a comparison with bestImplementationSupported(): AVX512Impl comes after MICImpl
+    if (!isImplementationSupported(static_cast<Implementation>(impl)) ||
+        (extra & extraInstructionsSupported()) != extra) {
+        return -1;
+    }
+    int n = 0;
+    for (unsigned int bits = extra; bits; bits &= bits - 1) {
+        ++n;
+    }
+    return static_cast<int>(impl) * 32 + n;
+}
+}  // namespace Detail
+
 }
 
 #undef Vc_TARGET_NO_SIMD
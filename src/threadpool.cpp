@@ -0,0 +1,235 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/common/threadpool.h>
+#include <Vc/Memory>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace
+{
+// set for the worker threads and for the thread executing ThreadPool::run, so that nested
+// calls to run execute serially instead of deadlocking
+thread_local bool insideThreadPool = false;
+}  // unnamed namespace
+
+struct ThreadPool::Impl {
+    // the chunk indexes [begin, end) that are still to be processed by one thread
+    // (each on its own cacheline to avoid false sharing between the threads; the array is
+    // allocated with Vc::malloc since operator new ignores the alignment before C++17)
+    struct alignas(64) Queue {
+        std::mutex lock;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    explicit Impl(std::size_t nthreads)
+        : queues(Vc::malloc<Queue, Vc::AlignOnCacheline>(nthreads)), nqueues(nthreads)
+    {
+        for (std::size_t i = 0; i < nqueues; ++i) {
+            new (&queues[i]) Queue;
+        }
+        workers.reserve(nthreads - 1);
+        for (std::size_t i = 1; i < nthreads; ++i) {
+            workers.emplace_back([this, i]() { workerMain(i); });
+        }
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> l(lock);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto &t : workers) {
+            t.join();
+        }
+        for (std::size_t i = 0; i < nqueues; ++i) {
+            queues[i].~Queue();
+        }
+        Vc::free(queues);
+    }
+
+    bool pop(std::size_t self, std::size_t &chunk)
+    {
+        Queue &q = queues[self];
+        std::lock_guard<std::mutex> l(q.lock);
+        if (q.begin == q.end) {
+            return false;
+        }
+        chunk = q.begin++;
+        return true;
+    }
+
+    bool steal(std::size_t self, std::size_t &chunk)
+    {
+        for (std::size_t i = 1; i < nqueues; ++i) {
+            Queue &victim = queues[(self + i) % nqueues];
+            std::size_t first, last;
+            {
+                std::lock_guard<std::mutex> l(victim.lock);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (remaining == 0) {
+                    continue;
+                }
+                last = victim.end;
+                first = victim.end - (remaining + 1) / 2;
+                victim.end = first;
+            }
+            chunk = first;
+            Queue &q = queues[self];
+            std::lock_guard<std::mutex> l(q.lock);
+            q.begin = first + 1;
+            q.end = last;
+            return true;
+        }
+        return false;
+    }
+
+    void work(std::size_t self)
+    {
+        std::size_t chunk;
+        while (pop(self, chunk) || steal(self, chunk)) {
+            try {
+                (*task)(chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> l(errorLock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void workerMain(std::size_t self)
+    {
+        insideThreadPool = true;
+        std::size_t seenGeneration = 0;
+        std::unique_lock<std::mutex> l(lock);
+        for (;;) {
+            wake.wait(l, [&]() { return stop || generation != seenGeneration; });
+            if (stop) {
+                return;
+            }
+            seenGeneration = generation;
+            l.unlock();
+            work(self);
+            l.lock();
+            if (--active == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+    Queue *const queues;
+    const std::size_t nqueues;
+    std::vector<std::thread> workers;
+
+    std::mutex submitLock;  // serializes concurrent calls to run
+    std::mutex lock;        // protects the members below
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::size_t generation = 0;
+    std::size_t active = 0;
+    bool stop = false;
+    const std::function<void(std::size_t)> *task = nullptr;
+
+    std::mutex errorLock;
+    std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool(std::size_t nthreads)
+{
+    if (nthreads == 0) {
+        nthreads = std::thread::hardware_concurrency();
+        if (nthreads == 0) {
+            nthreads = 1;
+        }
+    }
+    d.reset(new Impl(nthreads));
+}
+
+ThreadPool::~ThreadPool() = default;
+
+std::size_t ThreadPool::size() const { return d->nqueues; }
+
+void ThreadPool::run(std::size_t chunks, const std::function<void(std::size_t)> &task)
+{
+    if (chunks <= 1 || d->workers.empty() || insideThreadPool) {
+        for (std::size_t i = 0; i < chunks; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(d->submitLock);
+    const std::size_t n = d->nqueues;
+    for (std::size_t i = 0; i < n; ++i) {
+        std::lock_guard<std::mutex> l(d->queues[i].lock);
+        d->queues[i].begin = i * chunks / n;
+        d->queues[i].end = (i + 1) * chunks / n;
+    }
+    {
+        std::lock_guard<std::mutex> l(d->lock);
+        d->task = &task;
+        d->error = nullptr;
+        d->active = d->workers.size();
+        ++d->generation;
+    }
+    d->wake.notify_all();
+
+    insideThreadPool = true;
+    d->work(0);
+    insideThreadPool = false;
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> l(d->lock);
+        d->done.wait(l, [&]() { return d->active == 0; });
+        d->task = nullptr;
+        std::swap(error, d->error);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool &ThreadPool::global()
+{
+    static ThreadPool pool;
+    return pool;
+}
+}  // namespace Vc
+
+// vim: sw=4 sts=4 et tw=100
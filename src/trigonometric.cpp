@@ -56,10 +56,11 @@ template <typename Abi>
 static Vc_ALWAYS_INLINE Vector<float, Abi> cosSeries(const Vector<float, Abi> &x)
 {
     const Vector<float, Abi> x2 = x * x;
-    Vector<float, Abi> y;
-    y =          Vc::Detail::floatConstant< 1, 0x500000, -16>();  //  1/8!
-    y = y * x2 + Vc::Detail::floatConstant<-1, 0x360800, -10>();  // -1/6!
-    y = y * x2 + Vc::Detail::floatConstant< 1, 0x2AAAAB,  -5>();  //  1/4!
+    const Vector<float, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::floatConstant< 1, 0x500000, -16>(),   //  1/8!
+        Vc::Detail::floatConstant<-1, 0x360800, -10>(),   // -1/6!
+        Vc::Detail::floatConstant< 1, 0x2AAAAB,  -5>());  //  1/4!
     return y * (x2 * x2) - .5f * x2 + 1.f;
     // alternative (appears neither faster nor more precise):
     // return (y * x2 - .5f) * x2 + 1.f;
@@ -69,14 +70,15 @@ template <typename Abi>
 static Vc_ALWAYS_INLINE Vector<double, Abi> cosSeries(const Vector<double, Abi> &x)
 {
     const Vector<double, Abi> x2 = x * x;
-    Vector<double, Abi> y;
-    y =          Vc::Detail::doubleConstant< 1, 0xAC00000000000, -45>();  //  1/16!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0x9394000000000, -37>();  // -1/14!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0x1EED8C0000000, -29>();  //  1/12!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0x27E4FB7400000, -22>();  // -1/10!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0xA01A01A018000, -16>();  //  1/8!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0x6C16C16C16C00, -10>();  // -1/6!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0x5555555555554,  -5>();  //  1/4!
+    const Vector<double, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::doubleConstant< 1, 0xAC00000000000, -45>(),   //  1/16!
+        Vc::Detail::doubleConstant<-1, 0x9394000000000, -37>(),   // -1/14!
+        Vc::Detail::doubleConstant< 1, 0x1EED8C0000000, -29>(),   //  1/12!
+        Vc::Detail::doubleConstant<-1, 0x27E4FB7400000, -22>(),   // -1/10!
+        Vc::Detail::doubleConstant< 1, 0xA01A01A018000, -16>(),   //  1/8!
+        Vc::Detail::doubleConstant<-1, 0x6C16C16C16C00, -10>(),   // -1/6!
+        Vc::Detail::doubleConstant< 1, 0x5555555555554,  -5>());  //  1/4!
     return (y * x2 - .5f) * x2 + 1.f;
 }
 
@@ -84,10 +86,11 @@ template <typename Abi>
 static Vc_ALWAYS_INLINE Vector<float, Abi> sinSeries(const Vector<float, Abi> &x)
 {
     const Vector<float, Abi> x2 = x * x;
-    Vector<float, Abi> y;
-    y =          Vc::Detail::floatConstant<-1, 0x4E6000, -13>();  // -1/7!
-    y = y * x2 + Vc::Detail::floatConstant< 1, 0x088880,  -7>();  //  1/5!
-    y = y * x2 + Vc::Detail::floatConstant<-1, 0x2AAAAB,  -3>();  // -1/3!
+    const Vector<float, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::floatConstant<-1, 0x4E6000, -13>(),   // -1/7!
+        Vc::Detail::floatConstant< 1, 0x088880,  -7>(),   //  1/5!
+        Vc::Detail::floatConstant<-1, 0x2AAAAB,  -3>());  // -1/3!
     return y * (x2 * x) + x;
 }
 
@@ -97,14 +100,75 @@ static Vc_ALWAYS_INLINE Vector<double, Abi> sinSeries(const Vector<double, Abi>
     // x  = [0, 0.7854 = pi/4]
     // x² = [0, 0.6169 = pi²/8]
     const Vector<double, Abi> x2 = x * x;
-    Vector<double, Abi> y;
-    y =          Vc::Detail::doubleConstant<-1, 0xACF0000000000, -41>();  // -1/15!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0x6124400000000, -33>();  //  1/13!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0xAE64567000000, -26>();  // -1/11!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0x71DE3A5540000, -19>();  //  1/9!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0xA01A01A01A000, -13>();  // -1/7!
-    y = y * x2 + Vc::Detail::doubleConstant< 1, 0x1111111111110,  -7>();  //  1/5!
-    y = y * x2 + Vc::Detail::doubleConstant<-1, 0x5555555555555,  -3>();  // -1/3!
+    const Vector<double, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::doubleConstant<-1, 0xACF0000000000, -41>(),   // -1/15!
+        Vc::Detail::doubleConstant< 1, 0x6124400000000, -33>(),   //  1/13!
+        Vc::Detail::doubleConstant<-1, 0xAE64567000000, -26>(),   // -1/11!
+        Vc::Detail::doubleConstant< 1, 0x71DE3A5540000, -19>(),   //  1/9!
+        Vc::Detail::doubleConstant<-1, 0xA01A01A01A000, -13>(),   // -1/7!
+        Vc::Detail::doubleConstant< 1, 0x1111111111110,  -7>(),   //  1/5!
+        Vc::Detail::doubleConstant<-1, 0x5555555555555,  -3>());  // -1/3!
+    return y * (x2 * x) + x;
+}
+
+/**\internal
+ * Precision::Fast: minimax polynomials of lower degree than the Taylor series above, for
+ * |x| ≤ ¼π.
+ */
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<float, Abi> cosSeries(const Vector<float, Abi> &x,
+                                                     Precision::FastTag)
+{
+    const Vector<float, Abi> x2 = x * x;
+    const Vector<float, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::floatConstant<-1, 0x32E58E, -10>(),   // ≈ -1/6!
+        Vc::Detail::floatConstant< 1, 0x2AA4CD,  -5>());  // ≈  1/4!
+    return (y * x2 - .5f) * x2 + 1.f;
+}
+
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<double, Abi> cosSeries(const Vector<double, Abi> &x,
+                                                      Precision::FastTag)
+{
+    const Vector<double, Abi> x2 = x * x;
+    const Vector<double, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::doubleConstant< 1, 0x1BBE87268365C, -29>(),   // ≈  1/12!
+        Vc::Detail::doubleConstant<-1, 0x27E00B78F77E8, -22>(),   // ≈ -1/10!
+        Vc::Detail::doubleConstant< 1, 0xA019FA5FC0A0F, -16>(),   // ≈  1/8!
+        Vc::Detail::doubleConstant<-1, 0x6C16C16720D3B, -10>(),   // ≈ -1/6!
+        Vc::Detail::doubleConstant< 1, 0x5555555552DD8,  -5>());  // ≈  1/4!
+    return (y * x2 - .5) * x2 + 1.;
+}
+
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<float, Abi> sinSeries(const Vector<float, Abi> &x,
+                                                     Precision::FastTag)
+{
+    const Vector<float, Abi> x2 = x * x;
+    const Vector<float, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::floatConstant<-1, 0x4CAA04, -13>(),   // ≈ -1/7!
+        Vc::Detail::floatConstant< 1, 0x0883BC,  -7>(),   // ≈  1/5!
+        Vc::Detail::floatConstant<-1, 0x2AAAA3,  -3>());  // ≈ -1/3!
+    return y * (x2 * x) + x;
+}
+
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<double, Abi> sinSeries(const Vector<double, Abi> &x,
+                                                      Precision::FastTag)
+{
+    const Vector<double, Abi> x2 = x * x;
+    const Vector<double, Abi> y = Vc::polynomial(
+        x2,
+        Vc::Detail::doubleConstant< 1, 0x5D8E3C3D98457, -33>(),   // ≈  1/13!
+        Vc::Detail::doubleConstant<-1, 0xAE5E544C7531D, -26>(),   // ≈ -1/11!
+        Vc::Detail::doubleConstant< 1, 0x71DE355E80257, -19>(),   // ≈  1/9!
+        Vc::Detail::doubleConstant<-1, 0xA01A019BF12BB, -13>(),   // ≈ -1/7!
+        Vc::Detail::doubleConstant< 1, 0x111111110F754,  -7>(),   // ≈  1/5!
+        Vc::Detail::doubleConstant<-1, 0x5555555555548,  -3>());  // ≈ -1/3!
     return y * (x2 * x) + x;
 }
 
@@ -255,8 +319,83 @@ static Vc_ALWAYS_INLINE folded<double, Abi> foldInput(const Vector<double, Abi>
     return r;
 }
 
+/**\internal
+ * Precision::Fast: Cody-Waite reduction without branches. float splits ½π into four parts
+ * (the first three have at most 9 mantissa bits) and never converts to double. The
+ * products of y with the leading parts are exact for y < 2¹⁵ (float) and y < 2³⁰ (double),
+ * i.e. up to |x| ≈ 51000 and |x| ≈ 1.7·10⁹. Above, the result loses precision.
+ */
+template <typename Abi>
+static Vc_ALWAYS_INLINE folded<float, Abi> foldInput(const Vector<float, Abi> &x,
+                                                     Precision::FastTag)
+{
+    using V = Vector<float, Abi>;
+    using IV = best_int_v_for<V>;
+
+    folded<float, Abi> r;
+    r.x = abs(x);
+    const float _2_over_pi = Vc::Detail::floatConstant<1, 0x22F983, -1>();  // 2/π
+    const V y = round(r.x * _2_over_pi);
+    r.quadrant = simd_cast<V>(simd_cast<IV>(y) & 3);  // y mod 4
+    r.x -= y * Vc::Detail::floatConstant<1, 0x490000,   0>();
+    r.x -= y * Vc::Detail::floatConstant<1, 0x7D8000, -12>();
+    r.x -= y * Vc::Detail::floatConstant<1, 0x288000, -22>();
+    r.x -= y * Vc::Detail::floatConstant<1, 0x05A309, -34>();
+    return r;
+}
+
+template <typename Abi>
+static Vc_ALWAYS_INLINE folded<double, Abi> foldInput(const Vector<double, Abi> &x,
+                                                      Precision::FastTag)
+{
+    using V = Vector<double, Abi>;
+    using IV = best_int_v_for<V>;
+
+    folded<double, Abi> r;
+    r.x = abs(x);
+    const V y = round(r.x * Vc::Detail::doubleConstant<1, 0x45F306DC9C883, -1>());
+    r.quadrant = simd_cast<V>(simd_cast<IV>(y) & 3);
+    r.x -= y * Vc::Detail::doubleConstant<1, 0x921FB40000000,   0>();
+    r.x -= y * Vc::Detail::doubleConstant<1, 0x4442D00000000, -24>();
+    r.x -= y * Vc::Detail::doubleConstant<1, 0x8469898CC5170, -48>();
+    return r;
+}
+
 constexpr double signmask = -0.;
 constexpr float signmaskf = -0.f;
+
+// Precision::Fast: the quadrant logic of sin, cos, and sincos below for float and double
+template <typename V> static Vc_ALWAYS_INLINE V sinFast(const V &x)
+{
+    using T = typename V::EntryType;
+    const auto f = foldInput(x, Precision::Fast);
+    const V sin_sign = (x ^ (1 - f.quadrant)) & V(T(-0.));
+    const V sin_s = sinSeries(f.x, Precision::Fast);
+    const V cos_s = cosSeries(f.x, Precision::Fast);
+    return sin_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, sin_s, cos_s);
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V cosFast(const V &x)
+{
+    using T = typename V::EntryType;
+    const auto f = foldInput(x, Precision::Fast);
+    const V cos_sign = ((T(0.5) - f.quadrant) & (f.quadrant - T(2.5))) & V(T(-0.));
+    const V sin_s = sinSeries(f.x, Precision::Fast);
+    const V cos_s = cosSeries(f.x, Precision::Fast);
+    return cos_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, cos_s, sin_s);
+}
+
+template <typename V> static Vc_ALWAYS_INLINE void sincosFast(const V &x, V *s, V *c)
+{
+    using T = typename V::EntryType;
+    const auto f = foldInput(x, Precision::Fast);
+    const V sin_sign = (x ^ (1 - f.quadrant)) & V(T(-0.));
+    const V cos_sign = ((T(0.5) - f.quadrant) & (f.quadrant - T(2.5))) & V(T(-0.));
+    const V sin_s = sinSeries(f.x, Precision::Fast);
+    const V cos_s = cosSeries(f.x, Precision::Fast);
+    *s = sin_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, sin_s, cos_s);
+    *c = cos_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, cos_s, sin_s);
+}
 } // anonymous namespace
 
 /*
@@ -397,6 +536,56 @@ void Trigonometric<Vc::Detail::TrigonometricImplementation<
     *c = cos_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, cos_s, sin_s);
 }
 
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sin(const Vc::double_v &x, Precision::FastTag)
+{
+    return sinFast(x);
+}
+
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::cos(const Vc::double_v &x, Precision::FastTag)
+{
+    return cosFast(x);
+}
+
+template <>
+template <>
+void Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sincos(const Vc::double_v &x, Vc::double_v *s,
+                                                   Vc::double_v *c, Precision::FastTag)
+{
+    sincosFast(x, s, c);
+}
+
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sin(const Vc::float_v &x, Precision::FastTag)
+{
+    return sinFast(x);
+}
+
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::cos(const Vc::float_v &x, Precision::FastTag)
+{
+    return cosFast(x);
+}
+
+template <>
+template <>
+void Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sincos(const Vc::float_v &x, Vc::float_v *s,
+                                                   Vc::float_v *c, Precision::FastTag)
+{
+    sincosFast(x, s, c);
+}
+
 template <>
 template <>
 Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
@@ -416,12 +605,8 @@ Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
     V z = a * a;
     z(gt_0_5) = (V::One() - a) * C::_1_2();
     x(gt_0_5) = sqrt(z);
-    z = ((((C::asinCoeff0(0)  * z
-          + C::asinCoeff0(1)) * z
-          + C::asinCoeff0(2)) * z
-          + C::asinCoeff0(3)) * z
-          + C::asinCoeff0(4)) * z * x
-          + x;
+    const V p = Vc::Detail::polynomial<0, 5>(z, [](int i) { return C::asinCoeff0(i); });
+    z = p * z * x + x;
     z(gt_0_5) = C::_pi_2() - (z + z);
     z(small) = a;
     z(negative) = -z;
@@ -442,20 +627,18 @@ template<> template<> Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplem
     const M large = a > C::largeAsinInput();
 
     V zz = V::One() - a;
-    const V r = (((C::asinCoeff0(0) * zz + C::asinCoeff0(1)) * zz + C::asinCoeff0(2)) * zz +
-            C::asinCoeff0(3)) * zz + C::asinCoeff0(4);
-    const V s = (((zz + C::asinCoeff1(0)) * zz + C::asinCoeff1(1)) * zz +
-            C::asinCoeff1(2)) * zz + C::asinCoeff1(3);
+    const V r = Vc::Detail::polynomial<0, 5>(zz, [](int i) { return C::asinCoeff0(i); });
+    const V s = Vc::Detail::polynomial<0, 5>(
+        zz, [](int i) { return i == 0 ? V::One() : C::asinCoeff1(i - 1); });
     V sqrtzz = sqrt(zz + zz);
     V z = C::_pi_4() - sqrtzz;
     z -= sqrtzz * (zz * r / s) - C::_pi_2_rem();
     z += C::_pi_4();
 
     V a2 = a * a;
-    const V p = ((((C::asinCoeff2(0) * a2 + C::asinCoeff2(1)) * a2 + C::asinCoeff2(2)) * a2 +
-                C::asinCoeff2(3)) * a2 + C::asinCoeff2(4)) * a2 + C::asinCoeff2(5);
-    const V q = ((((a2 + C::asinCoeff3(0)) * a2 + C::asinCoeff3(1)) * a2 +
-                C::asinCoeff3(2)) * a2 + C::asinCoeff3(3)) * a2 + C::asinCoeff3(4);
+    const V p = Vc::Detail::polynomial<0, 6>(a2, [](int i) { return C::asinCoeff2(i); });
+    const V q = Vc::Detail::polynomial<0, 6>(
+        a2, [](int i) { return i == 0 ? V::One() : C::asinCoeff3(i - 1); });
     z(!large) = a * (a2 * p / q) + a;
 
     z(negative) = -z;
@@ -481,11 +664,10 @@ Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
     x(gt_tan_3pi_8) = -V::One() / x;
     x(gt_tan_pi_8)  = (x - V::One()) / (x + V::One());
     const V &x2 = x * x;
-    y += (((C::atanP(0)  * x2
-          - C::atanP(1)) * x2
-          + C::atanP(2)) * x2
-          - C::atanP(3)) * x2 * x
-          + x;
+    // the table holds the magnitudes of the alternating coefficients
+    const V p = Vc::Detail::polynomial<0, 4>(
+        x2, [](int i) { return i & 1 ? -C::atanP(i) : C::atanP(i); });
+    y += p * x2 * x + x;
     y(_x < V::Zero()) = -y;
     y.setQnan(isnan(_x));
     return y;
@@ -508,8 +690,9 @@ template<> template<> Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplem
     y(gt_06) = C::_pi_4();
     y(large) = C::_pi_2();
     V z = x * x;
-    const V p = (((C::atanP(0) * z + C::atanP(1)) * z + C::atanP(2)) * z + C::atanP(3)) * z + C::atanP(4);
-    const V q = ((((z + C::atanQ(0)) * z + C::atanQ(1)) * z + C::atanQ(2)) * z + C::atanQ(3)) * z + C::atanQ(4);
+    const V p = Vc::Detail::polynomial<0, 5>(z, [](int i) { return C::atanP(i); });
+    const V q = Vc::Detail::polynomial<0, 6>(
+        z, [](int i) { return i == 0 ? V::One() : C::atanQ(i - 1); });
     z = z * p / q;
     z = x * z + x;
     V morebits = C::_pi_2_rem();
@@ -608,6 +791,93 @@ template<> template<> Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplem
     return a;
 }
 
+
+// the entry points of the library for Vc/common/trigonometric.h. They take and return the
+// intrinsic types, thus the Vc_IMPL_ABI_TAG of Vector does not enter their mangled names
+// and every compatible implementation links to the same copy.
+#define Vc_TRIG_FORWARD_(V_)                                                             \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::sin(const V_::VectorType &x)             \
+    {                                                                                    \
+        return sin(V_(x)).data();                                                        \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::cos(const V_::VectorType &x)             \
+    {                                                                                    \
+        return cos(V_(x)).data();                                                        \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    void Trigonometric<Vc::Detail::TrigonometricImplementation<                          \
+        Vc::CurrentImplementation::current()>>::sincos(const V_::VectorType &x,          \
+                                                       V_::VectorType *s,                \
+                                                       V_::VectorType *c)                \
+    {                                                                                    \
+        V_ s_, c_;                                                                       \
+        sincos(V_(x), &s_, &c_);                                                         \
+        *s = s_.data();                                                                  \
+        *c = c_.data();                                                                  \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::sin(const V_::VectorType &x,             \
+                                                    Precision::FastTag)                  \
+    {                                                                                    \
+        return sinFast(V_(x)).data();                                                    \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::cos(const V_::VectorType &x,             \
+                                                    Precision::FastTag)                  \
+    {                                                                                    \
+        return cosFast(V_(x)).data();                                                    \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    void Trigonometric<Vc::Detail::TrigonometricImplementation<                          \
+        Vc::CurrentImplementation::current()>>::sincos(const V_::VectorType &x,          \
+                                                       V_::VectorType *s,                \
+                                                       V_::VectorType *c,                \
+                                                       Precision::FastTag)               \
+    {                                                                                    \
+        V_ s_, c_;                                                                       \
+        sincosFast(V_(x), &s_, &c_);                                                     \
+        *s = s_.data();                                                                  \
+        *c = c_.data();                                                                  \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::asin(const V_::VectorType &x)            \
+    {                                                                                    \
+        return asin(V_(x)).data();                                                       \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::atan(const V_::VectorType &x)            \
+    {                                                                                    \
+        return atan(V_(x)).data();                                                       \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    V_::VectorType Trigonometric<Vc::Detail::TrigonometricImplementation<                \
+        Vc::CurrentImplementation::current()>>::atan2(const V_::VectorType &y,           \
+                                                      const V_::VectorType &x)           \
+    {                                                                                    \
+        return atan2(V_(y), V_(x)).data();                                               \
+    }                                                                                    \
+    static_assert(true, "")
+Vc_TRIG_FORWARD_(Vc::float_v);
+Vc_TRIG_FORWARD_(Vc::double_v);
+#undef Vc_TRIG_FORWARD_
+
 }
 }
 
@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../Vc/common/const.h"
 #include "../Vc/common/macros.h"
 #include <random>
+#include <cmath>
 
 using namespace Vc;
 
@@ -627,4 +628,285 @@ TEST_TYPES(V, testFma, AllVectors)
     testFmaDispatch<V>(T());
 }
 
+// 8-bit vectors {{{1
+template <class V> V randomChars()
+{
+    using T = typename V::EntryType;
+    return V([](int) { return static_cast<T>(std::rand()); });
+}
+
+TEST_TYPES(V, testCharArithmetics, concat<CharVectors, CharSimdArrays<19>>)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V x = randomChars<V>();
+        V y = randomChars<V>();
+        where(y == 0) | y = 1;
+        V sum, diff, prod, quot, shl, shr, lo, hi;
+        for (size_t i = 0; i < V::Size; ++i) {
+            sum[i] = T(x[i] + y[i]);
+            diff[i] = T(x[i] - y[i]);
+            prod[i] = T(x[i] * y[i]);
+            quot[i] = T(x[i] / y[i]);
+            shl[i] = T(x[i] << 3);
+            shr[i] = T(x[i] >> 3);
+            lo[i] = std::min<T>(x[i], y[i]);
+            hi[i] = std::max<T>(x[i], y[i]);
+        }
+        COMPARE(x + y, sum) << x << " + " << y;
+        COMPARE(x - y, diff) << x << " - " << y;
+        COMPARE(x * y, prod) << x << " * " << y;
+        if (std::is_signed<T>::value) {
+            // -128 / -1 overflows
+            const auto overflow = (x == std::numeric_limits<T>::min()) && (y == T(-1));
+            V q = x / y;
+            where(overflow) | q = quot;
+            COMPARE(q, quot) << x << " / " << y;
+        } else {
+            COMPARE(x / y, quot) << x << " / " << y;
+        }
+        COMPARE(x << 3, shl) << x;
+        COMPARE(x >> 3, shr) << x;
+        COMPARE(min(x, y), lo);
+        COMPARE(max(x, y), hi);
+
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((x == y)[i], x[i] == y[i]);
+            COMPARE((x != y)[i], x[i] != y[i]);
+            COMPARE((x < y)[i], x[i] < y[i]);
+            COMPARE((x <= y)[i], x[i] <= y[i]);
+            COMPARE((x > y)[i], x[i] > y[i]);
+            COMPARE((x >= y)[i], x[i] >= y[i]);
+        }
+        T ref = x[0];
+        for (size_t i = 1; i < V::Size; ++i) {
+            ref = std::max(ref, T(x[i]));
+        }
+        COMPARE(x.max(), ref);
+    }
+}
+
+TEST_TYPES(V, testCharMemory, concat<CharVectors, CharSimdArrays<19>>)
+{
+    using T = typename V::EntryType;
+    alignas(64) T mem[2 * V::Size];
+    for (size_t i = 0; i < 2 * V::Size; ++i) {
+        mem[i] = T(i * 7 + 3);
+    }
+    V x(&mem[0], Vc::Aligned);
+    V y(&mem[1], Vc::Unaligned);
+    const V iota = V::IndexesFromZero();
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(x[i], mem[i]);
+        COMPARE(y[i], mem[i + 1]);
+        COMPARE(iota[i], T(i));
+    }
+    COMPARE(x.reversed(), V([&](int i) { return mem[V::Size - 1 - i]; }));
+    COMPARE(x.shifted(1), V([&](int i) { return i + 1 < int(V::Size) ? mem[i + 1] : T(); }));
+    for (int n : {1, 3, 20}) {
+        COMPARE(x.rotated(n), V([&](int i) { return mem[(i + n) % V::Size]; })) << n;
+    }
+    using I = typename V::IndexType;
+    const V gathered(mem, I([](int i) { return int(V::Size) - 1 - i; }));
+    COMPARE(gathered, x.reversed());
+    COMPARE(x.interleaveLow(y),
+            V([&](int i) { return i % 2 ? mem[i / 2 + 1] : mem[i / 2]; }));
+
+    const auto odd = (iota & 1) == 1;
+    COMPARE(odd.count(), int(V::Size / 2));
+    x(odd) = V::Zero();
+    x.store(&mem[V::Size], Vc::Unaligned);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(mem[V::Size + i], i % 2 ? T(0) : mem[i]);
+    }
+    y.setZero(!odd);
+    y.store(&mem[0], odd, Vc::Aligned);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(mem[i], T(i % 2 ? (i + 1) * 7 + 3 : i * 7 + 3));
+    }
+}
+
+template <class V> V saturate(long long x)
+{
+    using T = typename V::EntryType;
+    return V(T(std::max<long long>(std::numeric_limits<T>::min(),
+                                   std::min<long long>(std::numeric_limits<T>::max(), x))));
+}
+
+TEST_TYPES(V, testSaturatingArithmetics,
+           concat<CharVectors, CharSimdArrays<19>, IntVectors, IntSimdArrays<13>>)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    const V vmax = L::max();
+    const V vmin = L::min();
+    COMPARE(add_sat(vmax, V(1)), vmax);
+    COMPARE(sub_sat(vmin, V(1)), vmin);
+    COMPARE(add_sat(vmax, vmax), vmax);
+    COMPARE(sub_sat(vmin, vmax), vmin);
+    COMPARE(add_sat(vmin, vmax), V(T(L::min() + L::max())));
+    if (std::is_signed<T>::value) {
+        COMPARE(add_sat(vmin, vmin), vmin);
+        COMPARE(sub_sat(vmax, vmin), vmax);
+    }
+
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V x = V::Random();
+        const V y = V::Random();
+        V sum, diff;
+        for (size_t i = 0; i < V::Size; ++i) {
+            sum[i] = saturate<V>(static_cast<long long>(x[i]) + y[i])[0];
+            diff[i] = saturate<V>(static_cast<long long>(x[i]) - y[i])[0];
+        }
+        COMPARE(add_sat(x, y), sum) << x << " + " << y;
+        COMPARE(sub_sat(x, y), diff) << x << " - " << y;
+    }
+}
+
+template <class To, class From> void testCharCastsImpl()
+{
+    using T = typename From::EntryType;
+    using U = typename To::EntryType;
+    for (int repetition = 0; repetition < 100; ++repetition) {
+        const From x = randomChars<From>();
+        const To wide = simd_cast<To>(x);
+        for (size_t i = 0; i < std::min(From::Size, To::Size); ++i) {
+            COMPARE(wide[i], U(x[i])) << x;
+        }
+        const From narrow = simd_cast<From>(wide);
+        for (size_t i = 0; i < std::min(From::Size, To::Size); ++i) {
+            COMPARE(narrow[i], x[i]) << wide;
+        }
+        for (size_t i = To::Size; i < From::Size; ++i) {
+            COMPARE(narrow[i], T(0)) << wide;
+        }
+    }
+}
+
+TEST_TYPES(V, testCharCasts, concat<CharVectors, CharSimdArrays<16>, CharSimdArrays<32>>)
+{
+    using T = typename V::EntryType;
+    testCharCastsImpl<Vc::native_simd<short>, V>();
+    testCharCastsImpl<Vc::native_simd<unsigned short>, V>();
+    testCharCastsImpl<Vc::native_simd<int>, V>();
+    testCharCastsImpl<Vc::native_simd<unsigned int>, V>();
+    testCharCastsImpl<Vc::fixed_size_simd<short, V::Size>, V>();
+    testCharCastsImpl<Vc::fixed_size_simd<int, V::Size>, V>();
+
+    // int -> char truncates modulo 2^8
+    using I = Vc::fixed_size_simd<int, V::Size>;
+    const I wide = I([](int i) { return i * 37 - 300; });
+    const V narrow = simd_cast<V>(wide);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(narrow[i], T(wide[i]));
+    }
+    COMPARE(simd_cast<I>(narrow), I([&](int i) { return int(T(wide[i])); }));
+}
+
+// 64-bit integer vectors {{{1
+template <class V> V randomLLongs()
+{
+    using T = typename V::EntryType;
+    return V([](int) {
+        return static_cast<T>((static_cast<unsigned long long>(std::rand()) << 42) ^
+                              (static_cast<unsigned long long>(std::rand()) << 21) ^
+                              static_cast<unsigned long long>(std::rand()));
+    });
+}
+
+TEST_TYPES(V, testLLongArithmetics,
+           concat<LLongVectors, vir::Typelist<Vc::fixed_size_simd<long long, 7>>>)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V x = randomLLongs<V>();
+        V y = randomLLongs<V>();
+        where(y == 0) | y = 1;
+        if (repetition % 3 == 0) {
+            // small divisors and values with equal high halves exercise more edge cases
+            y = y >> 40;
+            where(y == 0) | y = 3;
+        }
+        V sum, diff, prod, quot, shl, shr, lo, hi;
+        for (size_t i = 0; i < V::Size; ++i) {
+            sum[i] = T(x[i] + y[i]);
+            diff[i] = T(x[i] - y[i]);
+            prod[i] = T(static_cast<unsigned long long>(x[i]) *
+                        static_cast<unsigned long long>(y[i]));
+            quot[i] = T(x[i] / y[i]);
+            shl[i] = T(x[i] << 13);
+            shr[i] = T(x[i] >> 13);
+            lo[i] = std::min<T>(x[i], y[i]);
+            hi[i] = std::max<T>(x[i], y[i]);
+        }
+        COMPARE(x + y, sum) << x << " + " << y;
+        COMPARE(x - y, diff) << x << " - " << y;
+        COMPARE(x * y, prod) << x << " * " << y;
+        COMPARE(x / y, quot) << x << " / " << y;
+        COMPARE(x << 13, shl) << x;
+        COMPARE(x >> 13, shr) << x;
+        COMPARE(min(x, y), lo);
+        COMPARE(max(x, y), hi);
+
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((x == y)[i], x[i] == y[i]);
+            COMPARE((x != y)[i], x[i] != y[i]);
+            COMPARE((x < y)[i], x[i] < y[i]);
+            COMPARE((x <= y)[i], x[i] <= y[i]);
+            COMPARE((x > y)[i], x[i] > y[i]);
+            COMPARE((x >= y)[i], x[i] >= y[i]);
+        }
+        T ref = x[0];
+        for (size_t i = 1; i < V::Size; ++i) {
+            ref = std::min(ref, T(x[i]));
+        }
+        COMPARE(x.min(), ref);
+    }
+}
+
+TEST_TYPES(V, testLLongConversions, LLongVectors)
+{
+    using T = typename V::EntryType;
+    using D = Vc::fixed_size_simd<double, V::Size>;
+    using I = Vc::fixed_size_simd<int, V::Size>;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V x = randomLLongs<V>() >> (repetition % 64);
+        const D d = simd_cast<D>(x);
+        const I n = simd_cast<I>(x);
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE(d[i], static_cast<double>(x[i])) << x;
+            COMPARE(n[i], static_cast<int>(x[i])) << x;
+        }
+        const D dd = D([&](int i) { return std::ldexp(d[i], -12) + 0.75; });
+        COMPARE(simd_cast<V>(dd), V([&](int i) { return static_cast<T>(dd[i]); })) << dd;
+        const I ii = I([&](int i) { return n[i] >> 1; });
+        COMPARE(simd_cast<V>(ii), V([&](int i) { return static_cast<T>(ii[i]); })) << ii;
+    }
+}
+
+TEST_TYPES(V, testLLongGather, LLongVectors)
+{
+    using T = typename V::EntryType;
+    T mem[8 * V::Size];
+    for (size_t i = 0; i < 8 * V::Size; ++i) {
+        mem[i] = T(i * 0x100000001ull + 3);
+    }
+    const V reference([&](int i) { return mem[3 * i + 1]; });
+    COMPARE(V(mem, typename V::IndexType([](int i) { return 3 * i + 1; })), reference);
+    const V indexes([](int i) { return 3 * i + 1; });
+    COMPARE(V(mem, indexes), reference);
+    COMPARE(V(mem, Vc::fixed_size_simd<long long, V::Size>(indexes)), reference);
+    V masked = V::Zero();
+    masked.gather(mem, indexes, (V::IndexesFromZero() & 1) == 1);
+    COMPARE(masked, V([&](int i) { return i & 1 ? mem[3 * i + 1] : T(); }));
+
+    double dmem[8 * V::Size];
+    for (size_t i = 0; i < 8 * V::Size; ++i) {
+        dmem[i] = i * 0.5;
+    }
+    using D = Vc::fixed_size_simd<double, V::Size>;
+    COMPARE(D(dmem, Vc::fixed_size_simd<long long, V::Size>(indexes)),
+            D([&](int i) { return dmem[3 * i + 1]; }));
+}
+
 // vim: foldmethod=marker
@@ -0,0 +1,77 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include "dispatchkernels.h"
+#include <algorithm>
+#include <vector>
+
+TEST(selectsBestVariant)
+{
+    using dispatchkernels::features;
+    const unsigned int f = features::call();
+    const Vc::Implementation impl = features::implementation();
+    COMPARE(f & Vc::ImplementationMask, unsigned(impl));
+    VERIFY(Vc::isImplementationSupported(impl));
+    VERIFY(impl <= Vc::bestImplementationSupported());
+    const unsigned int extra = f & Vc::ExtraInstructionsMask;
+    COMPARE(extra & Vc::extraInstructionsSupported(), extra);
+    // dispatchkernels.cpp is compiled for SSE2 and Scalar at least
+    if (Vc::isImplementationSupported(Vc::SSE2Impl)) {
+        VERIFY(impl >= Vc::SSE2Impl) << impl;
+    }
+    // the pointer is cached after the first call
+    VERIFY(features::get() == features::get());
+    COMPARE(features::call(), f);
+}
+
+TEST(callsVariant)
+{
+    float x[67], y[67];
+    for (int i = 0; i < 67; ++i) {
+        x[i] = i;
+        y[i] = 1;
+    }
+    dispatchkernels::saxpy::call(2.f, x, y, 67);
+    for (int i = 0; i < 67; ++i) {
+        COMPARE(y[i], 1.f + 2.f * i) << "i = " << i;
+    }
+}
+
+TEST(callsOutOfLineTemplates)
+{
+    std::vector<float> x(1000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = float((i * 7919) % 997);
+    }
+    std::vector<float> reference = x;
+    std::sort(reference.begin(), reference.end());
+    dispatchkernels::sort::call(x.data(), x.size());
+    COMPARE(x, reference);
+}
+
+// vim: foldmethod=marker
@@ -167,6 +167,38 @@ TEST_TYPES(Vec, gatherArray, ALL_TYPES)
     gatherArrayImpl<Vec, double>();
 }
 
+template <class Vec, class F> void gatherFloatStorage(std::uint16_t maxFinite)
+{
+    using It = typename Vec::IndexType;
+    const int count = 4099;
+    F array[count];
+    for (int i = 0; i < count; ++i) {
+        // finite values of both signs, including subnormals
+        array[i] = F::fromBits(
+            static_cast<std::uint16_t>((i * 0x3fd) % maxFinite | ((i & 1) << 15)));
+    }
+    for (It i([](int n) { return n * 7; }); all_of(i < count); i += 1) {
+        const Vec ref([&](int n) { return float(array[i[n]]); });
+        COMPARE(Vec(array, i), ref) << "\ni: " << i;
+        const auto mask = ref > 0.f;
+        Vec b(-1.f);
+        b.gather(array, i, mask);
+        COMPARE(b, iif(mask, ref, Vec(-1.f))) << "\ni: " << i;
+    }
+}
+
+TEST_TYPES(Vec, gatherFloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    gatherFloatStorage<Vec, float16>(0x7c00);
+}
+
+TEST_TYPES(Vec, gatherBfloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    gatherFloatStorage<Vec, bfloat16>(0x7f80);
+}
+
 template <typename T, size_t Align = std::is_arithmetic<T>::value ? sizeof(T) : alignof(T)>
 struct alignas(Align > alignof(short) ? Align : alignof(short)) Struct
 {
@@ -297,3 +329,37 @@ TEST_TYPES(Vec, gather2dim, ALL_TYPES)
         }
     }
 }
+
+#ifndef Vc_IMPL_Scalar
+TEST_TYPES(Vec, gatherStrategies, AllVectors)
+{
+    typedef typename Vec::IndexType It;
+    typedef typename Vec::EntryType T;
+    using Vc::Common::GatherScatterImplementation;
+
+    T mem[Vec::Size];
+    for (size_t i = 0; i < Vec::Size; ++i) {
+        mem[i] = i + 1;
+    }
+    const It indexes = It([](int n) { return int(Vec::Size) - 1 - n; });
+    const GatherScatterImplementation strategies[] = {
+        GatherScatterImplementation::SimpleLoop, GatherScatterImplementation::BitScanLoop,
+        GatherScatterImplementation::PopcntSwitch, GatherScatterImplementation::Hardware};
+    for (auto impl : strategies) {
+        for_all_masks(Vec, m) {
+            const T x = Vec::Size + 1;
+            Vec a = x;
+            Vc::Common::executeGather(impl, a, mem, indexes, m);
+            for (size_t i = 0; i < Vec::Size; ++i) {
+                COMPARE(a[i], m[i] ? mem[Vec::Size - 1 - i] : x)
+                    << " i = " << i << ", m = " << m << ", impl = " << int(impl);
+            }
+        }
+    }
+#if defined Vc_IMPL_AVX2 && !defined Vc_MSVC
+    const auto selected = Vc::Detail::runtimeGatherImplementation();
+    VERIFY(selected != GatherScatterImplementation::SetIndexZero);
+    VERIFY(Vc::Detail::runtimeGatherImplementation() == selected);
+#endif
+}
+#endif  // Vc_IMPL_Scalar
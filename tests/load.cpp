@@ -220,3 +220,59 @@ TEST_TYPES(
         }
     }
 }
+
+template <class Vec, class F> void loadFloatStorage()
+{
+    // every bit pattern, twice, so that each one is seen by every vector lane
+    constexpr size_t Count = 2 * 65536;
+    F *data = Vc::malloc<F, Vc::AlignOnCacheline>(Count);
+    for (size_t i = 0; i < Count; ++i) {
+        // interleave signs and magnitudes
+        data[i] = F::fromBits(static_cast<std::uint16_t>(i * 0x8001u));
+    }
+    const bool canAlign = (Vec::size() & (Vec::size() - 1)) == 0;
+    for (size_t i = 0; i < Count - Vec::Size + 1; ++i) {
+        Vec v;
+        if (canAlign && i % Vec::Size == 0) {
+            v = Vec(&data[i], Vc::Aligned);
+        } else if (i % 3 == 0) {
+            v = Vec(&data[i], Vc::Streaming | Vc::Unaligned);
+        } else if (i % 5 == 0) {
+            Vc::load_interleaved(v, &data[i]);
+        } else {
+            v = Vec(&data[i], Vc::Unaligned);
+        }
+        for (size_t j = 0; j < Vec::Size; ++j) {
+            const float ref = data[i + j];
+            if (std::isnan(ref)) {
+                VERIFY(std::isnan(v[j])) << "bits: " << data[i + j].toBits();
+            } else {
+                COMPARE(v[j], ref) << "bits: " << data[i + j].toBits();
+            }
+        }
+    }
+    Vc::free(data);
+}
+
+TEST_TYPES(Vec, loadFloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    COMPARE(float(float16::fromBits(0x3c00)), 1.f);
+    COMPARE(float(float16::fromBits(0xc000)), -2.f);
+    COMPARE(float(float16::fromBits(0x7bff)), 65504.f);
+    COMPARE(float(float16::fromBits(0x0001)), std::ldexp(1.f, -24));
+    COMPARE(float(float16::fromBits(0x7c00)), std::numeric_limits<float>::infinity());
+    VERIFY(std::isnan(float(float16::fromBits(0x7e00))));
+    loadFloatStorage<Vec, float16>();
+}
+
+TEST_TYPES(Vec, loadBfloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    COMPARE(float(bfloat16::fromBits(0x3f80)), 1.f);
+    COMPARE(float(bfloat16::fromBits(0xc000)), -2.f);
+    COMPARE(float(bfloat16::fromBits(0x0001)), std::ldexp(1.f, -133));
+    COMPARE(float(bfloat16::fromBits(0x7f80)), std::numeric_limits<float>::infinity());
+    VERIFY(std::isnan(float(bfloat16::fromBits(0x7fc0))));
+    loadFloatStorage<Vec, bfloat16>();
+}
@@ -89,11 +89,7 @@ TEST_TYPES(V, testLog, RealTypes) //{{{1
 
 TEST_TYPES(V, testLog2, RealTypes) //{{{1
 {
-#if defined(Vc_LOG_ILP) || defined(Vc_LOG_ILP2)
-    setFuzzyness<float>(3);
-#else
     setFuzzyness<float>(1);
-#endif
     setFuzzyness<double>(1);
 #if defined(Vc_MSVC) || defined(__APPLE__)
     if (Vc::Scalar::is_vector<V>::value || !Vc::Traits::isAtomicSimdArray<V>::value) {
@@ -140,5 +136,31 @@ TEST_TYPES(V, testLog10, RealTypes) //{{{1
     });
 }
 
+TEST_TYPES(V, testLog1p, RealTypes) //{{{1
+{
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(1000) - T(1);
+        const V ref = x.apply([](T _x) { return std::log1p(_x); });
+        FUZZY_COMPARE(Vc::log1p(x), ref) << " x = " << x << ", i = " << i;
+    }
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // small x must not suffer from cancellation in 1 + x
+        const V x = (V::Random() - T(0.5)) * T(1e-3);
+        const V ref = x.apply([](T _x) { return std::log1p(_x); });
+        FUZZY_COMPARE(Vc::log1p(x), ref) << " x = " << x << ", i = " << i;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::log1p(V(0)), V(0));
+    COMPARE(Vc::log1p(V(-1)), V(-inf));
+    COMPARE(Vc::log1p(V(inf)), V(inf));
+    VERIFY(all_of(isnan(Vc::log1p(V(T(-2))))));
+    VERIFY(all_of(isnan(Vc::log1p(V(std::numeric_limits<T>::quiet_NaN())))));
+    testAllDenormals<V>([](const V x) { COMPARE(Vc::log1p(x), x); });
+}
+
 //}}}1
 // vim: foldmethod=marker
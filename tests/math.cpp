@@ -123,6 +123,492 @@ TEST_TYPES(V, testExp, RealTypes) //{{{1
     COMPARE(Vc::exp(V(0)), V(1));
 }
 
+// exp2, expm1, exp10 {{{1
+/* Compares \p fun against \p reference for random x in [lo, hi], where the result is
+ * normal, and for random x in [subLo, subHi], where the result is subnormal. ULP
+ * differences are not meaningful for subnormals, there the results may differ by one
+ * denorm_min.
+ */
+template <typename V, typename F, typename R>
+void testExpRange(F &&fun, R &&reference, typename V::EntryType subLo,
+                  typename V::EntryType subHi, typename V::EntryType lo,
+                  typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        FUZZY_COMPARE(fun(x), x.apply(reference)) << ", x = " << x << ", i = " << i;
+    }
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V x = V::Random() * (subHi - subLo) + subLo;
+        const V ref = x.apply(reference);
+        VERIFY(all_of(abs(fun(x) - ref) <= std::numeric_limits<T>::denorm_min()))
+            << "x = " << x << ", ref = " << ref << ", fun(x) = " << fun(x);
+    }
+}
+
+template <typename V, typename F> void testExpSpecialValues(F &&fun, bool minusOne)
+{
+    typedef typename V::EntryType T;
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(inf)), V(inf));
+    COMPARE(fun(V(std::numeric_limits<T>::max())), V(inf));
+    COMPARE(fun(V(-inf)), V(minusOne ? T(-1) : T(0)));
+    COMPARE(fun(V(std::numeric_limits<T>::lowest())), V(minusOne ? T(-1) : T(0)));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testExpLimits, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    testExpRange<V>([](const V &x) { return Vc::exp(x); },
+                    [](T x) { return std::exp(x); }, isFloat ? -103.f : -744.,
+                    isFloat ? -87.4f : -708.4, isFloat ? -87.3f : -708.3,
+                    isFloat ? 88.f : 709.);
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp(x); }, false);
+}
+
+TEST_TYPES(V, testExp2, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    testExpRange<V>([](const V &x) { return Vc::exp2(x); },
+                    [](T x) { return std::exp2(x); }, isFloat ? -149.f : -1074.,
+                    isFloat ? -126.1f : -1022.1, isFloat ? -126.f : -1022.,
+                    isFloat ? 127.9f : 1023.9);
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp2(x); }, false);
+    for (int i = -20; i < 20; ++i) {
+        COMPARE(Vc::exp2(V(T(i))), V(std::ldexp(T(1), i)));
+    }
+}
+
+TEST_TYPES(V, testExpm1, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto fun = [](const V &x) { return Vc::expm1(x); };
+    const auto reference = [](T x) { return std::expm1(x); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(isFloat ? 106 : 750) - T(isFloat ? 18 : 40);
+        FUZZY_COMPARE(fun(x), x.apply(reference)) << ", x = " << x << ", i = " << i;
+    }
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // small x must not suffer from cancellation
+        const V x = (V::Random() - T(0.5)) * T(1e-4);
+        FUZZY_COMPARE(fun(x), x.apply(reference)) << ", x = " << x << ", i = " << i;
+    }
+    testExpSpecialValues<V>(fun, true);
+    COMPARE(fun(V(T(-50))), V(T(-1)));
+    COMPARE(fun(V(std::numeric_limits<T>::denorm_min())),
+            V(std::numeric_limits<T>::denorm_min()));
+}
+
+TEST_TYPES(V, testExp10, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    testExpRange<V>([](const V &x) { return Vc::exp10(x); },
+                    [](T x) { return std::pow(T(10), x); }, isFloat ? -44.8f : -323.,
+                    isFloat ? -38.f : -307.7, isFloat ? -37.9f : -307.6,
+                    isFloat ? 38.5f : 308.2);
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp10(x); }, false);
+    for (int i = 0; i < (isFloat ? 10 : 22); ++i) {
+        COMPARE(Vc::exp10(V(T(i))), V(std::pow(T(10), T(i))));
+    }
+}
+
+TEST_TYPES(V, testPow, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    const auto reference = [](T x, T y) { return std::pow(x, y); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // |y · ln(x)| < 625 keeps the results normal
+        const V x = V::Random() * T(7.875) + T(0.125);
+        const V y = (V::Random() - T(0.5)) * T(isFloat ? 60 : 600);
+        V ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            ref[j] = reference(x[j], y[j]);
+        }
+        FUZZY_COMPARE(Vc::pow(x, y), ref) << ", x = " << x << ", y = " << y << ", i = " << i;
+    }
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // results far from 1 for x close to 1 need the extra precision of ln(x)
+        const V x = V::Random() * T(0.02) + T(0.99);
+        const V y = (V::Random() - T(0.5)) * T(isFloat ? 16000 : 120000);
+        V ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            ref[j] = reference(x[j], y[j]);
+        }
+        FUZZY_COMPARE(Vc::pow(x, y), ref) << ", x = " << x << ", y = " << y << ", i = " << i;
+    }
+
+    // C99 Annex F
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T special[] = {T(0),  T(-0.), T(0.5), T(-0.5), T(1),  T(-1),
+                         T(2),  T(-2),  T(3),   T(-3),   T(1.5), T(-1.5),
+                         inf,   -inf,   nan,    std::numeric_limits<T>::max(),
+                         std::numeric_limits<T>::denorm_min()};
+    for (T x : special) {
+        for (T y : special) {
+            const T ref = reference(x, y);
+            const V r = Vc::pow(V(x), V(y));
+            if (std::isnan(ref)) {
+                VERIFY(all_of(isnan(r))) << "x = " << x << ", y = " << y << ": " << r;
+            } else {
+                FUZZY_COMPARE(r, V(ref)) << "x = " << x << ", y = " << y;
+                COMPARE(isnegative(r), isnegative(V(ref))) << "x = " << x << ", y = " << y;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, testCbrt, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(3);  // the Scalar implementation uses glibc's cbrt
+    const T max = std::numeric_limits<T>::max_exponent;
+    const T min = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // x = ±2^e with e uniformly distributed over all finite exponents
+        const V x = copysign(Vc::exp2(V::Random() * (max - min) + min), V::Random() - T(0.5));
+        // the double overload of glibc's cbrt is not precise enough as reference
+        FUZZY_COMPARE(Vc::cbrt(x),
+                      x.apply([](T _x) { return T(std::cbrt(static_cast<long double>(_x))); }))
+            << ", x = " << x << ", i = " << i;
+    }
+    for (int i = -20; i <= 20; ++i) {
+        FUZZY_COMPARE(Vc::cbrt(V(T(i * i * i))), V(T(i)));
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::cbrt(V(inf)), V(inf));
+    COMPARE(Vc::cbrt(V(-inf)), V(-inf));
+    VERIFY(isnegative(Vc::cbrt(V(T(-0.)))).isFull());
+    VERIFY(all_of(isnan(Vc::cbrt(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testHypot, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const auto reference = [](T x, T y) { return std::hypot(x, y); };
+    // magnitudes close to overflow, ordinary ones, and ones whose squares are subnormal
+    for (T scale : {std::numeric_limits<T>::max() / T(4), T(10),
+                    std::numeric_limits<T>::min() * T(1024)}) {
+        for (size_t i = 0; i < 30000 / V::Size; ++i) {
+            const V x = (V::Random() - T(0.5)) * scale;
+            const V y = (V::Random() - T(0.5)) * scale;
+            V ref;
+            for (size_t j = 0; j < V::Size; ++j) {
+                ref[j] = reference(x[j], y[j]);
+            }
+            FUZZY_COMPARE(Vc::hypot(x, y), ref) << ", x = " << x << ", y = " << y;
+        }
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    COMPARE(Vc::hypot(V(T(3)), V(T(-4))), V(T(5)));
+    COMPARE(Vc::hypot(V(std::numeric_limits<T>::max()), V(T(1))),
+            V(std::numeric_limits<T>::max()));
+    COMPARE(Vc::hypot(V(inf), V(nan)), V(inf));
+    COMPARE(Vc::hypot(V(nan), V(-inf)), V(inf));
+    VERIFY(all_of(isnan(Vc::hypot(V(nan), V(T(1))))));
+}
+
+// compareToReference {{{1
+/* Compares fun(x) for uniformly distributed x in [lo, hi[ against reference, which is
+ * evaluated in long double because the glibc implementations are off by a few ulp.
+ */
+template <typename V, typename F, typename R>
+static void compareToReference(F &&fun, R &&reference, typename V::EntryType lo,
+                               typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        FUZZY_COMPARE(fun(x), x.apply([&](T _x) {
+            return T(reference(static_cast<long double>(_x)));
+        })) << ", x = " << x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testTanh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const auto reference = [](long double x) { return std::tanh(x); };
+    const auto fast = [](const V &x) { return Vc::tanh(x, Precision::Fast); };
+    const auto accurate = [](const V &x) { return Vc::tanh(x, Precision::Accurate); };
+    for (T range : {T(0.01), T(1), T(22)}) {
+        setFuzzyness<float>(6);
+        setFuzzyness<double>(3);
+        compareToReference<V>(fast, reference, -range, range);
+        setFuzzyness<float>(1);
+        setFuzzyness<double>(2);
+        compareToReference<V>(accurate, reference, -range, range);
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::tanh(V(inf)), V(T(1)));
+    COMPARE(Vc::tanh(V(-inf)), V(T(-1)));
+    COMPARE(Vc::tanh(V(-inf), Precision::Fast), V(T(-1)));
+    VERIFY(isnegative(Vc::tanh(V(T(-0.)))).isFull());
+    VERIFY(all_of(isnan(Vc::tanh(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testSigmoid, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    const auto reference = [](long double x) { return 1 / (1 + std::exp(-x)); };
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(3);
+    // the fast implementation flushes results below the normal range to zero
+    compareToReference<V>([](const V &x) { return Vc::sigmoid(x, Precision::Fast); },
+                          reference, T(isFloat ? -87 : -708), T(40));
+    setFuzzyness<float>(1);
+    compareToReference<V>([](const V &x) { return Vc::sigmoid(x); }, reference,
+                          T(isFloat ? -87 : -708), T(40));
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::sigmoid(V(inf)), V(T(1)));
+    COMPARE(Vc::sigmoid(V(-inf)), V(T(0)));
+    COMPARE(Vc::sigmoid(V(T(0))), V(T(0.5)));
+    COMPARE(Vc::sigmoid(V(-inf), Precision::Fast), V(T(0)));
+}
+
+TEST_TYPES(V, testErf, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const auto reference = [](long double x) { return std::erf(x); };
+    const auto fast = [](const V &x) { return Vc::erf(x, Precision::Fast); };
+    const auto accurate = [](const V &x) { return Vc::erf(x, Precision::Accurate); };
+    for (T range : {T(0.01), T(1), T(7)}) {
+        setFuzzyness<float>(7);
+        setFuzzyness<double>(2);
+        compareToReference<V>(fast, reference, -range, range);
+        setFuzzyness<float>(1);
+        compareToReference<V>(accurate, reference, -range, range);
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erf(V(inf)), V(T(1)));
+    COMPARE(Vc::erf(V(-inf)), V(T(-1)));
+    COMPARE(Vc::erf(V(-inf), Precision::Fast), V(T(-1)));
+    VERIFY(isnegative(Vc::erf(V(T(-0.)))).isFull());
+    VERIFY(all_of(isnan(Vc::erf(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testErfc, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const auto reference = [](long double x) { return std::erfc(x); };
+    const auto fast = [](const V &x) { return Vc::erfc(x, Precision::Fast); };
+    const auto accurate = [](const V &x) { return Vc::erfc(x, Precision::Accurate); };
+    // up to the end of the normal range of the result
+    const T max = std::is_same<T, float>::value ? T(9.1) : T(26.5);
+    for (T lo : {T(-3), T(0.5), T(4)}) {
+        setFuzzyness<float>(7);
+        setFuzzyness<double>(7);
+        compareToReference<V>(fast, reference, lo, max);
+        setFuzzyness<float>(1);
+        setFuzzyness<double>(4);
+        compareToReference<V>(accurate, reference, lo, max);
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erfc(V(inf)), V(T(0)));
+    COMPARE(Vc::erfc(V(-inf)), V(T(2)));
+    COMPARE(Vc::erfc(V(inf), Precision::Fast), V(T(0)));
+    COMPARE(Vc::erfc(V(T(0))), V(T(1)));
+    VERIFY(all_of(isnan(Vc::erfc(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testSinCosTiers, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    const auto sinRef = [](long double x) { return std::sin(x); };
+    const auto cosRef = [](long double x) { return std::cos(x); };
+    for (T range : {T(1), T(100), T(isFloat ? 39000 : 1e5)}) {
+        setFuzzyness<float>(3);
+        setFuzzyness<double>(3);
+        compareToReference<V>([](const V &x) { return Vc::sin(x, Precision::Fast); },
+                              sinRef, -range, range);
+        compareToReference<V>([](const V &x) { return Vc::cos(x, Precision::Fast); },
+                              cosRef, -range, range);
+        setFuzzyness<float>(1);
+        setFuzzyness<double>(2);
+        compareToReference<V>([](const V &x) { return Vc::sin(x, Precision::Accurate); },
+                              sinRef, -range, range);
+        compareToReference<V>([](const V &x) { return Vc::cos(x, Precision::Accurate); },
+                              cosRef, -range, range);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(1000);
+        V s, c;
+        Vc::sincos(x, &s, &c, Precision::Fast);
+        COMPARE(s, Vc::sin(x, Precision::Fast)) << "x = " << x;
+        COMPARE(c, Vc::cos(x, Precision::Fast)) << "x = " << x;
+        Vc::sincos(x, &s, &c, Precision::Accurate);
+        COMPARE(s, Vc::sin(x, Precision::Accurate)) << "x = " << x;
+        COMPARE(c, Vc::cos(x, Precision::Accurate)) << "x = " << x;
+        COMPARE(Vc::sin(x, Precision::Default), Vc::sin(x)) << "x = " << x;
+        COMPARE(Vc::cos(x, Precision::Default), Vc::cos(x)) << "x = " << x;
+    }
+    VERIFY(isnegative(Vc::sin(V(T(-0.)), Precision::Fast)).isFull());
+    COMPARE(Vc::cos(V(T(0)), Precision::Fast), V(T(1)));
+}
+
+TEST_TYPES(V, testExpTiers, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const bool isFloat = std::is_same<T, float>::value;
+    // the fast implementations flush results below 2⁻¹²⁵ (float) and 2⁻¹⁰²¹ (double) to
+    // zero
+    const T lo = T(isFloat ? -86 : -707);
+    const T hi = T(isFloat ? 88 : 709);
+    const T lo2 = T(isFloat ? -125 : -1021);
+    const T hi2 = T(isFloat ? 127.9 : 1023.9);
+    const T lo10 = T(isFloat ? -37.6 : -307);
+    const T hi10 = T(isFloat ? 38.5 : 308.2);
+    const auto expRef = [](long double x) { return std::exp(x); };
+    const auto exp2Ref = [](long double x) { return std::exp2(x); };
+    const auto exp10Ref = [](long double x) { return std::pow(10.L, x); };
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(4);
+    compareToReference<V>([](const V &x) { return Vc::exp(x, Precision::Fast); }, expRef,
+                          lo, hi);
+    compareToReference<V>([](const V &x) { return Vc::exp2(x, Precision::Fast); },
+                          exp2Ref, lo2, hi2);
+    compareToReference<V>([](const V &x) { return Vc::exp10(x, Precision::Fast); },
+                          exp10Ref, lo10, hi10);
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    compareToReference<V>([](const V &x) { return Vc::exp(x, Precision::Accurate); },
+                          expRef, lo, hi);
+    compareToReference<V>([](const V &x) { return Vc::exp2(x, Precision::Accurate); },
+                          exp2Ref, lo2, hi2);
+    compareToReference<V>([](const V &x) { return Vc::exp10(x, Precision::Accurate); },
+                          exp10Ref, lo10, hi10);
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::exp(V(inf), Precision::Fast), V(inf));
+    COMPARE(Vc::exp(V(-inf), Precision::Fast), V(T(0)));
+    COMPARE(Vc::exp(V(T(0)), Precision::Fast), V(T(1)));
+    COMPARE(Vc::exp2(V(T(10)), Precision::Fast), V(T(1024)));
+    COMPARE(Vc::exp2(V(-inf), Precision::Fast), V(T(0)));
+    COMPARE(Vc::exp10(V(inf), Precision::Fast), V(inf));
+    const V nan = std::numeric_limits<T>::quiet_NaN();
+    VERIFY(all_of(isnan(Vc::exp(nan, Precision::Fast))));
+    const V x = V::Random() * T(20) - T(10);
+    COMPARE(Vc::exp(x, Precision::Default), Vc::exp(x));
+    COMPARE(Vc::expm1(x, Precision::Fast), Vc::expm1(x));
+}
+
+TEST_TYPES(V, testLogTiers, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const auto logRef = [](long double x) { return std::log(x); };
+    const auto log2Ref = [](long double x) { return std::log2(x); };
+    const auto log10Ref = [](long double x) { return std::log10(x); };
+    const auto logFast = [](const V &x) { return Vc::log(x, Precision::Fast); };
+    const auto log2Fast = [](const V &x) { return Vc::log2(x, Precision::Fast); };
+    const auto log10Fast = [](const V &x) { return Vc::log10(x, Precision::Fast); };
+    const auto logAcc = [](const V &x) { return Vc::log(x, Precision::Accurate); };
+    const auto log2Acc = [](const V &x) { return Vc::log2(x, Precision::Accurate); };
+    const auto log10Acc = [](const V &x) { return Vc::log10(x, Precision::Accurate); };
+    for (T lo : {T(1e-30), T(0.5), T(1000)}) {
+        const T hi = lo * T(2000);
+        setFuzzyness<float>(2);
+        setFuzzyness<double>(2);
+        compareToReference<V>(logFast, logRef, lo, hi);
+        setFuzzyness<float>(3);
+        compareToReference<V>(log2Fast, log2Ref, lo, hi);
+        compareToReference<V>(log10Fast, log10Ref, lo, hi);
+        setFuzzyness<float>(1);
+        compareToReference<V>(logAcc, logRef, lo, hi);
+        compareToReference<V>(log2Acc, log2Ref, lo, hi);
+        compareToReference<V>(log10Acc, log10Ref, lo, hi);
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::log(V(T(0)), Precision::Fast), V(-inf));
+    COMPARE(Vc::log(V(T(1)), Precision::Fast), V(T(0)));
+    COMPARE(Vc::log2(V(T(1024)), Precision::Fast), V(T(10)));
+    VERIFY(all_of(isnan(Vc::log(V(T(-1)), Precision::Fast))));
+    const V x = V::Random() + T(0.5);
+    COMPARE(Vc::log(x, Precision::Default), Vc::log(x));
+    COMPARE(Vc::log1p(x, Precision::Fast), Vc::log1p(x));
+}
+
+TEST_TYPES(V, testPolynomial, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    // with small integers every scheme is exact
+    for (const V &x : {V::generate([](int i) { return T(i % 7 - 3); }), V(T(3))}) {
+        const V ref = x.apply([](T y) {
+            return ((((((T(2) * y - 3) * y + 1) * y - 4) * y + 2) * y + 5) * y - 1) * y +
+                   3;
+        });
+        COMPARE(Vc::polynomial(x, 2, -3, 1, -4, 2, 5, -1, 3), ref) << ", x = " << x;
+        COMPARE(Vc::horner(x, 2, -3, 1, -4, 2, 5, -1, 3), ref) << ", x = " << x;
+        COMPARE(Vc::estrin(x, 2, -3, 1, -4, 2, 5, -1, 3), ref) << ", x = " << x;
+        COMPARE(Vc::polynomial(x, 2, -3, 1), (T(2) * x - T(3)) * x + T(1));
+        COMPARE(Vc::estrin(x, 2, -3, 1), (T(2) * x - T(3)) * x + T(1));
+        COMPARE(Vc::polynomial(x, 5), V(T(5)));
+    }
+
+    // eˣ up to x⁹, dominated by the lowest order terms
+    const T c[] = {T(1. / 362880), T(1. / 40320), T(1. / 5040), T(1. / 720), T(1. / 120),
+                   T(1. / 24),     T(1. / 6),     T(0.5),       T(1),         T(1)};
+    const auto ref = [&](long double x) {
+        long double r = 0;
+        for (T ci : c) {
+            r = r * x + ci;
+        }
+        return r;
+    };
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    compareToReference<V>(
+        [&](const V &x) {
+            return Vc::polynomial(x, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+                                  c[9]);
+        },
+        ref, T(-0.5), T(0.5));
+    compareToReference<V>(
+        [&](const V &x) {
+            return Vc::horner(x, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+                              c[9]);
+        },
+        ref, T(-0.5), T(0.5));
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(3);
+    compareToReference<V>(
+        [&](const V &x) {
+            return Vc::estrin(x, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+                              c[9]);
+        },
+        ref, T(-0.5), T(0.5));
+}
+
 TEST_TYPES(V, testMax, AllTypes) //{{{1
 {
     typedef typename V::EntryType T;
@@ -210,4 +210,43 @@ TEST_TYPES(Vec, scatterStruct2, AllTypes) //{{{1
         << array << '\n' << out;
 }
 
+TEST_TYPES(Vec, scatterReduce, AllVectors) //{{{1
+{
+    typedef typename Vec::EntryType T;
+    typedef typename Vec::IndexType It;
+    constexpr int count = 5;
+    for (int pattern = 0; pattern < 200; ++pattern) {
+        // few distinct indexes provoke many conflicts
+        const It idx = It([&](int n) { return (n * 7 + pattern * (n + 3)) % count; });
+        const Vec values = Vec([&](int n) { return T(n + 1); });
+        const auto mask = values > T(pattern % (Vec::Size + 1));
+
+        T sum[count], sumRef[count], low[count], lowRef[count];
+        for (int i = 0; i < count; ++i) {
+            sum[i] = sumRef[i] = T(i);
+            low[i] = lowRef[i] = T(100);
+        }
+        for (size_t n = 0; n < Vec::Size; ++n) {
+            if (mask[n]) {
+                sumRef[idx[n]] += values[n];
+                lowRef[idx[n]] = std::min<T>(lowRef[idx[n]], values[n]);
+            }
+        }
+        scatter_add(sum, idx, values, mask);
+        scatter_reduce(low, idx, values, mask, Vc::Minimum());
+        for (int i = 0; i < count; ++i) {
+            COMPARE(sum[i], sumRef[i]) << "i: " << i << ", idx: " << idx << ", m: " << mask;
+            COMPARE(low[i], lowRef[i]) << "i: " << i << ", idx: " << idx << ", m: " << mask;
+        }
+
+        scatter_reduce(sum, idx, values, std::plus<T>());
+        for (size_t n = 0; n < Vec::Size; ++n) {
+            sumRef[idx[n]] += values[n];
+        }
+        for (int i = 0; i < count; ++i) {
+            COMPARE(sum[i], sumRef[i]) << "i: " << i << ", idx: " << idx;
+        }
+    }
+}
+
 // vim: foldmethod=marker
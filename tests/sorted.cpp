@@ -89,4 +89,155 @@ TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, Simd
     }
 }
 
+TEST_TYPES(Vec, simdSort, AllVectors)
+{
+    typedef typename Vec::EntryType T;
+    const std::size_t sizes[] = {0,
+                                 1,
+                                 2,
+                                 Vec::Size + 1,
+                                 3 * Vec::Size - 1,
+                                 64 * Vec::Size,
+                                 64 * Vec::Size + 1,
+                                 129 * Vec::Size + 3,
+                                 10000,
+                                 100003};
+    for (std::size_t size : sizes) {
+        std::vector<T> data(size);
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            for (std::size_t i = 0; i < size; i += Vec::Size) {
+                const Vec r = Vec::Random();
+                for (std::size_t j = 0; j < Vec::Size && i + j < size; ++j) {
+                    // random, few distinct values, all equal, ascending and
+                    // descending runs
+                    const T values[5] = {T(r[j]), T((i + j) * 7919 % 5), T(1),
+                                         T((i + j) % 100), T((size - i - j) % 100)};
+                    data[i + j] = values[pattern];
+                }
+            }
+            std::vector<T> reference = data;
+            std::sort(reference.begin(), reference.end());
+            Vc::simd_sort(data.begin(), data.end());
+            VERIFY(data == reference) << "size: " << size << ", pattern: " << pattern;
+        }
+    }
+}
+
+TEST_TYPES(Vec, argsorted, concat<AllVectors, SimdArrays<8>, SimdArrays<3>>)
+{
+    typedef typename Vec::IndexType I;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        Vec test = Vec::Random();
+        if (repetition % 2 == 0) {
+            // many equal entries
+            const Vec copy = test;
+            test = Vec([&](int i) { return typename Vec::EntryType(copy[i & 1]); });
+        }
+        const I perm = Vc::argsorted(test);
+        const Vec sorted = test.sorted();
+        for (std::size_t i = 0; i < Vec::Size; ++i) {
+            COMPARE(test[perm[i]], sorted[i]) << "test: " << test << ", perm: " << perm;
+            // equal entries keep their order
+            if (i > 0 && sorted[i] == sorted[i - 1]) {
+                VERIFY(perm[i] > perm[i - 1]) << "test: " << test << ", perm: " << perm;
+            }
+        }
+
+        const I ids = I(Vc::IndexesFromZero) * 3 + 1;
+        const auto pair = Vc::sorted_with_index(test, ids);
+        COMPARE(pair.first, sorted);
+        COMPARE(pair.second, perm * 3 + 1);
+    }
+}
+
+template <class T> void testSimdArgsort()
+{
+    for (std::size_t size : {0, 1, 5, 17, 100, 1000, 100003}) {
+        for (int pattern = 0; pattern < 3; ++pattern) {
+            std::vector<T> data(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                const T values[3] = {T((i * 7919 + 13) % 1000), T(i % 5), T(1)};
+                data[i] = values[pattern];
+            }
+            std::vector<int> indexes(size);
+            VERIFY(Vc::simd_argsort(data.begin(), data.end(), indexes.begin()) ==
+                   indexes.end());
+            std::vector<int> seen(size, 0);
+            for (std::size_t i = 0; i < size; ++i) {
+                ++seen[indexes[i]];
+                if (i > 0) {
+                    VERIFY(data[indexes[i - 1]] <= data[indexes[i]]) << "size: " << size;
+                }
+            }
+            VERIFY(seen == std::vector<int>(size, 1)) << "size: " << size;
+        }
+    }
+}
+
+TEST(simdArgsort)
+{
+    testSimdArgsort<float>();
+    testSimdArgsort<int>();
+    testSimdArgsort<unsigned short>();
+    testSimdArgsort<double>();
+}
+
+template <class T> void testSimdSelection()
+{
+    for (std::size_t size : {1, 10, 100, 5000, 100003}) {
+        for (std::size_t k : {1, 3, 10, 100, 1000}) {
+            if (k > size) {
+                continue;
+            }
+            for (int pattern = 0; pattern < 3; ++pattern) {
+                std::vector<T> data(size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    const T values[3] = {T((i * 7919 + 13) % 10007), T(i % 5),
+                                         T(size - i)};
+                    data[i] = values[pattern];
+                }
+                std::vector<T> reference = data;
+                std::sort(reference.begin(), reference.end());
+
+                std::vector<T> nth = data;
+                Vc::simd_nth_element(nth.begin(), nth.begin() + (k - 1), nth.end());
+                COMPARE(nth[k - 1], reference[k - 1]) << "size: " << size << ", k: " << k;
+                for (std::size_t i = 0; i < size; ++i) {
+                    VERIFY(i < k ? !(nth[k - 1] < nth[i]) : !(nth[i] < nth[k - 1]))
+                        << "size: " << size << ", k: " << k << ", i: " << i;
+                }
+                std::sort(nth.begin(), nth.end());
+                VERIFY(nth == reference) << "size: " << size << ", k: " << k;
+
+                std::vector<T> partial = data;
+                Vc::simd_partial_sort(partial.begin(), partial.begin() + k,
+                                      partial.end());
+                VERIFY(std::equal(partial.begin(), partial.begin() + k,
+                                  reference.begin()))
+                    << "size: " << size << ", k: " << k;
+
+                std::vector<int> top(k + 1, -1);
+                VERIFY(Vc::simd_top_k(data.begin(), data.end(), k, top.begin()) ==
+                       top.begin() + k);
+                COMPARE(top[k], -1);
+                std::vector<int> seen(size, 0);
+                for (std::size_t i = 0; i < k; ++i) {
+                    COMPARE(data[top[i]], reference[size - 1 - i])
+                        << "size: " << size << ", k: " << k << ", i: " << i;
+                    COMPARE(++seen[top[i]], 1);
+                }
+            }
+        }
+    }
+}
+
+TEST(simdSelection)
+{
+    testSimdSelection<float>();
+    testSimdSelection<int>();
+    testSimdSelection<unsigned short>();
+    testSimdSelection<double>();
+    testSimdSelection<long>();
+}
+
 // vim: foldmethod=marker
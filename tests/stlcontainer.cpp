@@ -176,4 +176,551 @@ TEST_TYPES(V, simdForEach, AllVectors)
         for_each(test3);
     }
 }
+
+TEST_TYPES(V, simdForEachAlignedMasked, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::Mask M;
+    constexpr int N = V::Size;
+    std::vector<T, Vc::Allocator<T>> data(4 * N + 2);
+
+    for (int variant = 0; variant < 2; ++variant) {
+        for (int offset = 0; offset <= N + 1; ++offset) {
+            for (int length = 0; offset + length <= int(data.size()); ++length) {
+                std::iota(data.begin(), data.end(), T(0));
+                const auto b = data.begin() + offset;
+                int calls = 0;
+                int partial_calls = 0;
+                int position = offset;
+
+                auto &&for_each = [&](auto test) {
+                    if (variant == 0) {
+                        Vc::simd_for_each(Vc::AlignedMasked, b, b + length, test);
+                    } else {
+                        Vc::simd_for_each_n(Vc::AlignedMasked, b, length, test);
+                    }
+                };
+                // the mutable variant must write back exactly the valid entries
+                for_each([&](auto &x, const auto &k) {
+                    static_assert(std::is_same<decltype(x), V &>::value, "");
+                    static_assert(std::is_same<typename std::decay<decltype(k)>::type,
+                                               M>::value,
+                                  "");
+                    ++calls;
+                    if (!all_of(k)) {
+                        ++partial_calls;
+                    }
+                    const int valid = k.count();
+                    VERIFY(valid > 0);
+                    COMPARE(k, V::IndexesFromZero() < valid);
+                    if (valid == N && N > 1) {
+                        COMPARE(reinterpret_cast<std::uintptr_t>(&data[position]) %
+                                    V::MemoryAlignment,
+                                0u)
+                            << "offset: " << offset << ", length: " << length;
+                    }
+                    where(k) | x += 1;
+                    for (int i = 0; i < valid; ++i) {
+                        COMPARE(x[i], T(position + i + 1));
+                    }
+                    position += valid;
+                });
+                COMPARE(position, offset + length);
+                VERIFY(partial_calls <= 2);
+                VERIFY(calls <= (length + N - 1) / N + 1);
+                for (int i = 0; i < int(data.size()); ++i) {
+                    const bool in_range = i >= offset && i < offset + length;
+                    COMPARE(data[i], T(i + (in_range ? 1 : 0)))
+                        << "offset: " << offset << ", length: " << length << ", i: " << i;
+                }
+
+                // the immutable variant must not write back
+                position = offset;
+                for_each([&](V x, M k) {
+                    x += 1;
+                    position += k.count();
+                });
+                COMPARE(position, offset + length);
+                for (int i = 0; i < int(data.size()); ++i) {
+                    const bool in_range = i >= offset && i < offset + length;
+                    COMPARE(data[i], T(i + (in_range ? 1 : 0)));
+                }
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, parallelSimdForEach, AllVectors)
+{
+    typedef typename V::EntryType T;
+    Vc::ThreadPool pool(4);
+    for (std::size_t size : {0, 1, 17, 1000, 100000, 300001}) {
+        std::vector<T, Vc::Allocator<T>> data(size + 1);
+        for (int offset = 0; offset < 2; ++offset) {
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                data[i] = T(i % 100);
+            }
+            const auto b = data.begin() + offset;
+            const auto e = b + (size - offset);
+            Vc::parallel_simd_for_each(pool, Vc::ScalarRemainder, b, e,
+                                       [](auto &x) { x += 1; });
+            Vc::parallel_simd_for_each(pool, Vc::AlignedMasked, b, e,
+                                       [](auto &x, auto k) { where(k) | x += 1; });
+            Vc::parallel_simd_for_each_n(pool, Vc::AlignedMasked, b, size - offset,
+                                         [](V x, typename V::Mask) { x += 1; });
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                const bool in_range = i >= std::size_t(offset) && i < size;
+                COMPARE(data[i], T(i % 100 + (in_range ? 2 : 0)))
+                    << "size: " << size << ", offset: " << offset << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, simdTransform, AllVectors)
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size = 0; size < 3 * V::Size + 3; ++size) {
+        std::vector<T> in(size), in2(size), out(size + 1, T(-1));
+        for (std::size_t i = 0; i < size; ++i) {
+            in[i] = T(i % 7);
+            in2[i] = T(i % 5);
+        }
+        auto end = Vc::simd_transform(in.begin(), in.end(), out.begin(),
+                                      [](auto x) { return x + x + T(1); });
+        COMPARE(end - out.begin(), std::ptrdiff_t(size));
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(in[i] + in[i] + 1)) << "size: " << size << ", i: " << i;
+        }
+        COMPARE(out[size], T(-1)) << "wrote past the end of the output range";
+
+        end = Vc::simd_transform(in.begin(), in.end(), in2.begin(), out.begin(),
+                                 [](auto a, auto b) { return a - b; });
+        COMPARE(end - out.begin(), std::ptrdiff_t(size));
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(in[i] - in2[i])) << "size: " << size << ", i: " << i;
+        }
+        COMPARE(out[size], T(-1)) << "wrote past the end of the output range";
+    }
+}
+
+TEST_TYPES(V, simdReduce, AllVectors)
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size = 0; size < 9 * V::Size + 3; ++size) {
+        std::vector<T> data(size), data2(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = T((i * 5) % 7);
+            data2[i] = T(i % 3);
+        }
+        const auto b = data.begin();
+        const auto e = data.end();
+        COMPARE(Vc::simd_reduce(b, e, T(3)), std::accumulate(b, e, T(3)))
+            << "size: " << size;
+        COMPARE(Vc::simd_reduce(b, e, 3.), std::accumulate(b, e, 3.)) << "size: " << size;
+        COMPARE(Vc::simd_reduce(b, e, T(3), [](auto x, auto y) { return x + y; }),
+                std::accumulate(b, e, T(3)))
+            << "size: " << size;
+        COMPARE(Vc::simd_reduce(b, e, T(4), Vc::Minimum()),
+                std::accumulate(b, e, T(4), [](T x, T y) { return std::min(x, y); }))
+            << "size: " << size;
+        COMPARE(Vc::simd_reduce(b, e, T(1), Vc::Maximum()),
+                std::accumulate(b, e, T(1), [](T x, T y) { return std::max(x, y); }))
+            << "size: " << size;
+
+        std::vector<T> ones(size, T(1));
+        if (size > 0) {
+            ones[size / 2] = T(3);
+        }
+        COMPARE(Vc::simd_reduce(ones.begin(), ones.end(), T(2), std::multiplies<T>()),
+                T(size > 0 ? 6 : 2))
+            << "size: " << size;
+
+        COMPARE(Vc::simd_transform_reduce(b, e, T(1), std::plus<>(),
+                                          [](auto x) { return x * x; }),
+                std::accumulate(b, e, T(1), [](T x, T y) { return T(x + y * y); }))
+            << "size: " << size;
+        COMPARE(Vc::simd_transform_reduce(b, e, data2.begin(), T(2)),
+                std::inner_product(b, e, data2.begin(), T(2)))
+            << "size: " << size;
+    }
+
+    // a wider init widens the reduction, as for std::accumulate
+    const std::vector<T> hundreds(100000 + V::Size / 2, T(100));
+    const auto b = hundreds.begin();
+    const auto e = hundreds.end();
+    COMPARE(Vc::simd_reduce(b, e, 0LL), std::accumulate(b, e, 0LL));
+    COMPARE(Vc::simd_reduce(b, e, 0.), std::accumulate(b, e, 0.));
+    COMPARE(Vc::simd_reduce(b, e, 1ull, Vc::Maximum()), 100ull);
+    COMPARE(Vc::simd_transform_reduce(b, e, 0LL, std::plus<>(),
+                                      [](auto x) { return x - T(99); }),
+            static_cast<long long>(hundreds.size()));
+    COMPARE(Vc::simd_transform_reduce(b, e, b, 0.), std::inner_product(b, e, b, 0.));
+}
+
+TEST_TYPES(V, simdFind, concat<AllVectors, CharVectors, LLongVectors>)
+{
+    typedef typename V::EntryType T;
+    typedef Vc::simdize<T> V0;
+    const std::size_t N = V0::size();
+    // one more element than used, to verify that matches after the range are ignored
+    std::vector<T, Vc::Allocator<T>> data(9 * N + 4);
+    for (std::size_t offset = 0; offset < 2; ++offset) {
+        for (std::size_t size = offset; size < data.size(); ++size) {
+            std::fill(data.begin(), data.end(), T(1));
+            const auto b = data.begin() + offset;
+            const auto e = data.begin() + size;
+            const auto is2 = [](const V0 &x) { return x == T(2); };
+            const auto is1 = [](const V0 &x) { return x == T(1); };
+            COMPARE(Vc::simd_find(b, e, T(2)) - b, e - b);
+            COMPARE(Vc::simd_find_if(b, e, is2) - b, e - b);
+            COMPARE(Vc::simd_count_if(b, e, is1), e - b);
+            VERIFY(!Vc::simd_any_of(b, e, is2));
+            VERIFY(Vc::simd_none_of(b, e, is2));
+            VERIFY(Vc::simd_all_of(b, e, is1));
+            // elements outside of [b, e) must not be found
+            if (offset > 0) {
+                data[0] = T(2);
+            }
+            data[size] = T(2);
+            for (auto it = b; it != e; ++it) {
+                *it = T(2);
+                COMPARE(Vc::simd_find(b, e, T(2)) - b, it - b)
+                    << "offset: " << offset << ", size: " << size;
+                COMPARE(Vc::simd_count_if(b, e, is2), 1)
+                    << "offset: " << offset << ", size: " << size;
+                VERIFY(Vc::simd_any_of(b, e, is2));
+                VERIFY(!Vc::simd_all_of(b, e, is1));
+                VERIFY(!Vc::simd_none_of(b, e, is2));
+                *it = T(1);
+            }
+            std::fill(b, e, T(2));
+            COMPARE(Vc::simd_count_if(b, e, is2), e - b);
+        }
+    }
+}
+
+TEST_TYPES(V, compressStore, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::Mask M;
+    const V v = V([](int i) { return T(i + 1); });
+    const std::size_t masks = V::Size <= 8 ? std::size_t(1) << V::Size : 1000;
+    for (std::size_t bits = 0; bits < masks; ++bits) {
+        const M k = M::generate([&](std::size_t i) {
+            return V::Size <= 8 ? (bits >> i) & 1 : (bits * 7919 + i * 104729) % 3 == 0;
+        });
+        std::vector<T> mem(V::Size + 1, T(0));
+        COMPARE(Vc::compress_store(v, k, mem.data()), std::size_t(k.count()));
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (k[i]) {
+                COMPARE(mem[n], v[i]) << "k: " << k << ", n: " << n;
+                ++n;
+            }
+        }
+        for (; n < mem.size(); ++n) {
+            COMPARE(mem[n], T(0)) << "k: " << k << ", wrote past the selected entries";
+        }
+    }
+}
+
+TEST_TYPES(V, expandLoad, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::Mask M;
+    const V v = V([](int i) { return T(i + 1); });
+    const std::size_t masks = V::Size <= 8 ? std::size_t(1) << V::Size : 1000;
+    std::vector<T> mem(V::Size);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        mem[i] = T(100 - i);
+    }
+    for (std::size_t bits = 0; bits < masks; ++bits) {
+        const M k = M::generate([&](std::size_t i) {
+            return V::Size <= 8 ? (bits >> i) & 1 : (bits * 7919 + i * 104729) % 3 == 0;
+        });
+        V x = v;
+        COMPARE(Vc::expand_load(x, k, mem.data()), std::size_t(k.count()));
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const T expected = k[i] ? mem[n++] : v[i];
+            COMPARE(x[i], expected) << "k: " << k << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, simdCopyIf, concat<AllVectors, CharVectors, LLongVectors>)
+{
+    typedef typename V::EntryType T;
+    typedef Vc::simdize<T> V0;
+    for (std::size_t size = 0; size < 9 * V0::Size + 3; ++size) {
+        std::vector<T> data(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = T((i * 7) % 11);
+        }
+        const auto pred = [](const V0 &x) { return x > T(4); };
+        const auto scalar_pred = [](T x) { return x > T(4); };
+
+        std::vector<T> out(size + 1, T(0));
+        std::vector<T> ref(size + 1, T(0));
+        const auto end = Vc::simd_copy_if(data.begin(), data.end(), out.begin(), pred);
+        const auto ref_end = std::copy_if(data.begin(), data.end(), ref.begin(), scalar_pred);
+        COMPARE(end - out.begin(), ref_end - ref.begin()) << "size: " << size;
+        VERIFY(out == ref) << "size: " << size;
+
+        auto removed = data;
+        const auto rm_end = Vc::simd_remove_if(removed.begin(), removed.end(), pred);
+        const auto ref_rm_end = std::remove_if(data.begin(), data.end(), scalar_pred);
+        COMPARE(rm_end - removed.begin(), ref_rm_end - data.begin()) << "size: " << size;
+        VERIFY(std::equal(removed.begin(), rm_end, data.begin())) << "size: " << size;
+    }
+}
+TEST_TYPES(V, simdScan, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const auto right = [](auto, auto y) { return y; };  // associative, not commutative
+    Vc::ThreadPool pool(4);
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(2), V::Size + 1,
+                             9 * V::Size + 3, std::size_t(100003)}) {
+        std::vector<T> data(size), out(size), reference(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = T((i * 5) % 7);
+        }
+        const auto b = data.begin();
+        const auto e = data.end();
+        std::partial_sum(b, e, reference.begin());
+        VERIFY(Vc::simd_inclusive_scan(b, e, out.begin()) == out.end());
+        VERIFY(out == reference) << "size: " << size;
+        std::fill(out.begin(), out.end(), T(0));
+        VERIFY(Vc::parallel_simd_inclusive_scan(pool, b, e, out.begin()) == out.end());
+        VERIFY(out == reference) << "size: " << size;
+
+        // in place, with init
+        out = data;
+        Vc::simd_inclusive_scan(out.begin(), out.end(), out.begin(), std::plus<T>(),
+                                T(2));
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(reference[i] + 2)) << "size: " << size << ", i: " << i;
+        }
+        out = data;
+        Vc::parallel_simd_inclusive_scan(pool, out.begin(), out.end(), out.begin(),
+                                         std::plus<T>(), T(2));
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(reference[i] + 2)) << "size: " << size << ", i: " << i;
+        }
+
+        // exclusive
+        VERIFY(Vc::simd_exclusive_scan(b, e, out.begin(), T(1)) == out.end());
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(1 + (i == 0 ? 0 : reference[i - 1])))
+                << "size: " << size << ", i: " << i;
+        }
+        std::fill(out.begin(), out.end(), T(0));
+        VERIFY(Vc::parallel_simd_exclusive_scan(pool, b, e, out.begin(), T(1)) ==
+               out.end());
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], T(1 + (i == 0 ? 0 : reference[i - 1])))
+                << "size: " << size << ", i: " << i;
+        }
+
+        // other operations
+        std::partial_sum(b, e, reference.begin(),
+                         [](T x, T y) { return std::max(x, y); });
+        Vc::simd_inclusive_scan(b, e, out.begin(), Vc::Maximum());
+        VERIFY(out == reference) << "size: " << size;
+        Vc::simd_inclusive_scan(b, e, out.begin(), right);
+        VERIFY(out == data) << "size: " << size;
+        Vc::parallel_simd_inclusive_scan(pool, b, e, out.begin(), right, T(9));
+        VERIFY(out == data) << "size: " << size;
+        Vc::parallel_simd_exclusive_scan(pool, b, e, out.begin(), T(9), right);
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(out[i], i == 0 ? T(9) : data[i - 1]) << "size: " << size;
+        }
+    }
+}
+
+TEST_TYPES(V, simdHistogram, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename std::conditional<std::is_floating_point<T>::value, T, double>::type
+        F;
+    Vc::ThreadPool pool(4);
+    const T edgeValues[] = {T(0), T(1), T(2), T(5), T(6), T(13), T(20), T(21), T(30)};
+    const Vc::EdgeBinning<T> edges(std::begin(edgeValues), std::end(edgeValues));
+    COMPARE(edges.size(), 8u);
+    const Vc::UniformBinning<T> uniform(T(2), T(25), 7);
+    COMPARE(uniform.size(), 7u);
+    for (std::size_t size : {std::size_t(0), std::size_t(1), V::Size + 1,
+                             9 * V::Size + 3, std::size_t(100003)}) {
+        std::vector<T> data(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = T((i * 7) % 37);
+        }
+        if (std::is_floating_point<T>::value && size > 2) {
+            data[1] = std::numeric_limits<T>::quiet_NaN();
+            data[2] = T(2.5);
+        }
+        std::vector<std::size_t> ref_edges(edges.size()), ref_uniform(uniform.size());
+        for (T x : data) {
+            if (x >= edgeValues[0] && x < edgeValues[8]) {
+                ++ref_edges[std::upper_bound(std::begin(edgeValues), std::end(edgeValues),
+                                             x) -
+                            std::begin(edgeValues) - 1];
+            }
+            if (x >= T(2) && x < T(25)) {
+                const F scale = F(7) / (F(25) - F(2));
+                ++ref_uniform[std::min(int((F(x) - F(2)) * scale), 6)];
+            }
+        }
+
+        std::vector<std::size_t> out(edges.size(), 1);
+        Vc::simd_histogram(data.begin(), data.end(), out.begin(), edges);
+        for (std::size_t b = 0; b < edges.size(); ++b) {
+            COMPARE(out[b], ref_edges[b] + 1) << "size: " << size << ", bin: " << b;
+        }
+        std::fill(out.begin(), out.end(), 0);
+        Vc::parallel_simd_histogram(pool, data.begin(), data.end(), out.begin(), edges);
+        VERIFY(out == ref_edges) << "size: " << size;
+
+        out.assign(uniform.size(), 0);
+        Vc::simd_histogram(data.begin(), data.end(), out.begin(), uniform);
+        VERIFY(out == ref_uniform) << "size: " << size;
+        std::fill(out.begin(), out.end(), 0);
+        Vc::parallel_simd_histogram(pool, data.begin(), data.end(), out.begin(), uniform);
+        VERIFY(out == ref_uniform) << "size: " << size;
+    }
+}
+
+TEST_TYPES(V, simdLowerBound, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::IndexType I;
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(2),
+                             std::size_t(7), std::size_t(1000)}) {
+        // sorted, with runs of equal values
+        std::vector<T> sorted(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            sorted[i] = T(i / 3 * 2);
+        }
+        const auto b = sorted.begin();
+        const auto e = sorted.end();
+        const auto reference = [&](T key) {
+            return int(std::lower_bound(b, e, key) - b);
+        };
+
+        const std::size_t nkeys = 9 * V::Size + 3;
+        std::vector<T> keys(nkeys);
+        for (std::size_t i = 0; i < nkeys; ++i) {
+            keys[i] = T((i * 37) % (size / 3 * 2 + 4));
+        }
+        std::vector<int> out(nkeys + 1, -1);
+        VERIFY(Vc::simd_lower_bound(b, e, keys.begin(), keys.end(), out.begin()) ==
+               out.begin() + nkeys);
+        for (std::size_t i = 0; i < nkeys; ++i) {
+            COMPARE(out[i], reference(keys[i]))
+                << "size: " << size << ", key: " << keys[i];
+        }
+        COMPARE(out[nkeys], -1);
+
+        for (std::size_t i = 0; i + V::Size <= nkeys; i += V::Size) {
+            const V k(&keys[i], Vc::Unaligned);
+            const I expected([&](std::size_t j) { return reference(k[j]); });
+            COMPARE(Vc::simd_lower_bound(b, e, k), expected) << "size: " << size;
+            COMPARE(Vc::simd_lower_bound(b, e, k, Vc::PrefetchDefault), expected)
+                << "size: " << size;
+        }
+    }
+}
+
+TEST_TYPES(V, simdSearchTree, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef Vc::SimdSearchTree<T> Tree;
+    const Tree empty;
+    COMPARE(empty.size(), 0u);
+    COMPARE(empty.lower_bound(T(1)), 0u);
+    VERIFY(!empty.contains(T(1)));
+    for (std::size_t size :
+         {std::size_t(1), Tree::NodeSize - 1, Tree::NodeSize,
+          Tree::NodeSize * (Tree::NodeSize + 1) + 3, std::size_t(3000)}) {
+        // sorted, with runs of equal values and gaps
+        std::vector<T> sorted(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            sorted[i] = T(i / 3 * 2 + 1);
+        }
+        const auto b = sorted.begin();
+        const auto e = sorted.end();
+        const auto reference = [&](T key) {
+            return std::size_t(std::lower_bound(b, e, key) - b);
+        };
+        const Tree tree(b, e);
+        COMPARE(tree.size(), size);
+
+        const std::size_t nkeys = 9 * V::Size + 3;
+        std::vector<T> keys(nkeys);
+        for (std::size_t i = 0; i < nkeys; ++i) {
+            keys[i] = T((i * 37) % (size / 3 * 2 + 4));
+        }
+        for (T key : keys) {
+            const std::size_t pos = reference(key);
+            COMPARE(tree.lower_bound(key), pos) << "size: " << size << ", key: " << key;
+            const bool found = pos < size && sorted[pos] == key;
+            COMPARE(tree.contains(key), found) << "size: " << size << ", key: " << key;
+            COMPARE(tree.find(key), found ? pos : size) << "size: " << size;
+            const auto r = tree.range(key, T(key + 3));
+            COMPARE(r.first, pos) << "size: " << size << ", key: " << key;
+            COMPARE(r.second, reference(T(key + 3)))
+                << "size: " << size << ", key: " << key;
+        }
+
+        std::vector<int> out(nkeys + 1, -1);
+        VERIFY(tree.lower_bound(keys.begin(), keys.end(), out.begin()) ==
+               out.begin() + nkeys);
+        for (std::size_t i = 0; i < nkeys; ++i) {
+            COMPARE(std::size_t(out[i]), reference(keys[i])) << "size: " << size;
+        }
+        COMPARE(out[nkeys], -1);
+
+        for (std::size_t i = 0; i + V::Size <= nkeys; i += V::Size) {
+            const V k(&keys[i], Vc::Unaligned);
+            const typename V::IndexType expected(
+                [&](std::size_t j) { return int(reference(k[j])); });
+            COMPARE(tree.lower_bound(k), expected) << "size: " << size;
+        }
+    }
+}
+
 #endif
+
+TEST(threadPool)
+{
+    for (std::size_t nthreads : {1, 2, 5}) {
+        Vc::ThreadPool pool(nthreads);
+        COMPARE(pool.size(), nthreads);
+        for (std::size_t chunks : {0, 1, 3, 1000}) {
+            std::vector<int> calls(chunks, 0);
+            pool.run(chunks, [&](std::size_t i) {
+                ++calls[i];
+                // nested calls execute serially on the calling thread
+                int nested = 0;
+                pool.run(3, [&](std::size_t) { ++nested; });
+                COMPARE(nested, 3);
+            });
+            for (std::size_t i = 0; i < chunks; ++i) {
+                COMPARE(calls[i], 1) << "chunk " << i;
+            }
+        }
+
+        bool caught = false;
+        try {
+            pool.run(100, [](std::size_t i) {
+                if (i == 42) {
+                    throw std::runtime_error("chunk 42");
+                }
+            });
+        } catch (std::runtime_error &) {
+            caught = true;
+        }
+        VERIFY(caught);
+    }
+}
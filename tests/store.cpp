@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "unittest.h"
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <vector>
 
 using namespace Vc;
 
@@ -195,3 +197,109 @@ TEST_TYPES(Vec, maskedStore, AllVectors)
         }
     }
 }
+
+/* Stores every finite value of the storage type F, the midpoint to its successor, and the
+ * floats right next to the midpoint, for both signs, plus the values in \p extra.
+ */
+template <class Vec, class F>
+void storeFloatStorage(std::uint16_t maxFinite, std::initializer_list<float> extra)
+{
+    std::vector<float> input;
+    for (std::uint16_t h = 0; h < maxFinite; ++h) {
+        const float a = F::fromBits(h);
+        const float b = F::fromBits(h + 1);
+        const float mid = a + (b - a) * 0.5f;
+        COMPARE(F(mid).toBits(), h & 1 ? h + 1 : h);
+        COMPARE(F(std::nextafter(mid, 0.f)).toBits(), h);
+        COMPARE(F(std::nextafter(mid, b)).toBits(), h + 1);
+        for (float x : {a, mid, std::nextafter(mid, 0.f), std::nextafter(mid, b)}) {
+            input.push_back(x);
+            input.push_back(-x);
+        }
+    }
+    for (float x : extra) {
+        input.push_back(x);
+        input.push_back(-x);
+    }
+    while (input.size() % Vec::size() != 0) {
+        input.push_back(0.f);
+    }
+
+    const size_t count = input.size();
+    F *mem = Vc::malloc<F, Vc::AlignOnCacheline>(count + Vec::size());
+    const auto verify = [&](const F *out, size_t i) {
+        for (size_t j = 0; j < Vec::size(); ++j) {
+            const F ref = input[i + j];
+            if (std::isnan(input[i + j])) {
+                VERIFY(std::isnan(float(out[j])));
+            } else {
+                COMPARE(out[j].toBits(), ref.toBits()) << "input: " << input[i + j];
+            }
+        }
+    };
+    const bool canAlign = (Vec::size() & (Vec::size() - 1)) == 0;
+    for (size_t i = 0; i < count; i += Vec::size()) {
+        const Vec x(&input[i], Vc::Unaligned);
+        if (canAlign) {
+            x.store(&mem[i], Vc::Aligned);
+            verify(&mem[i], i);
+            x.store(&mem[i], Vc::Streaming | Vc::Aligned);
+            verify(&mem[i], i);
+        }
+        x.store(&mem[i + 1], Vc::Unaligned);
+        verify(&mem[i + 1], i);
+        x.store(&mem[i + 1], Vc::Streaming | Vc::Unaligned);
+        verify(&mem[i + 1], i);
+        Vc::store_interleaved(x, &mem[i + 1]);
+        verify(&mem[i + 1], i);
+    }
+
+    // masked stores must leave the other entries untouched
+    const auto mask = Vec::IndexesFromZero() * 0.5f != floor(Vec::IndexesFromZero() * 0.5f);
+    for (size_t i = 0; i < count; i += Vec::size()) {
+        std::fill_n(&mem[i + 1], Vec::size(), F::fromBits(0x1234));
+        const Vec x(&input[i], Vc::Unaligned);
+        x.store(&mem[i + 1], mask, Vc::Unaligned);
+        for (size_t j = 0; j < Vec::size(); ++j) {
+            const F ref = mask[j] ? F(input[i + j]) : F::fromBits(0x1234);
+            if (mask[j] && std::isnan(input[i + j])) {
+                VERIFY(std::isnan(float(mem[i + 1 + j])));
+            } else {
+                COMPARE(mem[i + 1 + j].toBits(), ref.toBits()) << "j: " << j;
+            }
+        }
+    }
+    Vc::free(mem);
+}
+
+TEST_TYPES(Vec, storeFloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    COMPARE(float16(1.f).toBits(), 0x3c00);
+    COMPARE(float16(65504.f).toBits(), 0x7bff);
+    COMPARE(float16(65520.f).toBits(), 0x7c00);  // rounds to infinity
+    COMPARE(float16(-std::ldexp(1.f, -25)).toBits(), 0x8000);  // tie to even
+    COMPARE(float16(std::ldexp(3.f, -25)).toBits(), 0x0002);   // tie to even
+    COMPARE(float16(std::numeric_limits<float>::max()).toBits(), 0x7c00);
+    COMPARE(float16(std::numeric_limits<float>::quiet_NaN()).toBits() & 0x7e00, 0x7e00);
+
+    storeFloatStorage<Vec, float16>(
+        0x7bff, {65504.f, 65519.f, 65520.f, 1e10f, std::numeric_limits<float>::infinity(),
+                 std::numeric_limits<float>::quiet_NaN(), std::ldexp(1.f, -26), 0.f});
+}
+
+TEST_TYPES(Vec, storeBfloat16,
+           Typelist<float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>>)
+{
+    using L = std::numeric_limits<float>;
+    COMPARE(bfloat16(1.f).toBits(), 0x3f80);
+    COMPARE(bfloat16(L::max()).toBits(), 0x7f80);  // rounds to infinity
+    COMPARE(bfloat16(L::denorm_min()).toBits(), 0);
+    COMPARE(bfloat16(-L::infinity()).toBits(), 0xff80);
+    COMPARE(bfloat16(L::quiet_NaN()).toBits() & 0x7fc0, 0x7fc0);
+    COMPARE(bfloat16(-L::signaling_NaN()).toBits() & 0xffc0, 0xffc0);
+
+    storeFloatStorage<Vec, bfloat16>(
+        0x7f7f, {L::max(), L::min(), L::denorm_min(), L::infinity(), L::quiet_NaN(),
+                 L::signaling_NaN(), 0.f});
+}
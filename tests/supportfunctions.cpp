@@ -40,6 +40,10 @@ TEST(testIsSupported)
     COMPARE(Vc::isImplementationSupported(Vc::SSE42Impl), CpuId::hasSse42());
     COMPARE(Vc::isImplementationSupported(Vc::AVXImpl  ), CpuId::hasOsxsave() && CpuId::hasAvx());
     COMPARE(Vc::isImplementationSupported(Vc::AVX2Impl ), CpuId::hasOsxsave() && CpuId::hasAvx2());
+    if (!CpuId::hasAvx2() || !CpuId::hasAvx512f() || !CpuId::hasAvx512vl() ||
+        !CpuId::hasAvx512dq() || !CpuId::hasAvx512bw() || !CpuId::hasAvx512cd()) {
+        VERIFY(!Vc::isImplementationSupported(Vc::AVX512Impl));
+    }
 }
 
 TEST(testBestImplementation)
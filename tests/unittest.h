@@ -36,6 +36,13 @@ using IntVectors = vir::Typelist<Vc::native_simd<int>, Vc::native_simd<unsigned
                                  Vc::native_simd<unsigned int>, Vc::native_simd<short>>;
 using AllVectors = vir::concat<RealVectors, IntVectors>;
 using AllMasks = vir::Typelist<Vc::double_m, Vc::float_m, Vc::int_m, Vc::short_m>;
+using CharVectors =
+    vir::Typelist<Vc::native_simd<signed char>, Vc::native_simd<unsigned char>>;
+template <int N>
+using CharSimdArrays = vir::Typelist<Vc::fixed_size_simd<signed char, N>,
+                                     Vc::fixed_size_simd<unsigned char, N>>;
+using LLongVectors =
+    vir::Typelist<Vc::native_simd<long long>, Vc::native_simd<unsigned long long>>;
 template <int N>
 using RealSimdArrays =
     vir::Typelist<Vc::fixed_size_simd<double, N>, Vc::fixed_size_simd<float, N>>;